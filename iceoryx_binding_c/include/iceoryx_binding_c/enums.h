@@ -145,6 +145,7 @@ enum iox_WaitSetResult
 {
     WaitSetResult_WAIT_SET_FULL,
     WaitSetResult_ALREADY_ATTACHED,
+    WaitSetResult_FILE_DESCRIPTOR_UNAVAILABLE,
     WaitSetResult_UNDEFINED_ERROR,
     WaitSetResult_SUCCESS
 };
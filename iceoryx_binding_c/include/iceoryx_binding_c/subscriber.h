@@ -106,7 +106,21 @@ ENUM iox_SubscribeState iox_sub_get_subscription_state(iox_sub_t const self);
 ///         an enum which describes the error
 ENUM iox_ChunkReceiveResult iox_sub_take_chunk(iox_sub_t const self, const void** const userPayload);
 
-/// @brief release a previously acquired chunk (via iox_sub_take_chunk)
+/// @brief retrieve multiple received chunks in one call
+/// @param[in] self handle to the subscriber
+/// @param[in] userPayloads array in which the pointers to the user-payloads of the chunks are stored in the order of
+///            the receive queue
+/// @param[in] capacity number of elements userPayloads can hold, at most this number of chunks is taken
+/// @param[in] numberOfTakenChunks pointer in which the number of taken chunks is stored
+/// @return if at least one chunk could be received it returns ChunkReceiveResult_SUCCESS otherwise
+///         an enum which describes the error
+/// @note every taken chunk must be released with iox_sub_release_chunk
+ENUM iox_ChunkReceiveResult iox_sub_take_chunks(iox_sub_t const self,
+                                                const void** const userPayloads,
+                                                const uint64_t capacity,
+                                                uint64_t* const numberOfTakenChunks);
+
+/// @brief release a previously acquired chunk (via iox_sub_take_chunk or iox_sub_take_chunks)
 /// @param[in] self handle to the subscriber
 /// @param[in] userPayload pointer to the user-payload of chunk which should be released
 void iox_sub_release_chunk(iox_sub_t const self, const void* const userPayload);
@@ -75,6 +75,13 @@ uint64_t iox_ws_size(iox_ws_t const self);
 /// @brief returns the maximum amount of events/states which can be registered at the waitset
 uint64_t iox_ws_capacity(iox_ws_t const self);
 
+/// @brief returns a file descriptor which is readable as long as events or states are pending, this way the waitset
+///        can be used in select, poll or epoll based event loops. When it is readable iox_ws_timed_wait() with a
+///        zero timeout returns the triggered events/states without blocking.
+/// @param[in] self handle to the waitset
+/// @return the file descriptor which must not be closed by the user or -1 if it could not be created
+int iox_ws_get_file_descriptor(iox_ws_t const self);
+
 /// @brief Non-reversible call. After this call iox_ws_wait() and iox_ws_timed_wait() do
 ///        not block any longer and never return triggered events/states. This
 ///        function can be used to manually initialize destruction and to wakeup
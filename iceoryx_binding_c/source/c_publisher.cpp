@@ -164,6 +164,26 @@ void iox_pub_publish_chunk(iox_pub_t const self, void* const userPayload)
     PublisherPortUser(self->m_portData).sendChunk(ChunkHeader::fromUserPayload(userPayload));
 }
 
+void iox_pub_publish_chunks(iox_pub_t const self, void* const* const userPayloads, const uint64_t numberOfUserPayloads)
+{
+    PublisherPortUser port(self->m_portData);
+    PublisherPortUser::ChunkHeaderBatch_t chunkHeaders;
+    for (uint64_t i = 0U; i < numberOfUserPayloads; ++i)
+    {
+        chunkHeaders.emplace_back(ChunkHeader::fromUserPayload(userPayloads[i]));
+        if (chunkHeaders.size() == chunkHeaders.capacity())
+        {
+            port.sendChunks(chunkHeaders);
+            chunkHeaders.clear();
+        }
+    }
+
+    if (!chunkHeaders.empty())
+    {
+        port.sendChunks(chunkHeaders);
+    }
+}
+
 void iox_pub_offer(iox_pub_t const self)
 {
     PublisherPortUser(self->m_portData).offer();
@@ -163,6 +163,26 @@ iox_ChunkReceiveResult iox_sub_take_chunk(iox_sub_t const self, const void** con
     return ChunkReceiveResult_SUCCESS;
 }
 
+iox_ChunkReceiveResult iox_sub_take_chunks(iox_sub_t const self,
+                                           const void** const userPayloads,
+                                           const uint64_t capacity,
+                                           uint64_t* const numberOfTakenChunks)
+{
+    SubscriberPortUser::ChunkHeaderBatch_t chunkHeaders;
+    auto result = SubscriberPortUser(self->m_portData).tryGetChunks(chunkHeaders, capacity);
+    *numberOfTakenChunks = chunkHeaders.size();
+    if (result.has_error())
+    {
+        return cpp2c::chunkReceiveResult(result.get_error());
+    }
+
+    for (uint64_t i = 0U; i < chunkHeaders.size(); ++i)
+    {
+        userPayloads[i] = chunkHeaders[i]->userPayload();
+    }
+    return ChunkReceiveResult_SUCCESS;
+}
+
 void iox_sub_release_chunk(iox_sub_t const self, const void* const userPayload)
 {
     SubscriberPortUser(self->m_portData).releaseChunk(ChunkHeader::fromUserPayload(userPayload));
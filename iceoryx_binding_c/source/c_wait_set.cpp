@@ -116,6 +116,17 @@ uint64_t iox_ws_capacity(iox_ws_t const self)
     return self->capacity();
 }
 
+int iox_ws_get_file_descriptor(iox_ws_t const self)
+{
+    iox::cxx::Expects(self != nullptr);
+    auto result = self->getFileDescriptor();
+    if (result.has_error())
+    {
+        return -1;
+    }
+    return result.value();
+}
+
 void iox_ws_mark_for_destruction(iox_ws_t const self)
 {
     iox::cxx::Expects(self != nullptr);
@@ -209,7 +209,8 @@ TEST(cpp2c_enum_translation_test, WaitSetResult)
     ::testing::Test::RecordProperty("TEST_ID", "0b2fbd01-38b4-414d-be21-70d00d2d8fbf");
     constexpr EnumMapping<iox::popo::WaitSetError, iox_WaitSetResult> WAIT_SET_ERRORS[]{
         {iox::popo::WaitSetError::WAIT_SET_FULL, WaitSetResult_WAIT_SET_FULL},
-        {iox::popo::WaitSetError::ALREADY_ATTACHED, WaitSetResult_ALREADY_ATTACHED}};
+        {iox::popo::WaitSetError::ALREADY_ATTACHED, WaitSetResult_ALREADY_ATTACHED},
+        {iox::popo::WaitSetError::FILE_DESCRIPTOR_UNAVAILABLE, WaitSetResult_FILE_DESCRIPTOR_UNAVAILABLE}};
 
     for (const auto waitSetError : WAIT_SET_ERRORS)
     {
@@ -221,6 +222,9 @@ TEST(cpp2c_enum_translation_test, WaitSetResult)
         case iox::popo::WaitSetError::ALREADY_ATTACHED:
             EXPECT_EQ(cpp2c::waitSetResult(waitSetError.cpp), waitSetError.c);
             break;
+        case iox::popo::WaitSetError::FILE_DESCRIPTOR_UNAVAILABLE:
+            EXPECT_EQ(cpp2c::waitSetResult(waitSetError.cpp), waitSetError.c);
+            break;
             // default intentionally left out in order to get a compiler warning if the enum gets extended and we forgot
             // to extend the test
         }
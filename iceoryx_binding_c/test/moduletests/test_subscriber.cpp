@@ -248,6 +248,35 @@ TEST_F(iox_sub_test, receiveChunkWithContent)
     EXPECT_THAT(static_cast<const data_t*>(chunk)->value, Eq(1234));
 }
 
+TEST_F(iox_sub_test, takeChunksReceivesAllQueuedChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "279ea600-04d9-4ce5-9df1-43651f05dba7");
+    this->Subscribe(&m_portPtr);
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        *static_cast<uint64_t*>(sharedChunk.getUserPayload()) = i;
+        m_chunkPusher.push(sharedChunk);
+    }
+
+    const void* chunks[NUMBER_OF_CHUNKS + 1U];
+    uint64_t numberOfTakenChunks{0U};
+
+    ASSERT_EQ(iox_sub_take_chunks(m_sut, chunks, NUMBER_OF_CHUNKS + 1U, &numberOfTakenChunks),
+              ChunkReceiveResult_SUCCESS);
+    ASSERT_THAT(numberOfTakenChunks, Eq(NUMBER_OF_CHUNKS));
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        EXPECT_THAT(*static_cast<const uint64_t*>(chunks[i]), Eq(i));
+        iox_sub_release_chunk(m_sut, chunks[i]);
+    }
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_EQ(iox_sub_take_chunks(m_sut, chunks, NUMBER_OF_CHUNKS, &numberOfTakenChunks),
+              ChunkReceiveResult_NO_CHUNK_AVAILABLE);
+    EXPECT_THAT(numberOfTakenChunks, Eq(0U));
+}
+
 TEST_F(iox_sub_test, constChunkHeaderCanBeObtainedFromChunkAfterTake)
 {
     ::testing::Test::RecordProperty("TEST_ID", "b5d2462e-933d-426f-a5d8-40ac9a0d1773");
@@ -40,6 +40,10 @@ extern "C" {
 
 #include "test.hpp"
 
+#if !defined(_WIN32)
+#include <poll.h>
+#endif
+
 #include <atomic>
 #include <thread>
 
@@ -362,6 +366,25 @@ TEST_F(iox_ws_test, NumberOfTriggeredConditionsIsCorrectWhenAllWereTriggered)
               MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET);
 }
 
+#if !defined(_WIN32)
+TEST_F(iox_ws_test, FileDescriptorIsReadableWhenTriggeredAndNotAfterTimedWait)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a25a3ee0-52f5-4317-933d-2a79fbba38a2");
+    iox_ws_attach_user_trigger_event(m_sut, m_userTrigger[0U], 0U, userTriggerCallback);
+    const int fileDescriptor = iox_ws_get_file_descriptor(m_sut);
+    ASSERT_THAT(fileDescriptor, Ge(0));
+
+    iox_user_trigger_trigger(m_userTrigger[0U]);
+    pollfd pollFd{fileDescriptor, POLLIN, 0};
+    EXPECT_THAT(poll(&pollFd, 1U, 0), Eq(1));
+
+    EXPECT_EQ(iox_ws_timed_wait(
+                  m_sut, m_timeout, m_eventInfoStorage, MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET, &m_missedElements),
+              1U);
+    EXPECT_THAT(poll(&pollFd, 1U, 0), Eq(0));
+}
+#endif
+
 TEST_F(iox_ws_test, SingleTriggerCaseWaitReturnsCorrectTrigger)
 {
     ::testing::Test::RecordProperty("TEST_ID", "dd35162d-a076-43b3-bc3b-fcc574c6b5cf");
@@ -35,6 +35,7 @@ class Iceoryx : public IcePerfBase
     void sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept override;
     PerfTopic receivePerfTopic() noexcept override;
 
+  protected:
     iox::popo::UntypedPublisher m_publisher;
     iox::popo::UntypedSubscriber m_subscriber;
 };
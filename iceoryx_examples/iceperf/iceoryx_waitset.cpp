@@ -0,0 +1,49 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_waitset.hpp"
+
+#include <cstdlib>
+
+IceoryxWaitSet::IceoryxWaitSet(const iox::capro::IdString_t& publisherName,
+                               const iox::capro::IdString_t& subscriberName,
+                               const iox::units::Duration spinBudget) noexcept
+    : Iceoryx(publisherName, subscriberName)
+{
+    m_waitset.setSpinBudget(spinBudget);
+    m_waitset.attachState(m_subscriber, iox::popo::SubscriberState::HAS_DATA).or_else([](auto) {
+        std::cerr << "failed to attach subscriber" << std::endl;
+        std::exit(EXIT_FAILURE);
+    });
+}
+
+PerfTopic IceoryxWaitSet::receivePerfTopic() noexcept
+{
+    bool hasReceivedSample{false};
+    PerfTopic receivedSample;
+
+    do
+    {
+        m_waitset.wait();
+        m_subscriber.take().and_then([&](const void* data) {
+            receivedSample = *(static_cast<const PerfTopic*>(data));
+            hasReceivedSample = true;
+            m_subscriber.release(data);
+        });
+    } while (!hasReceivedSample);
+
+    return receivedSample;
+}
@@ -0,0 +1,37 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_EXAMPLES_ICEPERF_ICEORYX_WAITSET_HPP
+#define IOX_EXAMPLES_ICEPERF_ICEORYX_WAITSET_HPP
+
+#include "iceoryx.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+
+/// @brief Same as the Iceoryx technology but the subscriber blocks in a WaitSet instead of busy polling.
+/// This measures the wake up latency of the WaitSet for a given spin budget.
+class IceoryxWaitSet : public Iceoryx
+{
+  public:
+    IceoryxWaitSet(const iox::capro::IdString_t& publisherName,
+                   const iox::capro::IdString_t& subscriberName,
+                   const iox::units::Duration spinBudget) noexcept;
+
+  private:
+    PerfTopic receivePerfTopic() noexcept override;
+
+    iox::popo::WaitSet<1U> m_waitset;
+};
+
+#endif // IOX_EXAMPLES_ICEPERF_ICEORYX_WAITSET_HPP
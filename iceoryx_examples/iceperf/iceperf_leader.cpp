@@ -18,6 +18,7 @@
 #include "iceperf_leader.hpp"
 #include "iceoryx.hpp"
 #include "iceoryx_c.hpp"
+#include "iceoryx_waitset.hpp"
 #include "iceoryx_hoofs/cxx/convert.hpp"
 #include "iceoryx_posh/popo/publisher.hpp"
 #include "iceoryx_posh/popo/subscriber.hpp"
@@ -147,6 +148,14 @@ int IcePerfLeader::run() noexcept
         IceoryxC iceoryxc(PUBLISHER, SUBSCRIBER);
         doMeasurement(iceoryxc);
     }
+
+    if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_WAITSET)
+    {
+        std::cout << std::endl << "******  ICEORYX WAITSET   ********" << std::endl;
+        IceoryxWaitSet iceoryxWaitSet(
+            PUBLISHER, SUBSCRIBER, iox::units::Duration::fromNanoseconds(m_settings.spinBudgetInNanoseconds));
+        doMeasurement(iceoryxWaitSet);
+    }
     //! [create an run technologies]
 
     return EXIT_SUCCESS;
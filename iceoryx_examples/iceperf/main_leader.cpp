@@ -33,10 +33,11 @@ int main(int argc, char* argv[])
                                       {"benchmark", required_argument, nullptr, 'b'},
                                       {"technology", required_argument, nullptr, 't'},
                                       {"number-of-samples", required_argument, nullptr, 't'},
+                                      {"spin-budget", required_argument, nullptr, 's'},
                                       {nullptr, 0, nullptr, 0}};
 
     // colon after shortOption means it requires an argument, two colons mean optional argument
-    constexpr const char* shortOptions = "hb:t:n:";
+    constexpr const char* shortOptions = "hb:t:n:s:";
     int32_t index{0};
     int32_t opt{-1};
     while ((opt = getopt_long(argc, argv, shortOptions, longOptions, &index), opt != -1))
@@ -54,12 +55,18 @@ int main(int argc, char* argv[])
             std::cout << "                                  <TYPE> {all," << std::endl;
             std::cout << "                                          iceoryx-cpp-api," << std::endl;
             std::cout << "                                          iceoryx-c-api," << std::endl;
+            std::cout << "                                          iceoryx-waitset," << std::endl;
             std::cout << "                                          posix-message-queue," << std::endl;
             std::cout << "                                          unix-domain-sockets}" << std::endl;
             std::cout << "                                  default = 'all'" << std::endl;
             std::cout << "-n, --number-of-samples <N>       Set the number of samples sent in a benchmark round"
                       << std::endl;
             std::cout << "                                  default = '10000'" << std::endl;
+            std::cout << "-s, --spin-budget <US>            Set how many microseconds the WaitSet of the" << std::endl;
+            std::cout << "                                  'iceoryx-waitset' technology polls before it blocks"
+                      << std::endl;
+            std::cout << "                                  <US> {number of microseconds, poll}" << std::endl;
+            std::cout << "                                  'poll' never blocks, default = '0'" << std::endl;
 
             return EXIT_SUCCESS;
         case 'b':
@@ -94,6 +101,10 @@ int main(int argc, char* argv[])
             {
                 settings.technology = Technology::ICEORYX_C_API;
             }
+            else if (strcmp(optarg, "iceoryx-waitset") == 0)
+            {
+                settings.technology = Technology::ICEORYX_WAITSET;
+            }
             else if (strcmp(optarg, "posix-message-queue") == 0)
             {
                 settings.technology = Technology::POSIX_MESSAGE_QUEUE;
@@ -105,7 +116,7 @@ int main(int argc, char* argv[])
             else
             {
                 std::cerr << "Options for 'technology' are 'all', 'iceoryx-cpp-api', 'iceoryx-c-api', "
-                             "'posix-message-queue' and 'unix-domain-sockets'!"
+                             "'iceoryx-waitset', 'posix-message-queue' and 'unix-domain-sockets'!"
                           << std::endl;
                 return EXIT_FAILURE;
             }
@@ -117,6 +128,23 @@ int main(int argc, char* argv[])
                 return EXIT_FAILURE;
             }
             break;
+        case 's':
+            if (strcmp(optarg, "poll") == 0)
+            {
+                settings.spinBudgetInNanoseconds = iox::units::Duration::max().toNanoseconds();
+            }
+            else
+            {
+                uint64_t spinBudgetInMicroseconds{0U};
+                if (!iox::cxx::convert::fromString(optarg, spinBudgetInMicroseconds))
+                {
+                    std::cerr << "Could not parse 'spin-budget' paramater!" << std::endl;
+                    return EXIT_FAILURE;
+                }
+                settings.spinBudgetInNanoseconds =
+                    iox::units::Duration::fromMicroseconds(spinBudgetInMicroseconds).toNanoseconds();
+            }
+            break;
         default:
             return EXIT_FAILURE;
         };
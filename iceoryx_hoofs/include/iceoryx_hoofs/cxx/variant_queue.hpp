@@ -91,6 +91,13 @@ class VariantQueue
     ///         otherwise the optional contains nullopt_t
     optional<ValueType> pop() noexcept;
 
+    /// @brief pops up to maxNumberOfValues elements from the fifo, the SoFi variants do this with a single update of
+    ///        their read position
+    /// @param[out] valuesOut storage for the pop'ed values, must provide space for at least maxNumberOfValues elements
+    /// @param[in] maxNumberOfValues the maximum number of elements to pop
+    /// @return the number of pop'ed elements which were stored at the front of valuesOut
+    uint64_t popMany(ValueType* const valuesOut, const uint64_t maxNumberOfValues) noexcept;
+
     /// @brief returns true if empty otherwise true
     bool empty() const noexcept;
 
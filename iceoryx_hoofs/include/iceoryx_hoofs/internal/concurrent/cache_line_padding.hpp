@@ -0,0 +1,54 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_CONCURRENT_CACHE_LINE_PADDING_HPP
+#define IOX_HOOFS_CONCURRENT_CACHE_LINE_PADDING_HPP
+
+#include <cstdint>
+
+namespace iox
+{
+namespace concurrent
+{
+/// @brief the size of a cache line on the supported platforms
+constexpr uint64_t CACHE_LINE_SIZE{64U};
+
+/// @brief Separates the data members in front of it from the ones behind it by a whole cache line, therefore they
+/// never share a cache line whatever the address of the surrounding object is. In contrast to alignas it does not
+/// raise the alignment of the surrounding type, which would require over-aligned heap allocations that C++14 does
+/// not provide.
+struct CacheLinePadding
+{
+    // user-provided to not warn about an unused private member in classes which use the padding
+    CacheLinePadding() noexcept
+    {
+    }
+
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    uint8_t m_padding[CACHE_LINE_SIZE];
+};
+
+/// @brief checks that two data members never share a cache line
+/// @param[in] endOfFront the offset of the first byte behind the member in front
+/// @param[in] beginOfBack the offset of the member behind
+/// @return true if there is at least a cache line between the last byte of the front and the first byte of the back
+constexpr bool isSeparatedByCacheLine(const uint64_t endOfFront, const uint64_t beginOfBack) noexcept
+{
+    return beginOfBack >= endOfFront + CACHE_LINE_SIZE;
+}
+} // namespace concurrent
+} // namespace iox
+
+#endif // IOX_HOOFS_CONCURRENT_CACHE_LINE_PADDING_HPP
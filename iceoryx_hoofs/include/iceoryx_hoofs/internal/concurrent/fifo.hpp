@@ -18,8 +18,10 @@
 #define IOX_HOOFS_CONCURRENT_FIFO_HPP
 
 #include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/internal/concurrent/cache_line_padding.hpp"
 
 #include <atomic>
+#include <cstddef>
 
 namespace iox
 {
@@ -56,8 +58,22 @@ class FiFo
     // safe access is guaranteed since the char array is wrapped inside the FiFo class
     // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
     ValueType m_data[Capacity];
-    std::atomic<uint64_t> m_write_pos{0};
-    std::atomic<uint64_t> m_read_pos{0};
+
+    /// @brief the write position is written by the pusher and the read position by the pop'er, they are separated by
+    /// a cache line from each other and from the data in front of them
+    struct Positions
+    {
+        CacheLinePadding m_dataPadding;
+        std::atomic<uint64_t> m_write_pos{0};
+        CacheLinePadding m_writePositionPadding;
+        std::atomic<uint64_t> m_read_pos{0};
+    };
+    static_assert(isSeparatedByCacheLine(0U, offsetof(Positions, m_write_pos)),
+                  "the write position must not share a cache line with the data");
+    static_assert(isSeparatedByCacheLine(offsetof(Positions, m_write_pos) + sizeof(std::atomic<uint64_t>),
+                                         offsetof(Positions, m_read_pos)),
+                  "the write position must not share a cache line with the read position");
+    Positions m_positions;
 };
 
 } // namespace concurrent
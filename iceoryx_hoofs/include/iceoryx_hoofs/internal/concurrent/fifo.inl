@@ -30,27 +30,29 @@ inline bool FiFo<ValueType, Capacity>::push(const ValueType& value) noexcept
     {
         return false;
     }
-    auto currentWritePos = m_write_pos.load(std::memory_order_relaxed);
+    auto currentWritePos = m_positions.m_write_pos.load(std::memory_order_relaxed);
     m_data[currentWritePos % Capacity] = value;
 
     // m_write_pos must be increased after writing the new value otherwise
     // it is possible that the value is read by pop while it is written.
     // this fifo is a single producer, single consumer fifo therefore
     // store is allowed.
-    m_write_pos.store(currentWritePos + 1, std::memory_order_release);
+    m_positions.m_write_pos.store(currentWritePos + 1, std::memory_order_release);
     return true;
 }
 
 template <class ValueType, uint64_t Capacity>
 inline bool FiFo<ValueType, Capacity>::is_full() const noexcept
 {
-    return m_write_pos.load(std::memory_order_relaxed) == m_read_pos.load(std::memory_order_relaxed) + Capacity;
+    return m_positions.m_write_pos.load(std::memory_order_relaxed)
+           == m_positions.m_read_pos.load(std::memory_order_relaxed) + Capacity;
 }
 
 template <class ValueType, uint64_t Capacity>
 inline uint64_t FiFo<ValueType, Capacity>::size() const noexcept
 {
-    return m_write_pos.load(std::memory_order_relaxed) - m_read_pos.load(std::memory_order_relaxed);
+    return m_positions.m_write_pos.load(std::memory_order_relaxed)
+           - m_positions.m_read_pos.load(std::memory_order_relaxed);
 }
 
 template <class ValueType, uint64_t Capacity>
@@ -62,17 +64,18 @@ inline constexpr uint64_t FiFo<ValueType, Capacity>::capacity() noexcept
 template <class ValueType, uint64_t Capacity>
 inline bool FiFo<ValueType, Capacity>::empty() const noexcept
 {
-    return m_read_pos.load(std::memory_order_relaxed) == m_write_pos.load(std::memory_order_relaxed);
+    return m_positions.m_read_pos.load(std::memory_order_relaxed)
+           == m_positions.m_write_pos.load(std::memory_order_relaxed);
 }
 
 template <class ValueType, uint64_t Capacity>
 inline cxx::optional<ValueType> FiFo<ValueType, Capacity>::pop() noexcept
 {
-    auto currentReadPos = m_read_pos.load(std::memory_order_acquire);
+    auto currentReadPos = m_positions.m_read_pos.load(std::memory_order_acquire);
     bool isEmpty = (currentReadPos ==
                     // we are not allowed to use the empty method since we have to sync with
                     // the producer pop - this is done here
-                    m_write_pos.load(std::memory_order_acquire));
+                    m_positions.m_write_pos.load(std::memory_order_acquire));
     if (isEmpty)
     {
         return cxx::nullopt_t();
@@ -82,7 +85,7 @@ inline cxx::optional<ValueType> FiFo<ValueType, Capacity>::pop() noexcept
     // m_read_pos must be increased after reading the pop'ed value otherwise
     // it is possible that the pop'ed value is overwritten by push while it is read.
     // Implementing a single consumer fifo here allows us to use store.
-    m_read_pos.store(currentReadPos + 1, std::memory_order_release);
+    m_positions.m_read_pos.store(currentReadPos + 1, std::memory_order_release);
     return out;
 }
 } // namespace concurrent
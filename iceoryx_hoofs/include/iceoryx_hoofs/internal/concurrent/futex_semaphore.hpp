@@ -0,0 +1,113 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_CONCURRENT_FUTEX_SEMAPHORE_HPP
+#define IOX_HOOFS_CONCURRENT_FUTEX_SEMAPHORE_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/design_pattern/builder.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/semaphore_interface.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace concurrent
+{
+/// @brief A counting semaphore which is built on top of a futex and can be placed in shared memory. It offers the
+/// interface of posix::UnnamedSemaphore but a post only causes a syscall when a waiter is registered and a waiter
+/// spins shortly on the counter before it goes to sleep.
+/// @note Only usable when platform::IOX_SUPPORT_FUTEX is true, otherwise every call which would block fails.
+class FutexSemaphore
+{
+  public:
+    /// @brief number of times a waiter checks the counter before it registers itself and goes to sleep
+    static constexpr uint64_t SPIN_COUNT{128U};
+
+    FutexSemaphore(const FutexSemaphore&) = delete;
+    FutexSemaphore(FutexSemaphore&&) = delete;
+    FutexSemaphore& operator=(const FutexSemaphore&) = delete;
+    FutexSemaphore& operator=(FutexSemaphore&&) = delete;
+    ~FutexSemaphore() noexcept = default;
+
+    /// @brief Increments the semaphore by one and wakes up a waiter if there is one
+    /// @return Fails when the value of the semaphore overflows
+    cxx::expected<posix::SemaphoreError> post() noexcept;
+
+    /// @brief Decrements the semaphore by one. When the semaphore value is zero
+    ///        it blocks until the semaphore value is greater zero
+    /// @return Fails when the futex call fails
+    cxx::expected<posix::SemaphoreError> wait() noexcept;
+
+    /// @brief Tries to decrement the semaphore by one. When the semaphore value is zero
+    ///        it returns false otherwise it returns true and decrement the value by one.
+    /// @return Never fails, the expected is returned for interface compatibility with the posix semaphores
+    cxx::expected<bool, posix::SemaphoreError> tryWait() noexcept;
+
+    /// @brief Tries to decrement the semaphore by one. When the semaphore value is zero
+    ///        it waits until the timeout has passed.
+    /// @return If during the timeout time the semaphore value increases to non zero
+    ///         it returns SemaphoreWaitState::NO_TIMEOUT and decreases the semaphore by one
+    ///         otherwise returns SemaphoreWaitState::TIMEOUT
+    cxx::expected<posix::SemaphoreWaitState, posix::SemaphoreError>
+    timedWait(const units::Duration& timeout) noexcept;
+
+    /// @brief Sets the semaphore value to zero with a single atomic operation
+    void reset() noexcept;
+
+    /// @brief Forgets all registered waiters. Only intended for the cleanup of a waiter which died while it was
+    ///        registered, a waiter which is still sleeping is not woken up by a post anymore.
+    void resetWaiters() noexcept;
+
+  private:
+    friend class FutexSemaphoreBuilder;
+    friend class iox::cxx::optional<FutexSemaphore>;
+
+    explicit FutexSemaphore(const uint32_t initialValue) noexcept;
+
+    bool tryDecrement() noexcept;
+    bool spinAndTryDecrement() noexcept;
+    void unregisterWaiter() noexcept;
+    uint32_t* futexWord() noexcept;
+
+    /// @brief sleeps as long as the value is zero, a woken up waiter has to try to decrement the value again
+    /// @param[in] relativeTimeout nullptr to wait without timeout
+    cxx::expected<posix::SemaphoreError> waitWhileZero(const struct timespec* relativeTimeout) noexcept;
+
+  private:
+    std::atomic<uint32_t> m_value{0U};
+    std::atomic<uint32_t> m_numberOfWaiters{0U};
+};
+
+class FutexSemaphoreBuilder
+{
+    /// @brief Set the initial value of the futex semaphore
+    IOX_BUILDER_PARAMETER(uint32_t, initialValue, 0U)
+
+  public:
+    /// @brief create a futex semaphore, it is always inter process capable
+    /// @param[in] uninitializedSemaphore since the semaphore is not movable the user has to provide
+    ///            memory to store the semaphore into - packed in an optional
+    /// @return an error describing the failure or success
+    cxx::expected<posix::SemaphoreError> create(cxx::optional<FutexSemaphore>& uninitializedSemaphore) const noexcept;
+};
+
+} // namespace concurrent
+} // namespace iox
+
+#endif // IOX_HOOFS_CONCURRENT_FUTEX_SEMAPHORE_HPP
@@ -92,6 +92,18 @@ class LoFFLi
     /// @return true if index is valid or not yet pushed, false otherwise
     bool push(const Index_t index) noexcept;
 
+    /// Pops up to numberOfIndices values from the free-list with a single compare and swap of the head
+    /// @param [out] indices memory for at least numberOfIndices values, the popped values are stored at the front
+    /// @param [in] numberOfIndices the max number of values to pop
+    /// @return the number of popped values, 0 if the free-list is empty
+    uint32_t pop(cxx::not_null<Index_t*> indices, const uint32_t numberOfIndices) noexcept;
+
+    /// Pushes previously popped elements with a single compare and swap of the head
+    /// @param [in] indices the indices of previously popped elements
+    /// @param [in] numberOfIndices the number of indices
+    /// @return true if all indices are valid and not yet pushed, false otherwise; in that case none of them is pushed
+    bool push(cxx::not_null<const Index_t*> indices, const uint32_t numberOfIndices) noexcept;
+
     /// Calculates the required memory size for a free-list
     /// @param [in] capacity is the number of elements of the free-list
     /// @return the required memory size for a free-list with the requested capacity
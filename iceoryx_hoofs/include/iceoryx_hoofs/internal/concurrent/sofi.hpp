@@ -18,9 +18,12 @@
 #define IOX_HOOFS_CONCURRENT_SOFI_HPP
 
 #include "iceoryx_hoofs/cxx/type_traits.hpp"
+#include "iceoryx_hoofs/internal/concurrent/cache_line_padding.hpp"
 #include "iceoryx_platform/platform_correction.hpp"
 
+#include <algorithm>
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 
@@ -107,6 +110,14 @@ class SoFi
     /// @return false if sofi is empty, otherwise true
     bool pop(ValueType& valueOut) noexcept;
 
+    /// @brief pop up to maxNumberOfValues of the oldest elements with a single update of the read position
+    /// @param[out] valuesOut storage for the pop'ed values, must provide space for at least maxNumberOfValues elements
+    /// @param[in] maxNumberOfValues the maximum number of elements to pop
+    /// @concurrent restricted thread safe: single pop, single push no
+    ///             pop or popIf calls from multiple contexts
+    /// @return the number of pop'ed elements which were stored at the front of valuesOut
+    uint64_t popMany(ValueType* const valuesOut, const uint64_t maxNumberOfValues) noexcept;
+
     /// @brief conditional pop call to provide an alternative for a peek
     ///         and pop approach. If the verificator returns true the
     ///         peeked element is returned.
@@ -157,10 +168,23 @@ class SoFi
     ValueType m_data[INTERNAL_SOFI_SIZE];
     uint64_t m_size = INTERNAL_SOFI_SIZE;
 
-    /// @brief the write/read pointers are "atomic pointers" so that they are not
-    /// reordered (read or written too late)
-    std::atomic<uint64_t> m_readPosition{0};
-    std::atomic<uint64_t> m_writePosition{0};
+    /// @brief the read position is written by the consumer and the write position by the producer, they are
+    /// separated by a cache line from each other and from the data in front of them
+    struct Positions
+    {
+        CacheLinePadding m_dataPadding;
+        /// @brief the write/read pointers are "atomic pointers" so that they are not
+        /// reordered (read or written too late)
+        std::atomic<uint64_t> m_readPosition{0};
+        CacheLinePadding m_readPositionPadding;
+        std::atomic<uint64_t> m_writePosition{0};
+    };
+    static_assert(isSeparatedByCacheLine(0U, offsetof(Positions, m_readPosition)),
+                  "the read position must not share a cache line with the data");
+    static_assert(isSeparatedByCacheLine(offsetof(Positions, m_readPosition) + sizeof(std::atomic<uint64_t>),
+                                         offsetof(Positions, m_writePosition)),
+                  "the read position must not share a cache line with the write position");
+    Positions m_positions;
 };
 
 } // namespace concurrent
@@ -36,10 +36,10 @@ uint64_t SoFi<ValueType, CapacityValue>::size() const noexcept
     uint64_t writePosition{0};
     do
     {
-        readPosition = m_readPosition.load(std::memory_order_relaxed);
-        writePosition = m_writePosition.load(std::memory_order_relaxed);
-    } while (m_writePosition.load(std::memory_order_relaxed) != writePosition
-             || m_readPosition.load(std::memory_order_relaxed) != readPosition);
+        readPosition = m_positions.m_readPosition.load(std::memory_order_relaxed);
+        writePosition = m_positions.m_writePosition.load(std::memory_order_relaxed);
+    } while (m_positions.m_writePosition.load(std::memory_order_relaxed) != writePosition
+             || m_positions.m_readPosition.load(std::memory_order_relaxed) != readPosition);
 
     return writePosition - readPosition;
 }
@@ -52,8 +52,8 @@ bool SoFi<ValueType, CapacityValue>::setCapacity(const uint64_t newSize) noexcep
     {
         m_size = newInternalSize;
 
-        m_readPosition.store(0, std::memory_order_release);
-        m_writePosition.store(0, std::memory_order_release);
+        m_positions.m_readPosition.store(0, std::memory_order_release);
+        m_positions.m_writePosition.store(0, std::memory_order_release);
 
         return true;
     }
@@ -71,12 +71,12 @@ bool SoFi<ValueType, CapacityValue>::empty() const noexcept
     {
         /// @todo read before write since the writer increments the aba counter!!!
         /// @todo write doc with example!!!
-        currentReadPosition = m_readPosition.load(std::memory_order_acquire);
-        uint64_t currentWritePosition = m_writePosition.load(std::memory_order_acquire);
+        currentReadPosition = m_positions.m_readPosition.load(std::memory_order_acquire);
+        uint64_t currentWritePosition = m_positions.m_writePosition.load(std::memory_order_acquire);
 
         isEmpty = (currentWritePosition == currentReadPosition);
         // we need compare without exchange
-    } while (!(currentReadPosition == m_readPosition.load(std::memory_order_acquire)));
+    } while (!(currentReadPosition == m_positions.m_readPosition.load(std::memory_order_acquire)));
 
     return isEmpty;
 }
@@ -87,17 +87,43 @@ bool SoFi<ValueType, CapacityValue>::pop(ValueType& valueOut) noexcept
     return popIf(valueOut, [](ValueType) { return true; });
 }
 
+template <class ValueType, uint64_t CapacityValue>
+inline uint64_t SoFi<ValueType, CapacityValue>::popMany(ValueType* const valuesOut,
+                                                         const uint64_t maxNumberOfValues) noexcept
+{
+    uint64_t currentReadPosition = m_positions.m_readPosition.load(std::memory_order_acquire);
+    uint64_t numberOfValues{0U};
+
+    do
+    {
+        uint64_t currentWritePosition = m_positions.m_writePosition.load(std::memory_order_acquire);
+        numberOfValues = std::min(currentWritePosition - currentReadPosition, maxNumberOfValues);
+
+        // same reasoning as in popIf; if the push thread overwrote one of the copied values in the meantime it also
+        // moved the read position and the compare and swap fails, which discards the copies and starts over
+        for (uint64_t i = 0U; i < numberOfValues; ++i)
+        {
+            std::memcpy(&valuesOut[i], &m_data[(currentReadPosition + i) % m_size], sizeof(ValueType));
+        }
+    } while (!m_positions.m_readPosition.compare_exchange_weak(currentReadPosition,
+                                                               currentReadPosition + numberOfValues,
+                                                               std::memory_order_acq_rel,
+                                                               std::memory_order_acquire));
+
+    return numberOfValues;
+}
+
 template <class ValueType, uint64_t CapacityValue>
 template <typename Verificator_T>
 inline bool SoFi<ValueType, CapacityValue>::popIf(ValueType& valueOut, const Verificator_T& verificator) noexcept
 {
-    uint64_t currentReadPosition = m_readPosition.load(std::memory_order_acquire);
+    uint64_t currentReadPosition = m_positions.m_readPosition.load(std::memory_order_acquire);
     uint64_t nextReadPosition{0};
 
     bool popWasSuccessful{true};
     do
     {
-        if (currentReadPosition == m_writePosition.load(std::memory_order_acquire))
+        if (currentReadPosition == m_positions.m_writePosition.load(std::memory_order_acquire))
         {
             nextReadPosition = currentReadPosition;
             popWasSuccessful = false;
@@ -114,7 +140,8 @@ inline bool SoFi<ValueType, CapacityValue>::popIf(ValueType& valueOut, const Ver
             /// @brief first we need to peak valueOut if it is fitting the condition and then we have to verify
             ///        if valueOut is not am invalid object, this could be the case if the read position has
             ///        changed
-            if (m_readPosition.load(std::memory_order_relaxed) == currentReadPosition && !verificator(valueOut))
+            if (m_positions.m_readPosition.load(std::memory_order_relaxed) == currentReadPosition
+                && !verificator(valueOut))
             {
                 popWasSuccessful = false;
                 nextReadPosition = currentReadPosition;
@@ -132,7 +159,7 @@ inline bool SoFi<ValueType, CapacityValue>::popIf(ValueType& valueOut, const Ver
         // else
         //     currentReadPosition = m_readPosition
         // Assign m_aba_read_p to next readable location
-    } while (!m_readPosition.compare_exchange_weak(
+    } while (!m_positions.m_readPosition.compare_exchange_weak(
         currentReadPosition, nextReadPosition, std::memory_order_acq_rel, std::memory_order_acquire));
 
     return popWasSuccessful;
@@ -143,13 +170,13 @@ bool SoFi<ValueType, CapacityValue>::push(const ValueType& valueIn, ValueType& v
 {
     constexpr bool SOFI_OVERFLOW{false};
 
-    uint64_t currentWritePosition = m_writePosition.load(std::memory_order_relaxed);
+    uint64_t currentWritePosition = m_positions.m_writePosition.load(std::memory_order_relaxed);
     uint64_t nextWritePosition = currentWritePosition + 1U;
 
     m_data[currentWritePosition % m_size] = valueIn;
-    m_writePosition.store(nextWritePosition, std::memory_order_release);
+    m_positions.m_writePosition.store(nextWritePosition, std::memory_order_release);
 
-    uint64_t currentReadPosition = m_readPosition.load(std::memory_order_acquire);
+    uint64_t currentReadPosition = m_positions.m_readPosition.load(std::memory_order_acquire);
 
     // check if there is a free position for the next push
     if (nextWritePosition < currentReadPosition + m_size)
@@ -176,7 +203,7 @@ bool SoFi<ValueType, CapacityValue>::push(const ValueType& valueIn, ValueType& v
     //     synchronization, then the memory also needs to be synchronized for the overflow case
     // memory order failure is memory_order_relaxed since there is no further synchronization needed if there is no
     // overflow
-    if (m_readPosition.compare_exchange_strong(
+    if (m_positions.m_readPosition.compare_exchange_strong(
             currentReadPosition, nextReadPosition, std::memory_order_acq_rel, std::memory_order_relaxed))
     {
         std::memcpy(&valueOut, &m_data[currentReadPosition % m_size], sizeof(ValueType));
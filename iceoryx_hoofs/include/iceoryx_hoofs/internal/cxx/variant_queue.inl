@@ -122,6 +122,31 @@ inline optional<ValueType> VariantQueue<ValueType, Capacity>::pop() noexcept
     return cxx::nullopt;
 }
 
+template <typename ValueType, uint64_t Capacity>
+inline uint64_t VariantQueue<ValueType, Capacity>::popMany(ValueType* const valuesOut,
+                                                           const uint64_t maxNumberOfValues) noexcept
+{
+    if (m_type == VariantQueueTypes::SoFi_SingleProducerSingleConsumer)
+    {
+        return m_fifo
+            .template get_at_index<static_cast<uint64_t>(VariantQueueTypes::SoFi_SingleProducerSingleConsumer)>()
+            ->popMany(valuesOut, maxNumberOfValues);
+    }
+
+    uint64_t numberOfValues{0U};
+    while (numberOfValues < maxNumberOfValues)
+    {
+        auto value = pop();
+        if (!value.has_value())
+        {
+            break;
+        }
+        valuesOut[numberOfValues] = value.value();
+        ++numberOfValues;
+    }
+    return numberOfValues;
+}
+
 template <typename ValueType, uint64_t Capacity>
 inline bool VariantQueue<ValueType, Capacity>::empty() const noexcept
 {
@@ -22,6 +22,8 @@
 #include "iceoryx_hoofs/design_pattern/builder.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/memory_map.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/numa_policy.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/prefault_strategy.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/shared_memory.hpp"
 #include "iceoryx_platform/stat.hpp"
 
@@ -37,6 +39,8 @@ enum class SharedMemoryObjectError
 {
     SHARED_MEMORY_CREATION_FAILED,
     MAPPING_SHARED_MEMORY_FAILED,
+    PREFAULTING_SHARED_MEMORY_FAILED,
+    LOCKING_SHARED_MEMORY_FAILED,
     INTERNAL_LOGIC_FAILURE,
 };
 
@@ -88,6 +92,12 @@ class SharedMemoryObject
     ///        existing shared memory was opened.
     bool hasOwnership() const noexcept;
 
+    /// @brief Locks the mapped shared memory in RAM, all its pages are faulted in and are never
+    ///        paged out while it is mapped. The amount of memory a process can lock is limited
+    ///        by RLIMIT_MEMLOCK unless it has the CAP_IPC_LOCK capability.
+    /// @return LOCKING_SHARED_MEMORY_FAILED if the memory could not be locked, the reason is logged
+    cxx::expected<SharedMemoryObjectError> lockInMemory() noexcept;
+
 
     friend class SharedMemoryObjectBuilder;
 
@@ -131,6 +141,22 @@ class SharedMemoryObjectBuilder
     /// @brief Defines the access permissions of the shared memory
     IOX_BUILDER_PARAMETER(cxx::perms, permissions, cxx::perms::none)
 
+    /// @brief If set the shared memory is a file in this directory, e.g. the mount point of a
+    ///        hugetlbfs to back it with huge pages, otherwise it is created with shm_open.
+    ///        See SharedMemoryBuilder::directory.
+    IOX_BUILDER_PARAMETER(SharedMemory::Directory_t, directory, "")
+
+    /// @brief Defines on which NUMA nodes the pages of a newly created shared memory are placed.
+    ///        It is applied before the memory is zeroed, if the policy cannot be applied the pages
+    ///        are placed by first touch and a warning is printed. An opened shared memory keeps the
+    ///        placement of its creator.
+    IOX_BUILDER_PARAMETER(NumaPolicy, numaPolicy, NumaPolicy())
+
+    /// @brief Defines how the pages of a newly created shared memory are faulted in, an opened
+    ///        shared memory is never touched. On platforms which do not zero the memory on
+    ///        creation it is always PrefaultStrategy::LAZY.
+    IOX_BUILDER_PARAMETER(PrefaultStrategy, prefaultStrategy, PrefaultStrategy::ZERO)
+
   public:
     cxx::expected<SharedMemoryObject, SharedMemoryObjectError> create() noexcept;
 };
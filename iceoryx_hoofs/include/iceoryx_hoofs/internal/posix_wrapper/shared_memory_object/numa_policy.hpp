@@ -0,0 +1,70 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_POSIX_WRAPPER_SHARED_MEMORY_OBJECT_NUMA_POLICY_HPP
+#define IOX_HOOFS_POSIX_WRAPPER_SHARED_MEMORY_OBJECT_NUMA_POLICY_HPP
+
+#include <cstdint>
+
+namespace iox
+{
+namespace posix
+{
+/// @brief Defines on which NUMA nodes the pages of a memory region are placed. The policy is applied before the pages
+///        are touched for the first time, afterwards it has no effect on pages which are already placed.
+struct NumaPolicy
+{
+    enum class Mode : uint8_t
+    {
+        /// @brief a page is placed on the node of the thread which touches it first
+        DEFAULT,
+        /// @brief the pages are placed only on the nodes of the node mask
+        BIND,
+        /// @brief the pages are placed on the first node of the node mask as long as it has free memory
+        PREFERRED,
+        /// @brief the pages are distributed round robin over the nodes of the node mask
+        INTERLEAVE
+    };
+
+    /// @brief the max number of NUMA nodes which can be selected with the node mask
+    static constexpr uint64_t MAX_NUMBER_OF_NODES{64U};
+
+    Mode mode{Mode::DEFAULT};
+    /// @brief bit n selects the NUMA node n
+    uint64_t nodeMask{0U};
+};
+
+/// @brief converts the NumaPolicy::Mode into a string literal
+/// @param[in] mode the mode which should be converted
+/// @return string literal of the mode
+inline constexpr const char* asStringLiteral(const NumaPolicy::Mode mode) noexcept
+{
+    switch (mode)
+    {
+    case NumaPolicy::Mode::BIND:
+        return "NumaPolicy::Mode::BIND";
+    case NumaPolicy::Mode::PREFERRED:
+        return "NumaPolicy::Mode::PREFERRED";
+    case NumaPolicy::Mode::INTERLEAVE:
+        return "NumaPolicy::Mode::INTERLEAVE";
+    case NumaPolicy::Mode::DEFAULT:
+        break;
+    }
+    return "NumaPolicy::Mode::DEFAULT";
+}
+} // namespace posix
+} // namespace iox
+
+#endif // IOX_HOOFS_POSIX_WRAPPER_SHARED_MEMORY_OBJECT_NUMA_POLICY_HPP
@@ -0,0 +1,64 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_POSIX_WRAPPER_SHARED_MEMORY_OBJECT_PREFAULT_STRATEGY_HPP
+#define IOX_HOOFS_POSIX_WRAPPER_SHARED_MEMORY_OBJECT_PREFAULT_STRATEGY_HPP
+
+#include <cstdint>
+
+namespace iox
+{
+namespace posix
+{
+/// @brief Defines how the pages of a newly created shared memory are faulted in. The kernel provides zeroed pages
+///        for a new shared memory, therefore every strategy results in zeroed memory, they differ only in when the
+///        page faults happen and how a lack of memory is detected.
+enum class PrefaultStrategy : uint8_t
+{
+    /// @brief the memory is zeroed with memset by the creating thread, when not enough memory is available the
+    ///        process is terminated with an error message
+    ZERO,
+    /// @brief like ZERO but the memory is split into parts which are zeroed by multiple threads
+    PARALLEL_ZERO,
+    /// @brief the kernel faults in all pages with one call without writing to them, when this is not supported the
+    ///        memory is zeroed like with ZERO; when not enough memory is available the creation fails
+    POPULATE,
+    /// @brief the pages are faulted in when they are touched for the first time, the creation is fast but the first
+    ///        access of a page is slow and a lack of memory is only detected with a SIGBUS on this access
+    LAZY
+};
+
+/// @brief converts the PrefaultStrategy into a string literal
+/// @param[in] strategy the strategy which should be converted
+/// @return string literal of the strategy
+inline constexpr const char* asStringLiteral(const PrefaultStrategy strategy) noexcept
+{
+    switch (strategy)
+    {
+    case PrefaultStrategy::ZERO:
+        return "PrefaultStrategy::ZERO";
+    case PrefaultStrategy::PARALLEL_ZERO:
+        return "PrefaultStrategy::PARALLEL_ZERO";
+    case PrefaultStrategy::POPULATE:
+        return "PrefaultStrategy::POPULATE";
+    case PrefaultStrategy::LAZY:
+        break;
+    }
+    return "PrefaultStrategy::LAZY";
+}
+} // namespace posix
+} // namespace iox
+
+#endif // IOX_HOOFS_POSIX_WRAPPER_SHARED_MEMORY_OBJECT_PREFAULT_STRATEGY_HPP
@@ -53,13 +53,16 @@ enum class SharedMemoryError
 /// @brief Creates a bare metal shared memory object with the posix functions
 ///        shm_open, shm_unlink etc.
 ///        It must be used in combination with MemoryMap (or manual mmap calls)
-///        to gain access to the created/opened shared memory
+///        to gain access to the created/opened shared memory.
+///        When a directory is set the shared memory is a file in this directory instead,
+///        e.g. in a hugetlbfs mount point to back the shared memory with huge pages.
 class SharedMemory
 {
   public:
     static constexpr uint64_t NAME_SIZE = platform::IOX_MAX_SHM_NAME_LENGTH;
     static constexpr int INVALID_HANDLE = -1;
     using Name_t = cxx::string<NAME_SIZE>;
+    using Directory_t = cxx::string<platform::IOX_MAX_PATH_LENGTH>;
 
     SharedMemory(const SharedMemory&) = delete;
     SharedMemory& operator=(const SharedMemory&) = delete;
@@ -79,14 +82,16 @@ class SharedMemory
 
     /// @brief removes shared memory with a given name from the system
     /// @param[in] name name of the shared memory
+    /// @param[in] directory the directory of the shared memory, empty if it was created with shm_open
     /// @return true if the shared memory was removed, false if the shared memory did not exist and
     ///         SharedMemoryError when the underlying shm_unlink call failed.
-    static cxx::expected<bool, SharedMemoryError> unlinkIfExist(const Name_t& name) noexcept;
+    static cxx::expected<bool, SharedMemoryError> unlinkIfExist(const Name_t& name,
+                                                               const Directory_t& directory = Directory_t()) noexcept;
 
     friend class SharedMemoryBuilder;
 
   private:
-    SharedMemory(const Name_t& name, const int handle, const bool hasOwnership) noexcept;
+    SharedMemory(const Name_t& name, const Directory_t& directory, const int handle, const bool hasOwnership) noexcept;
 
     bool unlink() noexcept;
     bool close() noexcept;
@@ -96,6 +101,7 @@ class SharedMemory
     static SharedMemoryError errnoToEnum(const int32_t errnum) noexcept;
 
     Name_t m_name;
+    Directory_t m_directory;
     int m_handle{INVALID_HANDLE};
     bool m_hasOwnership{false};
 };
@@ -120,6 +126,12 @@ class SharedMemoryBuilder
     /// @brief Defines the size of the shared memory
     IOX_BUILDER_PARAMETER(uint64_t, size, 0U)
 
+    /// @brief If set the shared memory is created as file in this directory instead of with shm_open.
+    ///        With the mount point of a hugetlbfs the shared memory is backed by huge pages, the size
+    ///        must then be a multiple of the huge page size of the mount. All users of the shared
+    ///        memory must use the same directory.
+    IOX_BUILDER_PARAMETER(SharedMemory::Directory_t, directory, "")
+
   public:
     /// @brief creates a valid SharedMemory object. If the construction failed the expected
     ///        contains an enum value describing the error.
@@ -21,6 +21,7 @@
 #include "iceoryx_hoofs/cxx/newtype.hpp"
 #include "iceoryx_hoofs/internal/relocatable_pointer/pointer_repository.hpp"
 
+#include <atomic>
 #include <cstdint>
 
 namespace iox
@@ -66,6 +67,8 @@ class BaseRelativePointer
     using ptr_t = void*;
     using const_ptr_t = const void* const;
     using offset_t = std::uintptr_t;
+    /// @brief a function which is called with the id of a segment which is not registered
+    using UnregisteredSegmentHandler_t = void (*)(const id_underlying_t id);
 
     /// @brief constructs a BaseRelativePointer pointing to the same pointee as ptr in a segment identified by id
     /// @param[in] ptr the pointer whose pointee shall be the same for this
@@ -141,8 +144,18 @@ class BaseRelativePointer
     /// @brief get the base ptr associated with the given id
     /// @param[in] id is the id of the segment
     /// @return ptr registered at the given id, nullptr if none was registered
+    /// @note if a valid id is not registered the UnregisteredSegmentHandler_t is called before the lookup is repeated
     static ptr_t getBasePtr(const id_t id) noexcept;
 
+    /// @brief sets the function which is called when a pointer into a segment which is not registered is resolved, it
+    /// can register the segment, e.g. a segment which was created after this process registered the others
+    /// @param[in] handler is called concurrently by all threads which resolve such a pointer, nullptr removes it
+    /// @attention the handler runs inside of every RelativePointer::get() and getBasePtr() of an unregistered id. The
+    /// handler of the posh runtime opens, maps and optionally locks the shared memory of the segment there, i.e. such
+    /// a call can block on shm_open, mmap and mlock and a failure ends in the fatal error handler. The handler must
+    /// serialize its registrations, the lookups of the other threads are safe while it registers the segment.
+    static void setUnregisteredSegmentHandler(const UnregisteredSegmentHandler_t handler) noexcept;
+
     /// @brief unregisters all ptr id pairs (leads to initial state)
     static void unregisterAll() noexcept;
 
@@ -192,6 +205,11 @@ class BaseRelativePointer
     id_underlying_t m_id{NULL_POINTER_ID};
     offset_t m_offset{NULL_POINTER_OFFSET};
     // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+
+  private:
+    /// @brief returns the function which is called for segments which are not registered
+    /// @return the UnregisteredSegmentHandler_t, it is nullptr if none is set
+    static std::atomic<UnregisteredSegmentHandler_t>& getUnregisteredSegmentHandler() noexcept;
 };
 } // namespace rp
 } // namespace iox
@@ -21,6 +21,7 @@
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include <iostream>
 
+#include <atomic>
 #include <cassert>
 #include <limits>
 
@@ -35,14 +36,18 @@ constexpr uint64_t MAX_POINTER_REPO_CAPACITY{10000U};
 /// Up to CAPACITY segments can be registered with MIN_ID = 1 to MAX_ID = CAPACITY - 1
 /// id 0 is reserved and allows relative pointers to behave like normal pointers
 /// (which is equivalent to measure the offset relative to 0).
+/// The lookups are safe while another thread registers a segment, i.e. a segment can be mapped on demand while the
+/// other threads resolve relative pointers. Registrations and unregistrations must not run concurrently.
 template <typename id_t, typename ptr_t, uint64_t CAPACITY = MAX_POINTER_REPO_CAPACITY>
 class PointerRepository
 {
   private:
+    /// @brief endPtr is stored before basePtr is published with release semantics, a reader which sees the basePtr
+    /// with acquire semantics therefore sees the matching endPtr
     struct Info
     {
-        ptr_t basePtr{nullptr};
-        ptr_t endPtr{nullptr};
+        std::atomic<ptr_t> basePtr{nullptr};
+        std::atomic<ptr_t> endPtr{nullptr};
     };
 
     /// @note 0 is a special purpose id and reserved
@@ -102,14 +107,15 @@ class PointerRepository
     void print() const noexcept;
 
   private:
-    /// @todo: if required protect vector against concurrent modification
-    /// whether this is required depends on the use case, we currently do not need it
+    /// @brief stores the base pointer and the end pointer of a segment and publishes it for the lookups
+    void storeSegment(const id_t id, const ptr_t ptr, const uint64_t size) noexcept;
+
     /// we control the ids, so if they are consecutive we only need a vector/array to get the address
     /// this variable exists once per application using relative pointers,
     /// and each needs to initialize it via register calls above
 
     iox::cxx::vector<Info, CAPACITY> m_info;
-    uint64_t m_maxRegistered{0U};
+    std::atomic<uint64_t> m_maxRegistered{0U};
 };
 } // namespace rp
 } // namespace iox
@@ -0,0 +1,211 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/concurrent/futex_semaphore.hpp"
+#include "iceoryx_hoofs/cxx/deadline_timer.hpp"
+#include "iceoryx_hoofs/internal/log/hoofs_logging.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
+#include "iceoryx_platform/futex.hpp"
+#include "iceoryx_platform/semaphore.hpp"
+
+namespace iox
+{
+namespace concurrent
+{
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "The futex word must be a plain 32 bit integer!");
+
+constexpr uint64_t FutexSemaphore::SPIN_COUNT;
+
+cxx::expected<posix::SemaphoreError>
+FutexSemaphoreBuilder::create(cxx::optional<FutexSemaphore>& uninitializedSemaphore) const noexcept
+{
+    if (m_initialValue > IOX_SEM_VALUE_MAX)
+    {
+        LogError() << "The futex semaphore initial value of " << m_initialValue
+                   << " exceeds the maximum semaphore value " << IOX_SEM_VALUE_MAX;
+        return cxx::error<posix::SemaphoreError>(posix::SemaphoreError::SEMAPHORE_OVERFLOW);
+    }
+
+    uninitializedSemaphore.emplace(m_initialValue);
+    return cxx::success<>();
+}
+
+FutexSemaphore::FutexSemaphore(const uint32_t initialValue) noexcept
+    : m_value(initialValue)
+{
+}
+
+cxx::expected<posix::SemaphoreError> FutexSemaphore::post() noexcept
+{
+    uint32_t value = m_value.load(std::memory_order_relaxed);
+    do
+    {
+        if (value >= IOX_SEM_VALUE_MAX)
+        {
+            LogError() << "Semaphore overflow. The maximum value of " << IOX_SEM_VALUE_MAX << " would be exceeded.";
+            return cxx::error<posix::SemaphoreError>(posix::SemaphoreError::SEMAPHORE_OVERFLOW);
+        }
+    } while (!m_value.compare_exchange_weak(value, value + 1U, std::memory_order_seq_cst, std::memory_order_relaxed));
+
+    // a waiter registers itself before it checks the value for the last time, therefore either it sees the
+    // incremented value or we see the waiter
+    if (m_numberOfWaiters.load(std::memory_order_seq_cst) == 0U)
+    {
+        return cxx::success<>();
+    }
+
+    if (posix::posixCall(iox_futex_wake)(futexWord(), 1).failureReturnValue(-1).evaluate().has_error())
+    {
+        LogError() << "Unable to wake up a waiter of the futex semaphore.";
+        return cxx::error<posix::SemaphoreError>(posix::SemaphoreError::UNDEFINED);
+    }
+
+    return cxx::success<>();
+}
+
+cxx::expected<posix::SemaphoreError> FutexSemaphore::wait() noexcept
+{
+    if (spinAndTryDecrement())
+    {
+        return cxx::success<>();
+    }
+
+    m_numberOfWaiters.fetch_add(1U, std::memory_order_seq_cst);
+    cxx::expected<posix::SemaphoreError> result = cxx::success<>();
+    while (!tryDecrement())
+    {
+        result = waitWhileZero(nullptr);
+        if (result.has_error())
+        {
+            break;
+        }
+    }
+    unregisterWaiter();
+
+    return result;
+}
+
+cxx::expected<bool, posix::SemaphoreError> FutexSemaphore::tryWait() noexcept
+{
+    return cxx::success<bool>(tryDecrement());
+}
+
+cxx::expected<posix::SemaphoreWaitState, posix::SemaphoreError>
+FutexSemaphore::timedWait(const units::Duration& timeout) noexcept
+{
+    if (spinAndTryDecrement())
+    {
+        return cxx::success<posix::SemaphoreWaitState>(posix::SemaphoreWaitState::NO_TIMEOUT);
+    }
+
+    cxx::DeadlineTimer deadline(timeout);
+
+    m_numberOfWaiters.fetch_add(1U, std::memory_order_seq_cst);
+    cxx::expected<posix::SemaphoreWaitState, posix::SemaphoreError> result =
+        cxx::success<posix::SemaphoreWaitState>(posix::SemaphoreWaitState::NO_TIMEOUT);
+    while (!tryDecrement())
+    {
+        if (deadline.hasExpired())
+        {
+            result = cxx::success<posix::SemaphoreWaitState>(posix::SemaphoreWaitState::TIMEOUT);
+            break;
+        }
+
+        // FUTEX_WAIT measures the relative timeout like the DeadlineTimer against the monotonic clock
+        const struct timespec relativeTimeout = deadline.remainingTime().timespec();
+        auto waitResult = waitWhileZero(&relativeTimeout);
+        if (waitResult.has_error())
+        {
+            result = cxx::error<posix::SemaphoreError>(waitResult.get_error());
+            break;
+        }
+    }
+    unregisterWaiter();
+
+    return result;
+}
+
+void FutexSemaphore::reset() noexcept
+{
+    m_value.exchange(0U, std::memory_order_acquire);
+}
+
+void FutexSemaphore::resetWaiters() noexcept
+{
+    m_numberOfWaiters.store(0U, std::memory_order_seq_cst);
+}
+
+void FutexSemaphore::unregisterWaiter() noexcept
+{
+    // the registration is gone when the waiters were reset in between, the counter must not wrap around then
+    uint32_t numberOfWaiters = m_numberOfWaiters.load(std::memory_order_relaxed);
+    while (numberOfWaiters > 0U
+           && !m_numberOfWaiters.compare_exchange_weak(
+               numberOfWaiters, numberOfWaiters - 1U, std::memory_order_relaxed, std::memory_order_relaxed))
+    {
+    }
+}
+
+bool FutexSemaphore::tryDecrement() noexcept
+{
+    uint32_t value = m_value.load(std::memory_order_seq_cst);
+    while (value > 0U)
+    {
+        if (m_value.compare_exchange_weak(value, value - 1U, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FutexSemaphore::spinAndTryDecrement() noexcept
+{
+    for (uint64_t i = 0U; i < SPIN_COUNT; ++i)
+    {
+        if (tryDecrement())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+cxx::expected<posix::SemaphoreError> FutexSemaphore::waitWhileZero(const struct timespec* relativeTimeout) noexcept
+{
+    // a post between our last check and the syscall changes the futex word and the kernel returns with EAGAIN
+    auto result = posix::posixCall(iox_futex_wait)(futexWord(), 0U, relativeTimeout)
+                      .failureReturnValue(-1)
+                      .ignoreErrnos(EAGAIN, EINTR, ETIMEDOUT)
+                      .evaluate();
+    if (result.has_error())
+    {
+        LogError() << "Unable to wait on the futex semaphore.";
+        return cxx::error<posix::SemaphoreError>(posix::SemaphoreError::UNDEFINED);
+    }
+
+    return cxx::success<>();
+}
+
+uint32_t* FutexSemaphore::futexWord() noexcept
+{
+    // NOLINTJUSTIFICATION the futex syscall operates on a plain 32 bit integer, the size is checked at compile time
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return reinterpret_cast<uint32_t*>(&m_value);
+}
+
+} // namespace concurrent
+} // namespace iox
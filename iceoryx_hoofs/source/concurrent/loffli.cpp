@@ -110,5 +110,99 @@ bool LoFFLi::push(const Index_t index) noexcept
     return true;
 }
 
+uint32_t LoFFLi::pop(cxx::not_null<Index_t*> indices, const uint32_t numberOfIndices) noexcept
+{
+    Index_t* const poppedIndices = indices;
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+    uint32_t numberOfPoppedIndices{0U};
+
+    do
+    {
+        // the chain is only valid when the head did not change in the meantime, the aba counter ensures that the
+        // compare and swap fails otherwise
+        numberOfPoppedIndices = 0U;
+        Index_t nextIndex = oldHead.indexToNextFreeIndex;
+        while (numberOfPoppedIndices < numberOfIndices && nextIndex < m_size)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) limited by numberOfIndices
+            poppedIndices[numberOfPoppedIndices] = nextIndex;
+            ++numberOfPoppedIndices;
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit of index set by m_size
+            nextIndex = m_nextFreeIndex.get()[nextIndex];
+        }
+
+        if (numberOfPoppedIndices == 0U)
+        {
+            return 0U;
+        }
+
+        newHead.indexToNextFreeIndex = nextIndex;
+        newHead.abaCounter += 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    for (uint32_t i = 0U; i < numberOfPoppedIndices; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) the indices were popped from the list
+        m_nextFreeIndex.get()[poppedIndices[i]] = m_invalidIndex;
+    }
+
+    /// we need to synchronize m_nextFreeIndex with push so that we can perform a validation
+    /// check right before push to avoid double free's
+    std::atomic_thread_fence(std::memory_order_release);
+
+    return numberOfPoppedIndices;
+}
+
+bool LoFFLi::push(cxx::not_null<const Index_t*> indices, const uint32_t numberOfIndices) noexcept
+{
+    const Index_t* const pushedIndices = indices;
+    if (numberOfIndices == 0U)
+    {
+        return true;
+    }
+
+    /// we synchronize with m_nextFreeIndex in pop to perform the validity check
+    std::atomic_thread_fence(std::memory_order_release);
+
+    // the indices are linked to a chain while they are validated, an index which occurs twice is therefore detected
+    // since it is not marked as invalid anymore
+    for (uint32_t i = 0U; i < numberOfIndices; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) limited by numberOfIndices
+        const Index_t index = pushedIndices[i];
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is limited by capacity
+        if (index >= m_size || m_nextFreeIndex.get()[index] != m_invalidIndex)
+        {
+            for (uint32_t j = 0U; j < i; ++j)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) already validated indices
+                m_nextFreeIndex.get()[pushedIndices[j]] = m_invalidIndex;
+            }
+            return false;
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is limited by capacity
+        m_nextFreeIndex.get()[index] = (i + 1U < numberOfIndices) ? pushedIndices[i + 1U] : m_size;
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) limited by numberOfIndices
+    const Index_t firstIndex = pushedIndices[0U];
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) limited by numberOfIndices
+    const Index_t lastIndex = pushedIndices[numberOfIndices - 1U];
+
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+
+    do
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is limited by capacity
+        m_nextFreeIndex.get()[lastIndex] = oldHead.indexToNextFreeIndex;
+        newHead.indexToNextFreeIndex = firstIndex;
+        newHead.abaCounter += 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    return true;
+}
+
 } // namespace concurrent
 } // namespace iox
@@ -18,24 +18,37 @@
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
 #include "iceoryx_hoofs/cxx/attributes.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/system_configuration.hpp"
 #include "iceoryx_hoofs/log/logging.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
 #include "iceoryx_hoofs/posix_wrapper/signal_handler.hpp"
 #include "iceoryx_hoofs/posix_wrapper/types.hpp"
 #include "iceoryx_platform/fcntl.hpp"
+#include "iceoryx_platform/mman.hpp"
+#include "iceoryx_platform/resource.hpp"
 #include "iceoryx_platform/unistd.hpp"
 
+#include <algorithm>
 #include <bitset>
+#include <cerrno>
+#include <chrono>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
 #include <mutex>
+#include <thread>
 
 namespace iox
 {
 namespace posix
 {
 constexpr const void* const SharedMemoryObject::NO_ADDRESS_HINT;
+constexpr uint64_t NumaPolicy::MAX_NUMBER_OF_NODES;
 constexpr uint64_t SIGBUS_ERROR_MESSAGE_LENGTH = 1024U + platform::IOX_MAX_SHM_NAME_LENGTH;
+/// @brief smaller parts are zeroed faster than a thread is started
+constexpr uint64_t MIN_BYTES_PER_PREFAULT_THREAD{32U * 1024U * 1024U};
+constexpr uint64_t MAX_NUMBER_OF_PREFAULT_THREADS{16U};
 
 /// NOLINTJUSTIFICATION global variables are only accessible from within this compilation unit
 /// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
@@ -54,6 +67,100 @@ static void memsetSigbusHandler(int) noexcept
     _exit(EXIT_FAILURE);
 }
 
+static int toMemoryPolicy(const NumaPolicy::Mode mode) noexcept
+{
+    switch (mode)
+    {
+    case NumaPolicy::Mode::BIND:
+        return MPOL_BIND;
+    case NumaPolicy::Mode::PREFERRED:
+        return MPOL_PREFERRED;
+    case NumaPolicy::Mode::INTERLEAVE:
+        return MPOL_INTERLEAVE;
+    case NumaPolicy::Mode::DEFAULT:
+        break;
+    }
+    return MPOL_DEFAULT;
+}
+
+/// @brief applies the NUMA policy to memory which was not yet touched, a failure is not fatal since the memory is
+///        still usable, only its placement is left to the kernel
+static void applyNumaPolicy(void* const baseAddress,
+                            const uint64_t sizeInBytes,
+                            const NumaPolicy& policy,
+                            const SharedMemory::Name_t& name) noexcept
+{
+    constexpr uint64_t BITS_PER_LONG{sizeof(unsigned long) * 8U};
+    constexpr uint64_t NODE_MASK_LENGTH{NumaPolicy::MAX_NUMBER_OF_NODES / BITS_PER_LONG};
+    // NOLINTJUSTIFICATION the kernel expects the node mask as array of unsigned long
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    unsigned long nodeMask[NODE_MASK_LENGTH];
+    for (uint64_t i = 0U; i < NODE_MASK_LENGTH; ++i)
+    {
+        const uint64_t nodeMaskWord{policy.nodeMask >> (i * BITS_PER_LONG)};
+        nodeMask[i] = static_cast<unsigned long>(nodeMaskWord);
+    }
+
+    // the kernel considers only maxnode - 1 bits of the node mask
+    constexpr uint64_t MAX_NODE{NumaPolicy::MAX_NUMBER_OF_NODES + 1U};
+    posixCall(iox_mbind)(baseAddress,
+                         static_cast<unsigned long>(sizeInBytes),
+                         toMemoryPolicy(policy.mode),
+                         &nodeMask[0],
+                         static_cast<unsigned long>(MAX_NODE),
+                         0U)
+        .failureReturnValue(-1)
+        .evaluate()
+        .and_then([&](auto&) {
+            LogDebug() << "Applied " << asStringLiteral(policy.mode) << " with node mask "
+                       << iox::log::hex(policy.nodeMask) << " to the shared memory [" << name << "]";
+        })
+        .or_else([&](auto& r) {
+            LogWarn() << "Unable to apply " << asStringLiteral(policy.mode) << " with node mask "
+                      << iox::log::hex(policy.nodeMask) << " to the shared memory [" << name << "] since \""
+                      << r.getHumanReadableErrnum() << "\", the pages are placed on the node which touches them first";
+        });
+}
+
+/// @brief zeroes the memory with up to one thread per core, every thread zeroes whole pages so that no page is
+///        faulted in by two threads
+static void zeroInParallel(void* const baseAddress, const uint64_t sizeInBytes) noexcept
+{
+    const uint64_t numberOfThreads =
+        std::max<uint64_t>(1U,
+                           std::min({MAX_NUMBER_OF_PREFAULT_THREADS,
+                                     static_cast<uint64_t>(std::thread::hardware_concurrency()),
+                                     sizeInBytes / MIN_BYTES_PER_PREFAULT_THREAD}));
+    const uint64_t bytesPerThread =
+        cxx::align((sizeInBytes + numberOfThreads - 1U) / numberOfThreads, posix::pageSize());
+
+    auto zeroPart = [=](const uint64_t part) {
+        const uint64_t offset = std::min(part * bytesPerThread, sizeInBytes);
+        const uint64_t length = std::min(bytesPerThread, sizeInBytes - offset);
+        // NOLINTJUSTIFICATION the parts are within the memory of sizeInBytes
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        memset(static_cast<uint8_t*>(baseAddress) + offset, 0, length);
+    };
+
+    // the calling thread zeroes the first part
+    cxx::vector<std::thread, MAX_NUMBER_OF_PREFAULT_THREADS - 1U> threads;
+    for (uint64_t part = 1U; part < numberOfThreads; ++part)
+    {
+        threads.emplace_back(zeroPart, part);
+    }
+    zeroPart(0U);
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+static uint64_t microsecondsSince(const std::chrono::steady_clock::time_point& begin) noexcept
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count());
+}
+
 // NOLINTJUSTIFICATION the function size is related to the error handling and the cognitive complexity
 // results from the expanded log macro
 // NOLINTNEXTLINE(readability-function-size,readability-function-cognitive-complexity)
@@ -61,6 +168,7 @@ cxx::expected<SharedMemoryObject, SharedMemoryObjectError> SharedMemoryObjectBui
 {
     auto printErrorDetails = [this] {
         LogError() << "Unable to create a shared memory object with the following properties [ name = " << m_name
+                   << ", directory = " << (m_directory.empty() ? "(shm_open)" : m_directory.c_str())
                    << ", sizeInBytes = " << m_memorySizeInBytes << ", access mode = " << asStringLiteral(m_accessMode)
                    << ", open mode = " << asStringLiteral(m_openMode) << ", baseAddressHint = "
                    << ((m_baseAddressHint) ? iox::log::hex(m_baseAddressHint.value())
@@ -69,12 +177,14 @@ cxx::expected<SharedMemoryObject, SharedMemoryObjectError> SharedMemoryObjectBui
                    << ", permissions = " << iox::log::oct(static_cast<mode_t>(m_permissions)) << " ]";
     };
 
+    auto timestamp = std::chrono::steady_clock::now();
     auto sharedMemory = SharedMemoryBuilder()
                             .name(m_name)
                             .accessMode(m_accessMode)
                             .openMode(m_openMode)
                             .filePermissions(m_permissions)
                             .size(m_memorySizeInBytes)
+                            .directory(m_directory)
                             .create();
 
     if (!sharedMemory)
@@ -83,7 +193,9 @@ cxx::expected<SharedMemoryObject, SharedMemoryObjectError> SharedMemoryObjectBui
         LogError() << "Unable to create SharedMemoryObject since we could not acquire a SharedMemory resource";
         return cxx::error<SharedMemoryObjectError>(SharedMemoryObjectError::SHARED_MEMORY_CREATION_FAILED);
     }
+    const uint64_t openDuration = microsecondsSince(timestamp);
 
+    timestamp = std::chrono::steady_clock::now();
     auto memoryMap = MemoryMapBuilder()
                          .baseAddressHint((m_baseAddressHint) ? *m_baseAddressHint : nullptr)
                          .length(m_memorySizeInBytes)
@@ -99,13 +211,46 @@ cxx::expected<SharedMemoryObject, SharedMemoryObjectError> SharedMemoryObjectBui
         LogError() << "Failed to map created shared memory into process!";
         return cxx::error<SharedMemoryObjectError>(SharedMemoryObjectError::MAPPING_SHARED_MEMORY_FAILED);
     }
+    const uint64_t mapDuration = microsecondsSince(timestamp);
 
     Allocator allocator(memoryMap->getBaseAddress(), m_memorySizeInBytes);
 
     if (sharedMemory->hasOwnership())
     {
         LogDebug() << "Trying to reserve " << m_memorySizeInBytes << " bytes in the shared memory [" << m_name << "]";
-        if (platform::IOX_SHM_WRITE_ZEROS_ON_CREATION)
+        timestamp = std::chrono::steady_clock::now();
+        if (m_numaPolicy.mode != NumaPolicy::Mode::DEFAULT)
+        {
+            applyNumaPolicy(memoryMap->getBaseAddress(), m_memorySizeInBytes, m_numaPolicy, m_name);
+        }
+        const uint64_t numaDuration = microsecondsSince(timestamp);
+
+        timestamp = std::chrono::steady_clock::now();
+        auto prefaultStrategy =
+            (platform::IOX_SHM_WRITE_ZEROS_ON_CREATION) ? m_prefaultStrategy : PrefaultStrategy::LAZY;
+        if (prefaultStrategy == PrefaultStrategy::POPULATE)
+        {
+            auto populateResult = posixCall(iox_populate_write)(memoryMap->getBaseAddress(), m_memorySizeInBytes)
+                                      .failureReturnValue(-1)
+                                      .evaluate();
+            if (populateResult.has_error())
+            {
+                if (populateResult.get_error().errnum != EINVAL && populateResult.get_error().errnum != ENOSYS)
+                {
+                    printErrorDetails();
+                    LogError() << "Unable to populate the shared memory since \""
+                               << populateResult.get_error().getHumanReadableErrnum()
+                               << "\", it maybe requires more memory than it is currently available in the system";
+                    return cxx::error<SharedMemoryObjectError>(
+                        SharedMemoryObjectError::PREFAULTING_SHARED_MEMORY_FAILED);
+                }
+                LogWarn() << "Populating the shared memory [" << m_name
+                          << "] is not supported by the system, it is zeroed instead";
+                prefaultStrategy = PrefaultStrategy::ZERO;
+            }
+        }
+
+        if (prefaultStrategy == PrefaultStrategy::ZERO || prefaultStrategy == PrefaultStrategy::PARALLEL_ZERO)
         {
             // this lock is required for the case that multiple threads are creating multiple
             // shared memory objects concurrently
@@ -135,8 +280,22 @@ cxx::expected<SharedMemoryObject, SharedMemoryObjectError> SharedMemoryObjectBui
                 (m_baseAddressHint) ? *m_baseAddressHint : nullptr,
                 std::bitset<sizeof(mode_t)>(static_cast<mode_t>(m_permissions)).to_ulong()));
 
-            memset(memoryMap->getBaseAddress(), 0, m_memorySizeInBytes);
+            if (prefaultStrategy == PrefaultStrategy::PARALLEL_ZERO)
+            {
+                zeroInParallel(memoryMap->getBaseAddress(), m_memorySizeInBytes);
+            }
+            else
+            {
+                memset(memoryMap->getBaseAddress(), 0, m_memorySizeInBytes);
+            }
         }
+        const uint64_t prefaultDuration = microsecondsSince(timestamp);
+
+        LogInfo() << "Created the shared memory [" << m_name << "] with " << m_memorySizeInBytes
+                  << " bytes in " << openDuration + mapDuration + numaDuration + prefaultDuration
+                  << " us [ open = " << openDuration << " us, map = " << mapDuration << " us, NUMA policy = "
+                  << numaDuration << " us, prefault with " << asStringLiteral(prefaultStrategy) << " = "
+                  << prefaultDuration << " us ]";
         LogDebug() << "Acquired " << m_memorySizeInBytes << " bytes successfully in the shared memory [" << m_name
                    << "]";
     }
@@ -196,6 +355,35 @@ bool SharedMemoryObject::hasOwnership() const noexcept
     return m_sharedMemory.hasOwnership();
 }
 
+cxx::expected<SharedMemoryObjectError> SharedMemoryObject::lockInMemory() noexcept
+{
+    auto result = posixCall(mlock)(getBaseAddress(), m_memorySizeInBytes).failureReturnValue(-1).evaluate();
+    if (!result.has_error())
+    {
+        return cxx::success<void>();
+    }
 
+    LogError() << "Unable to lock the " << m_memorySizeInBytes << " bytes of the shared memory at "
+               << iox::log::hex(getBaseAddress()) << " in RAM since \"" << result.get_error().getHumanReadableErrnum()
+               << "\"";
+    const auto errnum = result.get_error().errnum;
+    if (errnum == ENOMEM || errnum == EAGAIN || errnum == EPERM)
+    {
+        rlimit memlockLimit{};
+        posixCall(getrlimit)(RLIMIT_MEMLOCK, &memlockLimit)
+            .failureReturnValue(-1)
+            .evaluate()
+            .and_then([&](auto&) {
+                LogError() << "The memory a process may lock is limited by RLIMIT_MEMLOCK to " << memlockLimit.rlim_cur
+                           << " bytes, raise it with 'ulimit -l', 'LimitMEMLOCK' of a systemd unit or in "
+                           << "/etc/security/limits.conf or grant the process the CAP_IPC_LOCK capability";
+            })
+            .or_else([](auto&) {
+                LogError() << "The memory a process may lock is limited by RLIMIT_MEMLOCK, raise it or grant the "
+                           << "process the CAP_IPC_LOCK capability";
+            });
+    }
+    return cxx::error<SharedMemoryObjectError>(SharedMemoryObjectError::LOCKING_SHARED_MEMORY_FAILED);
+}
 } // namespace posix
 } // namespace iox
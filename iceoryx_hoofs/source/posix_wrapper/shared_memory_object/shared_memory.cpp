@@ -28,19 +28,38 @@
 
 #include <bitset>
 #include <cassert>
+#include <cstdio>
 #include <limits>
 
 namespace iox
 {
 namespace posix
 {
-cxx::string<SharedMemory::Name_t::capacity() + 1> addLeadingSlash(const SharedMemory::Name_t& name) noexcept
+using SharedMemoryPath_t = cxx::string<SharedMemory::Directory_t::capacity() + SharedMemory::Name_t::capacity() + 1>;
+
+/// @brief the name for shm_open or, when a directory is set, the path of the file in this directory
+SharedMemoryPath_t addLeadingSlash(const SharedMemory::Name_t& name,
+                                   const SharedMemory::Directory_t& directory = SharedMemory::Directory_t()) noexcept
 {
-    cxx::string<SharedMemory::Name_t::capacity() + 1> nameWithLeadingSlash = "/";
+    SharedMemoryPath_t nameWithLeadingSlash{cxx::TruncateToCapacity, directory.c_str(), directory.size()};
+    nameWithLeadingSlash.append(cxx::TruncateToCapacity, "/");
     nameWithLeadingSlash.append(cxx::TruncateToCapacity, name);
     return nameWithLeadingSlash;
 }
 
+using OpenFunction_t = int (*)(const char*, int, mode_t);
+using UnlinkFunction_t = int (*)(const char*);
+
+OpenFunction_t openFunction(const SharedMemory::Directory_t& directory) noexcept
+{
+    return directory.empty() ? iox_shm_open : iox_open;
+}
+
+UnlinkFunction_t unlinkFunction(const SharedMemory::Directory_t& directory) noexcept
+{
+    return directory.empty() ? iox_shm_unlink : remove;
+}
+
 cxx::expected<SharedMemory, SharedMemoryError> SharedMemoryBuilder::create() noexcept
 {
     auto printError = [this] {
@@ -66,7 +85,15 @@ cxx::expected<SharedMemory, SharedMemoryError> SharedMemoryBuilder::create() noe
         return cxx::error<SharedMemoryError>(SharedMemoryError::INVALID_FILE_NAME);
     }
 
-    auto nameWithLeadingSlash = addLeadingSlash(m_name);
+    if (!m_directory.empty() && !cxx::isValidPathToDirectory(m_directory))
+    {
+        std::cerr << "The directory \"" << m_directory << "\" of the shared memory is not a valid path" << std::endl;
+        return cxx::error<SharedMemoryError>(SharedMemoryError::INVALID_FILE_NAME);
+    }
+
+    auto nameWithLeadingSlash = addLeadingSlash(m_name, m_directory);
+    auto openSharedMemory = openFunction(m_directory);
+    auto unlinkSharedMemory = unlinkFunction(m_directory);
 
     // the mask will be applied to the permissions, therefore we need to set it to 0
     int sharedMemoryFileHandle = SharedMemory::INVALID_HANDLE;
@@ -76,14 +103,14 @@ cxx::expected<SharedMemory, SharedMemoryError> SharedMemoryBuilder::create() noe
 
         if (m_openMode == OpenMode::PURGE_AND_CREATE)
         {
-            IOX_DISCARD_RESULT(posixCall(iox_shm_unlink)(nameWithLeadingSlash.c_str())
+            IOX_DISCARD_RESULT(posixCall(unlinkSharedMemory)(nameWithLeadingSlash.c_str())
                                    .failureReturnValue(SharedMemory::INVALID_HANDLE)
                                    .ignoreErrnos(ENOENT)
                                    .evaluate());
         }
 
         auto result =
-            posixCall(iox_shm_open)(
+            posixCall(openSharedMemory)(
                 nameWithLeadingSlash.c_str(),
                 convertToOflags(m_accessMode,
                                 (m_openMode == OpenMode::OPEN_OR_CREATE) ? OpenMode::EXCLUSIVE_CREATE : m_openMode),
@@ -97,16 +124,17 @@ cxx::expected<SharedMemory, SharedMemoryError> SharedMemoryBuilder::create() noe
             // ownership and we just try to open it
             if (m_openMode == OpenMode::OPEN_OR_CREATE && result.get_error().errnum == EEXIST)
             {
-                result = posixCall(iox_shm_open)(nameWithLeadingSlash.c_str(),
-                                                 convertToOflags(m_accessMode, OpenMode::OPEN_EXISTING),
-                                                 static_cast<mode_t>(m_filePermissions))
+                result = posixCall(openSharedMemory)(nameWithLeadingSlash.c_str(),
+                                                     convertToOflags(m_accessMode, OpenMode::OPEN_EXISTING),
+                                                     static_cast<mode_t>(m_filePermissions))
                              .failureReturnValue(SharedMemory::INVALID_HANDLE)
                              .evaluate();
                 if (!result.has_error())
                 {
                     constexpr bool HAS_NO_OWNERSHIP = false;
                     sharedMemoryFileHandle = result->value;
-                    return cxx::success<SharedMemory>(SharedMemory(m_name, sharedMemoryFileHandle, HAS_NO_OWNERSHIP));
+                    return cxx::success<SharedMemory>(
+                        SharedMemory(m_name, m_directory, sharedMemoryFileHandle, HAS_NO_OWNERSHIP));
                 }
             }
 
@@ -135,7 +163,7 @@ cxx::expected<SharedMemory, SharedMemoryError> SharedMemoryBuilder::create() noe
                               << " for SharedMemory \"" << m_name << "\"" << std::endl;
                 });
 
-            posixCall(iox_shm_unlink)(nameWithLeadingSlash.c_str())
+            posixCall(unlinkSharedMemory)(nameWithLeadingSlash.c_str())
                 .failureReturnValue(SharedMemory::INVALID_HANDLE)
                 .evaluate()
                 .or_else([&](auto&) {
@@ -147,11 +175,15 @@ cxx::expected<SharedMemory, SharedMemoryError> SharedMemoryBuilder::create() noe
         }
     }
 
-    return cxx::success<SharedMemory>(SharedMemory(m_name, sharedMemoryFileHandle, hasOwnership));
+    return cxx::success<SharedMemory>(SharedMemory(m_name, m_directory, sharedMemoryFileHandle, hasOwnership));
 }
 
-SharedMemory::SharedMemory(const Name_t& name, const int handle, const bool hasOwnership) noexcept
+SharedMemory::SharedMemory(const Name_t& name,
+                           const Directory_t& directory,
+                           const int handle,
+                           const bool hasOwnership) noexcept
     : m_name{name}
+    , m_directory{directory}
     , m_handle{handle}
     , m_hasOwnership{hasOwnership}
 {
@@ -172,6 +204,7 @@ void SharedMemory::reset() noexcept
 {
     m_hasOwnership = false;
     m_name = Name_t();
+    m_directory = Directory_t();
     m_handle = INVALID_HANDLE;
 }
 
@@ -187,6 +220,7 @@ SharedMemory& SharedMemory::operator=(SharedMemory&& rhs) noexcept
         destroy();
 
         m_name = rhs.m_name;
+        m_directory = rhs.m_directory;
         m_hasOwnership = rhs.m_hasOwnership;
         m_handle = rhs.m_handle;
 
@@ -205,11 +239,13 @@ bool SharedMemory::hasOwnership() const noexcept
     return m_hasOwnership;
 }
 
-cxx::expected<bool, SharedMemoryError> SharedMemory::unlinkIfExist(const Name_t& name) noexcept
+cxx::expected<bool, SharedMemoryError> SharedMemory::unlinkIfExist(const Name_t& name,
+                                                                   const Directory_t& directory) noexcept
 {
-    auto nameWithLeadingSlash = addLeadingSlash(name);
+    auto nameWithLeadingSlash = addLeadingSlash(name, directory);
+    auto unlinkSharedMemory = unlinkFunction(directory);
 
-    auto result = posixCall(iox_shm_unlink)(nameWithLeadingSlash.c_str())
+    auto result = posixCall(unlinkSharedMemory)(nameWithLeadingSlash.c_str())
                       .failureReturnValue(INVALID_HANDLE)
                       .ignoreErrnos(ENOENT)
                       .evaluate();
@@ -226,7 +262,7 @@ bool SharedMemory::unlink() noexcept
 {
     if (m_hasOwnership)
     {
-        auto unlinkResult = unlinkIfExist(m_name);
+        auto unlinkResult = unlinkIfExist(m_name, m_directory);
         if (unlinkResult.has_error() || !unlinkResult.value())
         {
             std::cerr << "Unable to unlink SharedMemory (shm_unlink failed)." << std::endl;
@@ -124,7 +124,24 @@ bool BaseRelativePointer::unregisterPtr(const id_t id) noexcept
 // NOLINTNEXTLINE(performance-unnecessary-value-param)
 BaseRelativePointer::ptr_t BaseRelativePointer::getBasePtr(const id_t id) noexcept
 {
-    return getRepository().getBasePtr(static_cast<id_underlying_t>(id));
+    const auto rawId = static_cast<id_underlying_t>(id);
+    auto* basePtr = getRepository().getBasePtr(rawId);
+    // id 0 stands for raw pointers and is never registered
+    if (basePtr == nullptr && rawId > 0U && rawId < MAX_POINTER_REPO_CAPACITY)
+    {
+        auto handler = getUnregisteredSegmentHandler().load(std::memory_order_acquire);
+        if (handler != nullptr)
+        {
+            handler(rawId);
+            basePtr = getRepository().getBasePtr(rawId);
+        }
+    }
+    return basePtr;
+}
+
+void BaseRelativePointer::setUnregisteredSegmentHandler(const UnregisteredSegmentHandler_t handler) noexcept
+{
+    getUnregisteredSegmentHandler().store(handler, std::memory_order_release);
 }
 
 void BaseRelativePointer::unregisterAll() noexcept
@@ -183,6 +200,13 @@ BaseRelativePointer::getRepository() noexcept
     return repository;
 }
 
+std::atomic<BaseRelativePointer::UnregisteredSegmentHandler_t>&
+BaseRelativePointer::getUnregisteredSegmentHandler() noexcept
+{
+    static std::atomic<UnregisteredSegmentHandler_t> handler{nullptr};
+    return handler;
+}
+
 BaseRelativePointer::offset_t BaseRelativePointer::computeOffset(ptr_t ptr) const noexcept
 {
     return getOffset(id_t{m_id}, ptr);
@@ -0,0 +1,126 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/concurrent/futex_semaphore.hpp"
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_platform/platform_settings.hpp"
+#include "test.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::units::duration_literals;
+
+class FutexSemaphore_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        if (!iox::platform::IOX_SUPPORT_FUTEX)
+        {
+            GTEST_SKIP() << "Futexes are not supported on this platform.";
+        }
+        m_watchdog.watchAndActOnFailure([] { std::terminate(); });
+        ASSERT_FALSE(iox::concurrent::FutexSemaphoreBuilder().create(sut).has_error());
+    }
+
+    iox::cxx::optional<iox::concurrent::FutexSemaphore> sut;
+    Watchdog m_watchdog{5_s};
+};
+
+TEST_F(FutexSemaphore_test, ResetSetsValueToZero)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a3a64101-ad33-4a81-909e-4d11eac8f04f");
+    constexpr uint32_t NUMBER_OF_POSTS{42U};
+    for (uint32_t i = 0U; i < NUMBER_OF_POSTS; ++i)
+    {
+        ASSERT_FALSE(sut->post().has_error());
+    }
+
+    sut->reset();
+
+    auto result = sut->tryWait();
+    ASSERT_FALSE(result.has_error());
+    EXPECT_FALSE(*result);
+}
+
+TEST_F(FutexSemaphore_test, EveryPostWakesUpOneOfMultipleWaiters)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "13fa602c-897f-47db-bd3d-2f3132f24eae");
+    constexpr uint64_t NUMBER_OF_WAITERS{4U};
+    std::atomic<uint64_t> numberOfWokenUpWaiters{0U};
+    std::vector<std::thread> waiters;
+    for (uint64_t i = 0U; i < NUMBER_OF_WAITERS; ++i)
+    {
+        waiters.emplace_back([&] {
+            EXPECT_FALSE(sut->wait().has_error());
+            ++numberOfWokenUpWaiters;
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_THAT(numberOfWokenUpWaiters.load(), Eq(0U));
+
+    for (uint64_t i = 0U; i < NUMBER_OF_WAITERS; ++i)
+    {
+        ASSERT_FALSE(sut->post().has_error());
+    }
+
+    for (auto& waiter : waiters)
+    {
+        waiter.join();
+    }
+    EXPECT_THAT(numberOfWokenUpWaiters.load(), Eq(NUMBER_OF_WAITERS));
+}
+
+TEST_F(FutexSemaphore_test, WaiterIsWokenUpAfterTheWaitersWereReset)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6f2b8c41-0d7e-4a93-b5e2-91c4d8a07f36");
+    sut->resetWaiters();
+
+    std::atomic_bool isWokenUp{false};
+    std::thread waiter([&] {
+        EXPECT_FALSE(sut->wait().has_error());
+        isWokenUp = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_FALSE(isWokenUp.load());
+    ASSERT_FALSE(sut->post().has_error());
+    waiter.join();
+
+    EXPECT_TRUE(isWokenUp.load());
+}
+
+TEST_F(FutexSemaphore_test, TimedWaitIsWokenUpByPostBeforeTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d9103a53-c011-43a8-88db-d1dc61617e84");
+    std::thread notifier([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        EXPECT_FALSE(sut->post().has_error());
+    });
+
+    auto result = sut->timedWait(2_s);
+    notifier.join();
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(*result, Eq(iox::posix::SemaphoreWaitState::NO_TIMEOUT));
+}
+} // namespace
@@ -219,4 +219,53 @@ TYPED_TEST(LoFFLi_test, PushToUninitializedLoFFLi)
     decltype(this->m_loffli) loFFLi;
     EXPECT_THAT(loFFLi.push(0), Eq(false));
 }
+
+TYPED_TEST(LoFFLi_test, BatchPopReturnsAtMostTheAvailableIndices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c093c91a-6c0a-46f7-b823-f74f7a0f82ae");
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) needed for the batch pop
+    uint32_t indices[Size + 1U];
+    EXPECT_THAT(this->m_loffli.pop(&indices[0], Size - 1U), Eq(Size - 1U));
+    EXPECT_THAT(this->m_loffli.pop(&indices[Size - 1U], 2U), Eq(1U));
+    EXPECT_THAT(this->m_loffli.pop(&indices[0], Size), Eq(0U));
+
+    uint32_t index{0U};
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(false));
+}
+
+TYPED_TEST(LoFFLi_test, BatchPushedIndicesCanBePoppedAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3bbd64be-2be0-44ea-a039-0465f7b8c129");
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) needed for the batch pop
+    uint32_t indices[Size];
+    ASSERT_THAT(this->m_loffli.pop(&indices[0], Size), Eq(Size));
+
+    EXPECT_THAT(this->m_loffli.push(&indices[0], Size), Eq(true));
+
+    std::vector<uint32_t> poppedIndices;
+    uint32_t index{0U};
+    while (this->m_loffli.pop(index))
+    {
+        poppedIndices.push_back(index);
+    }
+    std::sort(poppedIndices.begin(), poppedIndices.end());
+    EXPECT_THAT(poppedIndices, ElementsAre(0U, 1U, 2U, 3U));
+}
+
+TYPED_TEST(LoFFLi_test, BatchPushWithInvalidIndexPushesNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f4d92058-b7fe-46fb-a9db-1ebf80e64766");
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) needed for the batch pop
+    uint32_t indices[Size];
+    ASSERT_THAT(this->m_loffli.pop(&indices[0], 2U), Eq(2U));
+
+    indices[2U] = indices[0U];
+    EXPECT_THAT(this->m_loffli.push(&indices[0], 3U), Eq(false));
+    indices[2U] = Size;
+    EXPECT_THAT(this->m_loffli.push(&indices[0], 3U), Eq(false));
+
+    // the valid indices are still popped and can be pushed
+    EXPECT_THAT(this->m_loffli.push(&indices[0], 2U), Eq(true));
+    EXPECT_THAT(this->m_loffli.push(&indices[0], 2U), Eq(false));
+}
 } // namespace
@@ -470,4 +470,51 @@ TEST_F(SoFiTest, PopIfInvalidNotEmptyAfter)
 
     EXPECT_EQ(sofi.empty(), false);
 }
+
+TEST_F(SoFiTest, PopManyReturnsAtMostMaxNumberOfValuesInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f495026a-78a7-4df5-a46c-cbe023451091");
+    for (int i = 0; i < 5; ++i)
+    {
+        sofi.push(i, returnVal);
+    }
+
+    int valuesOut[TEST_SOFI_CAPACITY];
+    ASSERT_EQ(sofi.popMany(valuesOut, 3U), 3U);
+    EXPECT_EQ(valuesOut[0], 0);
+    EXPECT_EQ(valuesOut[1], 1);
+    EXPECT_EQ(valuesOut[2], 2);
+    EXPECT_EQ(sofi.size(), 2U);
+
+    ASSERT_EQ(sofi.popMany(valuesOut, TEST_SOFI_CAPACITY), 2U);
+    EXPECT_EQ(valuesOut[0], 3);
+    EXPECT_EQ(valuesOut[1], 4);
+    EXPECT_EQ(sofi.empty(), true);
+}
+
+TEST_F(SoFiTest, PopManyOnEmptySoFiReturnsZero)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bd0103c9-b641-4ed0-a78c-11d31e354648");
+    int valuesOut[TEST_SOFI_CAPACITY];
+    EXPECT_EQ(sofi.popMany(valuesOut, TEST_SOFI_CAPACITY), 0U);
+}
+
+TEST_F(SoFiTest, PopManyAfterOverflowReturnsTheNewestValues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cfcc0789-9152-43e3-8351-e1f6129acec7");
+    constexpr int NUMBER_OF_PUSHES{static_cast<int>(TEST_SOFI_CAPACITY) + 3};
+    for (int i = 0; i < NUMBER_OF_PUSHES; ++i)
+    {
+        sofi.push(i, returnVal);
+    }
+
+    int valuesOut[TEST_SOFI_CAPACITY];
+    const uint64_t capacity{TEST_SOFI_CAPACITY};
+    ASSERT_EQ(sofi.popMany(valuesOut, capacity), capacity);
+    for (uint64_t i = 0U; i < TEST_SOFI_CAPACITY; ++i)
+    {
+        EXPECT_EQ(valuesOut[i], NUMBER_OF_PUSHES - static_cast<int>(TEST_SOFI_CAPACITY) + static_cast<int>(i));
+    }
+    EXPECT_EQ(sofi.empty(), true);
+}
 } // namespace
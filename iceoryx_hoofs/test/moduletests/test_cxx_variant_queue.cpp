@@ -101,6 +101,27 @@ TEST_F(VariantQueue_test, popsMultiElementsWhichWerePushed)
     });
 }
 
+TEST_F(VariantQueue_test, popManyReturnsAtMostMaxNumberOfValuesInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d8d189f6-717a-429d-9f77-fd2983ec924b");
+    PerformTestForQueueTypes([](uint64_t typeID) {
+        VariantQueue<int, 5> sut(static_cast<VariantQueueTypes>(typeID));
+        sut.push(14123);
+        sut.push(24123);
+        sut.push(34123);
+
+        int values[5];
+        ASSERT_THAT(sut.popMany(values, 2U), Eq(2U));
+        EXPECT_THAT(values[0], Eq(14123));
+        EXPECT_THAT(values[1], Eq(24123));
+
+        ASSERT_THAT(sut.popMany(values, 5U), Eq(1U));
+        EXPECT_THAT(values[0], Eq(34123));
+
+        EXPECT_THAT(sut.popMany(values, 5U), Eq(0U));
+    });
+}
+
 TEST_F(VariantQueue_test, pushTwoElementsAfterSecondPopIsInvalid)
 {
     ::testing::Test::RecordProperty("TEST_ID", "22cc44ac-bebe-4516-b2fe-290fbefb60b7");
@@ -15,6 +15,7 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#include "iceoryx_hoofs/internal/concurrent/futex_semaphore.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/semaphore_interface.hpp"
 #include "iceoryx_hoofs/internal/units/duration.hpp"
 #include "iceoryx_hoofs/posix_wrapper/named_semaphore.hpp"
@@ -47,6 +48,10 @@ class SemaphoreInterfaceTest : public Test
 
     void SetUp() override
     {
+        if (!SutFactory::IS_SUPPORTED)
+        {
+            GTEST_SKIP() << "The semaphore implementation is not supported on this platform.";
+        }
         deadlockWatchdog.watchAndActOnFailure([] { std::terminate(); });
         ASSERT_TRUE(SutFactory::create(sut, 0U));
     }
@@ -76,6 +81,7 @@ constexpr iox::units::Duration SemaphoreInterfaceTest<T>::TIMING_TEST_WAIT_TIME;
 struct UnnamedSemaphoreTest
 {
     using SutType = iox::cxx::optional<iox::posix::UnnamedSemaphore>;
+    static constexpr bool IS_SUPPORTED{true};
     static iox::cxx::expected<iox::posix::SemaphoreError> create(SutType& sut, const uint32_t initialValue)
     {
         return iox::posix::UnnamedSemaphoreBuilder()
@@ -88,6 +94,7 @@ struct UnnamedSemaphoreTest
 struct NamedSemaphoreTest
 {
     using SutType = iox::cxx::optional<iox::posix::NamedSemaphore>;
+    static constexpr bool IS_SUPPORTED{true};
     static iox::cxx::expected<iox::posix::SemaphoreError> create(SutType& sut, const uint32_t initialValue)
     {
         return iox::posix::NamedSemaphoreBuilder()
@@ -99,7 +106,17 @@ struct NamedSemaphoreTest
     }
 };
 
-using Implementations = Types<UnnamedSemaphoreTest, NamedSemaphoreTest>;
+struct FutexSemaphoreTest
+{
+    using SutType = iox::cxx::optional<iox::concurrent::FutexSemaphore>;
+    static constexpr bool IS_SUPPORTED{iox::platform::IOX_SUPPORT_FUTEX};
+    static iox::cxx::expected<iox::posix::SemaphoreError> create(SutType& sut, const uint32_t initialValue)
+    {
+        return iox::concurrent::FutexSemaphoreBuilder().initialValue(initialValue).create(sut);
+    }
+};
+
+using Implementations = Types<UnnamedSemaphoreTest, NamedSemaphoreTest, FutexSemaphoreTest>;
 
 TYPED_TEST_SUITE(SemaphoreInterfaceTest, Implementations, );
 
@@ -24,6 +24,7 @@
 #include "iceoryx_platform/unistd.hpp"
 
 #include <fcntl.h>
+#include <fstream>
 
 namespace
 {
@@ -256,5 +257,52 @@ TEST_F(SharedMemory_Test, OpenFailsWhenShmDoesNotExist)
     ASSERT_TRUE(sut.has_error());
 }
 
+TEST_F(SharedMemory_Test, CreateInDirectoryCreatesTheSharedMemoryAsFileInThisDirectory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ba29904e-5932-4ecb-a34c-b2348766e050");
+    const SharedMemory::Directory_t directory{"/tmp"};
+    const std::string path = std::string(directory.c_str()) + "/" + SUT_SHM_NAME;
+    {
+        auto sut = iox::posix::SharedMemoryBuilder()
+                       .name(SUT_SHM_NAME)
+                       .accessMode(iox::posix::AccessMode::READ_WRITE)
+                       .openMode(OpenMode::PURGE_AND_CREATE)
+                       .filePermissions(cxx::perms::owner_all)
+                       .size(128)
+                       .directory(directory)
+                       .create();
+        ASSERT_FALSE(sut.has_error());
+        EXPECT_TRUE(sut->hasOwnership());
+        EXPECT_TRUE(std::ifstream(path).good());
+
+        auto openedSut = iox::posix::SharedMemoryBuilder()
+                             .name(SUT_SHM_NAME)
+                             .accessMode(iox::posix::AccessMode::READ_WRITE)
+                             .openMode(OpenMode::OPEN_EXISTING)
+                             .directory(directory)
+                             .create();
+        ASSERT_FALSE(openedSut.has_error());
+        EXPECT_FALSE(openedSut->hasOwnership());
+
+        EXPECT_TRUE(createSut(SUT_SHM_NAME, OpenMode::OPEN_EXISTING).has_error());
+    }
+    EXPECT_FALSE(std::ifstream(path).good());
+}
+
+TEST_F(SharedMemory_Test, CreateInNonExistingDirectoryFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5e8f14da-539a-4c2e-975a-af74d9bea9ca");
+    auto sut = iox::posix::SharedMemoryBuilder()
+                   .name(SUT_SHM_NAME)
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(OpenMode::PURGE_AND_CREATE)
+                   .filePermissions(cxx::perms::owner_all)
+                   .size(128)
+                   .directory("/this/directory/does/not/exist")
+                   .create();
+    ASSERT_TRUE(sut.has_error());
+    EXPECT_THAT(sut.get_error(), Eq(SharedMemoryError::DOES_NOT_EXIST));
+}
+
 
 } // namespace
@@ -228,4 +228,132 @@ TEST_F(SharedMemoryObject_Test, OpeningSharedMemoryAndReadMultipleContents)
     EXPECT_THAT(*sutValue1, Eq(4557));
     EXPECT_THAT(*sutValue2, Eq(8912));
 }
+
+TEST_F(SharedMemoryObject_Test, CreateWithNumaPolicyOfFirstNodeProvidesUsableMemory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d9c5fe12-88fd-4061-a766-4efd4be326c2");
+    constexpr uint64_t MEMORY_SIZE{8192U};
+
+    auto sut = iox::posix::SharedMemoryObjectBuilder()
+                   .name("shmNumaSut")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(iox::posix::OpenMode::PURGE_AND_CREATE)
+                   .permissions(cxx::perms::owner_all)
+                   .numaPolicy({iox::posix::NumaPolicy::Mode::INTERLEAVE, 1U})
+                   .create();
+
+    ASSERT_THAT(sut.has_error(), Eq(false));
+    auto* memory = static_cast<uint8_t*>(sut->allocate(MEMORY_SIZE, 1));
+    ASSERT_THAT(memory, Ne(nullptr));
+    memory[0] = 73U;
+    memory[MEMORY_SIZE - 1U] = 37U;
+    EXPECT_THAT(memory[0], Eq(73U));
+    EXPECT_THAT(memory[MEMORY_SIZE - 1U], Eq(37U));
+}
+
+TEST_F(SharedMemoryObject_Test, CreateWithNumaPolicyOfNonExistingNodeFallsBackToFirstTouch)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "baccc64f-3a4e-4b31-8047-bb0909172087");
+    constexpr uint64_t NON_EXISTING_NODE{iox::posix::NumaPolicy::MAX_NUMBER_OF_NODES - 1U};
+
+    auto sut = iox::posix::SharedMemoryObjectBuilder()
+                   .name("shmNumaSut")
+                   .memorySizeInBytes(128)
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(iox::posix::OpenMode::PURGE_AND_CREATE)
+                   .permissions(cxx::perms::owner_all)
+                   .numaPolicy({iox::posix::NumaPolicy::Mode::BIND, 1ULL << NON_EXISTING_NODE})
+                   .create();
+
+    ASSERT_THAT(sut.has_error(), Eq(false));
+    auto* memory = static_cast<uint8_t*>(sut->allocate(128, 1));
+    ASSERT_THAT(memory, Ne(nullptr));
+    EXPECT_THAT(memory[0], Eq(0U));
+}
+
+TEST_F(SharedMemoryObject_Test, CreateWithParallelZeroProvidesZeroedMemory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dd6cc713-e47b-4a03-bf80-e06c2f712f99");
+    // large enough to be split among multiple threads and not a multiple of the page size
+    constexpr uint64_t MEMORY_SIZE{65U * 1024U * 1024U + 123U};
+
+    auto sut = iox::posix::SharedMemoryObjectBuilder()
+                   .name("shmPrefaultSut")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(iox::posix::OpenMode::PURGE_AND_CREATE)
+                   .permissions(cxx::perms::owner_all)
+                   .prefaultStrategy(iox::posix::PrefaultStrategy::PARALLEL_ZERO)
+                   .create();
+
+    ASSERT_THAT(sut.has_error(), Eq(false));
+    auto* memory = static_cast<uint8_t*>(sut->allocate(MEMORY_SIZE, 1));
+    ASSERT_THAT(memory, Ne(nullptr));
+    EXPECT_THAT(memory[0], Eq(0U));
+    EXPECT_THAT(memory[MEMORY_SIZE / 2U], Eq(0U));
+    EXPECT_THAT(memory[MEMORY_SIZE - 1U], Eq(0U));
+    memory[MEMORY_SIZE - 1U] = 37U;
+    EXPECT_THAT(memory[MEMORY_SIZE - 1U], Eq(37U));
+}
+
+TEST_F(SharedMemoryObject_Test, CreateWithPopulateProvidesZeroedMemory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "20265869-6d7f-4b43-8599-5419211b87e3");
+    constexpr uint64_t MEMORY_SIZE{8192U};
+
+    auto sut = iox::posix::SharedMemoryObjectBuilder()
+                   .name("shmPrefaultSut")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(iox::posix::OpenMode::PURGE_AND_CREATE)
+                   .permissions(cxx::perms::owner_all)
+                   .prefaultStrategy(iox::posix::PrefaultStrategy::POPULATE)
+                   .create();
+
+    ASSERT_THAT(sut.has_error(), Eq(false));
+    auto* memory = static_cast<uint8_t*>(sut->allocate(MEMORY_SIZE, 1));
+    ASSERT_THAT(memory, Ne(nullptr));
+    EXPECT_THAT(memory[0], Eq(0U));
+    EXPECT_THAT(memory[MEMORY_SIZE - 1U], Eq(0U));
+}
+
+TEST_F(SharedMemoryObject_Test, CreateWithLazyPrefaultProvidesZeroedMemory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7122d53d-fefe-4d62-9f15-f4588abb8125");
+    constexpr uint64_t MEMORY_SIZE{8192U};
+
+    auto sut = iox::posix::SharedMemoryObjectBuilder()
+                   .name("shmPrefaultSut")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(iox::posix::OpenMode::PURGE_AND_CREATE)
+                   .permissions(cxx::perms::owner_all)
+                   .prefaultStrategy(iox::posix::PrefaultStrategy::LAZY)
+                   .create();
+
+    ASSERT_THAT(sut.has_error(), Eq(false));
+    auto* memory = static_cast<uint8_t*>(sut->allocate(MEMORY_SIZE, 1));
+    ASSERT_THAT(memory, Ne(nullptr));
+    EXPECT_THAT(memory[0], Eq(0U));
+    EXPECT_THAT(memory[MEMORY_SIZE - 1U], Eq(0U));
+}
+
+TEST_F(SharedMemoryObject_Test, LockInMemoryOfSmallSharedMemorySucceeds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a4f0c9e2-6b3d-4e81-97c5-2d8e1b7f3a60");
+    // small enough for the default RLIMIT_MEMLOCK of unprivileged users
+    constexpr uint64_t MEMORY_SIZE{8192U};
+
+    auto sut = iox::posix::SharedMemoryObjectBuilder()
+                   .name("shmLockSut")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(iox::posix::OpenMode::PURGE_AND_CREATE)
+                   .permissions(cxx::perms::owner_all)
+                   .create();
+
+    ASSERT_THAT(sut.has_error(), Eq(false));
+    EXPECT_THAT(sut->lockInMemory().has_error(), Eq(false));
+}
 } // namespace
@@ -19,8 +19,10 @@
 
 #include "test.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <cstring>
+#include <thread>
 
 namespace
 {
@@ -68,6 +70,16 @@ class RelativePointer_test : public Test
     uint8_t memoryPartition[NUMBER_OF_MEMORY_PARTITIONS][SHARED_MEMORY_SIZE]{{0}};
 };
 
+void* segmentOfUnregisteredSegmentHandler{nullptr};
+BaseRelativePointer::id_underlying_t idOfUnregisteredSegmentHandler{0U};
+
+void registerSegmentInUnregisteredSegmentHandler(const BaseRelativePointer::id_underlying_t id)
+{
+    idOfUnregisteredSegmentHandler = id;
+    BaseRelativePointer::registerPtr(
+        BaseRelativePointer::id_t{id}, segmentOfUnregisteredSegmentHandler, SHARED_MEMORY_SIZE);
+}
+
 typedef testing::Types<uint8_t, int8_t, double> Types;
 
 TYPED_TEST_SUITE(RelativePointer_test, Types, );
@@ -525,6 +537,72 @@ TYPED_TEST(RelativePointer_test, MemoryRemappingWorks)
     }
 }
 
+TYPED_TEST(RelativePointer_test, UnregisteredSegmentHandlerRegistersTheSegmentOfAResolvedPointer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4b6e1f0a-93d2-4c57-8e1b-0f7a2c9d6e34");
+    constexpr BaseRelativePointer::id_underlying_t ID{5U};
+    constexpr BaseRelativePointer::offset_t OFFSET{8U};
+    segmentOfUnregisteredSegmentHandler = this->partitionPtr(0U);
+    idOfUnregisteredSegmentHandler = 0U;
+    BaseRelativePointer::setUnregisteredSegmentHandler(&registerSegmentInUnregisteredSegmentHandler);
+
+    RelativePointer<TypeParam> sut(OFFSET, BaseRelativePointer::id_t{ID});
+
+    EXPECT_EQ(static_cast<void*>(sut.get()), static_cast<void*>(this->partitionPtr(0U) + OFFSET));
+    EXPECT_EQ(idOfUnregisteredSegmentHandler, ID);
+    BaseRelativePointer::setUnregisteredSegmentHandler(nullptr);
+}
+
+TYPED_TEST(RelativePointer_test, UnregisteredSegmentHandlerIsNotCalledForRegisteredSegments)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e2a9c4d7-1f36-4b8e-a05c-7d3b9e6f2a18");
+    constexpr BaseRelativePointer::id_underlying_t ID{5U};
+    constexpr BaseRelativePointer::offset_t OFFSET{8U};
+    segmentOfUnregisteredSegmentHandler = this->partitionPtr(1U);
+    idOfUnregisteredSegmentHandler = 0U;
+    EXPECT_TRUE(BaseRelativePointer::registerPtr(BaseRelativePointer::id_t{ID}, this->partitionPtr(0U)));
+    BaseRelativePointer::setUnregisteredSegmentHandler(&registerSegmentInUnregisteredSegmentHandler);
+
+    RelativePointer<TypeParam> sut(OFFSET, BaseRelativePointer::id_t{ID});
+
+    EXPECT_EQ(static_cast<void*>(sut.get()), static_cast<void*>(this->partitionPtr(0U) + OFFSET));
+    EXPECT_EQ(idOfUnregisteredSegmentHandler, 0U);
+    BaseRelativePointer::setUnregisteredSegmentHandler(nullptr);
+}
+
+TYPED_TEST(RelativePointer_test, PointersAreResolvedWhileAnotherThreadRegistersSegments)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9c2e5a71-4b8d-4f06-b3a9-e18d7c4f5260");
+    constexpr BaseRelativePointer::id_underlying_t ID{1U};
+    constexpr BaseRelativePointer::offset_t OFFSET{8U};
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) Used only for test purposes
+    auto* const pointee = reinterpret_cast<TypeParam*>(this->partitionPtr(0U) + OFFSET);
+    ASSERT_TRUE(
+        BaseRelativePointer::registerPtr(BaseRelativePointer::id_t{ID}, this->partitionPtr(0U), SHARED_MEMORY_SIZE));
+
+    constexpr uint64_t NUMBER_OF_REGISTRATIONS{1000U};
+    std::atomic_bool isRegistering{true};
+    std::thread registerer([&] {
+        for (uint64_t i = 0U; i < NUMBER_OF_REGISTRATIONS; ++i)
+        {
+            const BaseRelativePointer::id_t id{ID + 1U + i % 8U};
+            BaseRelativePointer::registerPtr(id, this->partitionPtr(1U), SHARED_MEMORY_SIZE);
+            BaseRelativePointer::unregisterPtr(id);
+        }
+        isRegistering = false;
+    });
+
+    bool isResolvedCorrectly{true};
+    while (isRegistering && isResolvedCorrectly)
+    {
+        RelativePointer<TypeParam> sut(pointee);
+        isResolvedCorrectly = (sut.getId() == ID) && (sut.get() == pointee);
+    }
+    registerer.join();
+
+    EXPECT_TRUE(isResolvedCorrectly);
+}
+
 TYPED_TEST(RelativePointer_test, DefaultConstructedRelativePtrIsNull)
 {
     ::testing::Test::RecordProperty("TEST_ID", "be25f19c-912c-438e-97b1-6fcacb879453");
@@ -28,6 +28,7 @@ option(COVERAGE "Build iceoryx with gcov flags" OFF)
 option(DOWNLOAD_TOML_LIB "Download cpptoml via the CMake ExternalProject module" ON)
 option(EXAMPLES "Build all iceoryx examples" OFF)
 option(INTROSPECTION "Builds the introspection client which requires the ncurses library with an activated terminfo feature" OFF)
+option(MEMPOOL_TUNER "Builds the tool which derives the mempool configuration from the mempool introspection" OFF)
 option(ONE_TO_MANY_ONLY "Restricts communication to 1:n pattern" OFF)
 set(IOX_PLATFORM_PATH "" CACHE PATH "Overrides integrated platform detection and uses provided custom path")
 option(ROUDI_ENVIRONMENT "Build RouDi Environment for testing, is enabled when building tests" OFF)
@@ -41,6 +42,7 @@ if(BUILD_ALL)
   set(EXAMPLES ON)
   set(BUILD_TEST ON)
   set(INTROSPECTION ON)
+  set(MEMPOOL_TUNER ON)
   set(BINDING_C ON)
 endif()
 
@@ -83,6 +85,7 @@ function(show_config_options)
   message("          DOWNLOAD_TOML_LIB....................: " ${DOWNLOAD_TOML_LIB})
   message("          EXAMPLES.............................: " ${EXAMPLES})
   message("          INTROSPECTION........................: " ${INTROSPECTION})
+  message("          MEMPOOL_TUNER........................: " ${MEMPOOL_TUNER})
   message("          ONE_TO_MANY_ONLY ....................: " ${ONE_TO_MANY_ONLY})
   message("          IOX_PLATFORM_PATH....................: " ${IOX_PLATFORM_PATH})
   message("          ROUDI_ENVIRONMENT....................: " ${ROUDI_ENVIRONMENT} ${ROUDI_ENV_HINT})
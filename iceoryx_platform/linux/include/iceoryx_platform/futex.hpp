@@ -0,0 +1,38 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_LINUX_PLATFORM_FUTEX_HPP
+#define IOX_HOOFS_LINUX_PLATFORM_FUTEX_HPP
+
+#include <cstdint>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/// @brief blocks as long as the value at futexWord equals expectedValue, the futex is not private and can therefore
+/// be used across process boundaries
+inline int iox_futex_wait(uint32_t* futexWord, uint32_t expectedValue, const struct timespec* relativeTimeout)
+{
+    return static_cast<int>(syscall(SYS_futex, futexWord, FUTEX_WAIT, expectedValue, relativeTimeout, nullptr, 0));
+}
+
+/// @brief wakes up to numberOfWaiters threads which are blocked in iox_futex_wait on futexWord
+inline int iox_futex_wake(uint32_t* futexWord, int numberOfWaiters)
+{
+    return static_cast<int>(syscall(SYS_futex, futexWord, FUTEX_WAKE, numberOfWaiters, nullptr, nullptr, 0));
+}
+
+#endif // IOX_HOOFS_LINUX_PLATFORM_FUTEX_HPP
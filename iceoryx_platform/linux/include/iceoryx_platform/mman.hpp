@@ -17,9 +17,14 @@
 #ifndef IOX_HOOFS_LINUX_PLATFORM_MMAN_HPP
 #define IOX_HOOFS_LINUX_PLATFORM_MMAN_HPP
 
+#include <linux/mempolicy.h>
 #include <sys/mman.h>
 
 int iox_shm_open(const char* name, int oflag, mode_t mode);
 int iox_shm_unlink(const char* name);
+int iox_mbind(
+    void* addr, unsigned long len, int mode, const unsigned long* nodemask, unsigned long maxnode, unsigned int flags);
+/// faults in the pages of a shared mapping for writing without changing their content
+int iox_populate_write(void* addr, size_t len);
 
 #endif // IOX_HOOFS_LINUX_PLATFORM_MMAN_HPP
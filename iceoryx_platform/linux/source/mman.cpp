@@ -16,6 +16,14 @@
 
 #include "iceoryx_platform/mman.hpp"
 
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// defined by the kernel headers since Linux 5.14
+#ifndef MADV_POPULATE_WRITE
+#define MADV_POPULATE_WRITE 23
+#endif
+
 // NOLINTNEXTLINE(readability-identifier-naming)
 int iox_shm_open(const char* name, int oflag, mode_t mode)
 {
@@ -27,3 +35,18 @@ int iox_shm_unlink(const char* name)
 {
     return shm_unlink(name);
 }
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_mbind(
+    void* addr, unsigned long len, int mode, const unsigned long* nodemask, unsigned long maxnode, unsigned int flags)
+{
+    // glibc provides no wrapper, the one of libnuma would add a dependency
+    return static_cast<int>(syscall(SYS_mbind, addr, len, mode, nodemask, maxnode, flags));
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_populate_write(void* addr, size_t len)
+{
+    // older kernels fail with EINVAL
+    return madvise(addr, len, MADV_POPULATE_WRITE);
+}
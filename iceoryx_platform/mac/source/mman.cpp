@@ -37,3 +37,17 @@ int iox_shm_unlink(const char* name)
     }
     return state;
 }
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_mbind(void*, unsigned long, int, const unsigned long*, unsigned long, unsigned int)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_populate_write(void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
@@ -0,0 +1,38 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_QNX_PLATFORM_FUTEX_HPP
+#define IOX_HOOFS_QNX_PLATFORM_FUTEX_HPP
+
+#include "iceoryx_platform/errno.hpp"
+
+#include <cstdint>
+#include <ctime>
+
+/// @brief futexes are not supported on this platform, see IOX_SUPPORT_FUTEX
+inline int iox_futex_wait(uint32_t*, uint32_t, const struct timespec*)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+/// @brief futexes are not supported on this platform, see IOX_SUPPORT_FUTEX
+inline int iox_futex_wake(uint32_t*, int)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+#endif // IOX_HOOFS_QNX_PLATFORM_FUTEX_HPP
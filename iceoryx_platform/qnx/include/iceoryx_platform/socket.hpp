@@ -28,5 +28,6 @@ iox_sendto(int sockfd, const void* buf, size_t len, int flags, const struct sock
 ssize_t iox_recvfrom(int sockfd, void* buf, size_t len, int flags, struct sockaddr* src_addr, socklen_t* addrlen);
 int iox_connect(int sockfd, const struct sockaddr* addr, socklen_t addrlen);
 int iox_closesocket(int sockfd);
+int iox_setsocketnonblocking(int sockfd);
 
 #endif // IOX_HOOFS_QNX_PLATFORM_SOCKET_HPP
@@ -16,6 +16,8 @@
 
 #include "iceoryx_platform/mman.hpp"
 
+#include <errno.h>
+
 int iox_shm_open(const char* name, int oflag, mode_t mode)
 {
     return shm_open(name, oflag, mode);
@@ -25,3 +27,17 @@ int iox_shm_unlink(const char* name)
 {
     return shm_unlink(name);
 }
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_mbind(void*, unsigned long, int, const unsigned long*, unsigned long, unsigned int)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_populate_write(void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
@@ -15,6 +15,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_platform/socket.hpp"
+#include <fcntl.h>
 #include <unistd.h>
 
 // NOLINTNEXTLINE(readability-identifier-naming)
@@ -59,3 +60,15 @@ int iox_closesocket(int sockfd)
 {
     return close(sockfd);
 }
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_setsocketnonblocking(int sockfd)
+{
+    int flags = fcntl(sockfd, F_GETFL, 0);
+    if (flags == -1)
+    {
+        return -1;
+    }
+    // NOLINTNEXTLINE(hicpp-signed-bitwise) O_NONBLOCK is defined by POSIX as int
+    return fcntl(sockfd, F_SETFL, flags | O_NONBLOCK);
+}
@@ -42,7 +42,19 @@ void* mmap(void* addr, size_t length, int prot, int flags, int fd, off_t offset)
 
 int munmap(void* addr, size_t length);
 
+int mlock(const void* addr, size_t len);
+
 int iox_shm_open(const char* name, int oflag, mode_t mode);
 
 int iox_shm_unlink(const char* name);
+
+/// NUMA memory policies are not supported, iox_mbind fails with ENOSYS
+#define MPOL_DEFAULT 0
+#define MPOL_PREFERRED 1
+#define MPOL_BIND 2
+#define MPOL_INTERLEAVE 3
+int iox_mbind(
+    void* addr, unsigned long len, int mode, const unsigned long* nodemask, unsigned long maxnode, unsigned int flags);
+/// populating a mapping is not supported, iox_populate_write fails with ENOSYS
+int iox_populate_write(void* addr, size_t len);
 #endif // IOX_HOOFS_WIN_PLATFORM_MMAN_HPP
@@ -17,5 +17,18 @@
 #ifndef IOX_HOOFS_WIN_PLATFORM_RESOURCE_HPP
 #define IOX_HOOFS_WIN_PLATFORM_RESOURCE_HPP
 
+#include <cstdint>
+
+/// resource limits are not supported, getrlimit fails with ENOSYS
+#define RLIMIT_MEMLOCK 8
+#define RLIM_INFINITY UINT64_MAX
+using rlim_t = uint64_t;
+struct rlimit
+{
+    rlim_t rlim_cur;
+    rlim_t rlim_max;
+};
+
+int getrlimit(int resource, struct rlimit* rlim);
 
 #endif // IOX_HOOFS_WIN_PLATFORM_RESOURCE_HPP
@@ -82,6 +82,17 @@ int munmap(void* addr, size_t length)
     return -1;
 }
 
+int mlock(const void* addr, size_t len)
+{
+    // the pages are locked in the working set of the process, its size limits the lockable memory
+    if (VirtualLock(const_cast<void*>(addr), len) == 0)
+    {
+        errno = ENOMEM;
+        return -1;
+    }
+    return 0;
+}
+
 int iox_shm_open(const char* name, int oflag, mode_t mode)
 {
     HANDLE sharedMemoryHandle{nullptr};
@@ -172,3 +183,17 @@ int iox_shm_unlink(const char* name)
     errno = ENOENT;
     return -1;
 }
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_mbind(void*, unsigned long, int, const unsigned long*, unsigned long, unsigned int)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_populate_write(void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
@@ -59,3 +59,9 @@ int iox_closesocket(int sockfd)
     fprintf(stderr, "%s is not implemented in windows!\n", __PRETTY_FUNCTION__);
     return 0;
 }
+
+int iox_setsocketnonblocking(int sockfd)
+{
+    u_long isNonBlocking{1U};
+    return (ioctlsocket(static_cast<SOCKET>(sockfd), FIONBIO, &isNonBlocking) == 0) ? 0 : -1;
+}
@@ -77,6 +77,10 @@ namespace iox
     error(POPO__BASE_SERVER_OVERRIDING_WITH_EVENT_SINCE_HAS_REQUEST_OR_REQUEST_RECEIVED_ALREADY_ATTACHED) \
     error(POPO__BASE_SERVER_OVERRIDING_WITH_STATE_SINCE_HAS_REQUEST_OR_REQUEST_RECEIVED_ALREADY_ATTACHED) \
     error(POPO__CHUNK_QUEUE_POPPER_CHUNK_WITH_INCOMPATIBLE_CHUNK_HEADER_VERSION) \
+    error(POPO__CHUNK_QUEUE_POPPER_SEMAPHORE_CORRUPTED_IN_NOTIFY) \
+    error(POPO__CHUNK_QUEUE_PUSHER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT) \
+    error(POPO__CHUNK_QUEUE_PUSHER_SEMAPHORE_CORRUPTED_IN_POST) \
+    error(POPO__CHUNK_QUEUE_DATA_FAILED_TO_CREATE_SEMAPHORE) \
     error(POPO__CHUNK_DISTRIBUTOR_OVERFLOW_OF_QUEUE_CONTAINER) \
     error(POPO__CHUNK_DISTRIBUTOR_CLEANUP_DEADLOCK_BECAUSE_BAD_APPLICATION_TERMINATION) \
     error(POPO__CHUNK_SENDER_INVALID_CHUNK_TO_FREE_FROM_USER) \
@@ -101,6 +105,11 @@ namespace iox
     error(POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_DESTROY) \
     error(POPO__CONDITION_NOTIFIER_INDEX_TOO_LARGE) \
     error(POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY) \
+    error(POPO__DELIVERY_THREAD_POOL_FAILED_TO_CREATE_SEMAPHORE) \
+    error(POPO__DELIVERY_THREAD_POOL_SEMAPHORE_CORRUPTED) \
+    error(POPO__LISTENER_TOO_MANY_WORKER_THREADS) \
+    error(POPO__LISTENER_WORKER_POOL_FAILED_TO_CREATE_SEMAPHORE) \
+    error(POPO__LISTENER_WORKER_POOL_SEMAPHORE_CORRUPTED) \
     error(POPO__NOTIFICATION_INFO_TYPE_INCONSISTENCY_IN_GET_ORIGIN) \
     error(POPO__TRIGGER_INVALID_RESET_CALLBACK) \
     error(POPO__TRIGGER_INVALID_HAS_TRIGGERED_CALLBACK) \
@@ -113,11 +122,13 @@ namespace iox
     error(MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS) \
     error(MEPOO__MEMPOOL_CHUNKSIZE_MUST_BE_MULTIPLE_OF_CHUNK_MEMORY_ALIGNMENT) \
     error(MEPOO__MEMPOOL_ADDMEMPOOL_AFTER_GENERATECHUNKMANAGEMENTPOOL) \
+    error(MEPOO__MEMPOOL_INVALID_EXTENSION) \
     error(MEPOO__TYPED_MEMPOOL_HAS_INCONSISTENT_STATE) \
     error(MEPOO__TYPED_MEMPOOL_MANAGEMENT_SEGMENT_IS_BROKEN) \
     error(MEPOO__USER_WITH_MORE_THAN_ONE_WRITE_SEGMENT) \
     error(MEPOO__SEGMENT_COULD_NOT_APPLY_POSIX_RIGHTS_TO_SHARED_MEMORY) \
     error(MEPOO__SEGMENT_UNABLE_TO_CREATE_SHARED_MEMORY_OBJECT) \
+    error(MEPOO__SEGMENT_UNABLE_TO_LOCK_SHARED_MEMORY_OBJECT) \
     error(MEPOO__INTROSPECTION_CONTAINER_FULL) \
     error(MEPOO__CANNOT_ALLOCATE_CHUNK) \
     error(MEPOO__MAXIMUM_NUMBER_OF_MEMPOOLS_REACHED) \
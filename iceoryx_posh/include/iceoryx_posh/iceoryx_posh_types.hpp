@@ -66,10 +66,10 @@ constexpr uint32_t MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY =
     build::IOX_MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY;
 constexpr uint32_t MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY;
 // Introspection is using the following publisherPorts, which reduced the number of ports available for the user
-// 1x publisherPort mempool introspection
+// 2x publisherPort mempool introspection
 // 1x publisherPort process introspection
 // 3x publisherPort port introspection
-constexpr uint32_t PUBLISHERS_RESERVED_FOR_INTROSPECTION = 5;
+constexpr uint32_t PUBLISHERS_RESERVED_FOR_INTROSPECTION = 6;
 constexpr uint32_t PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY = 1;
 constexpr uint32_t NUMBER_OF_INTERNAL_PUBLISHERS =
     PUBLISHERS_RESERVED_FOR_INTROSPECTION + PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY;
@@ -106,11 +106,16 @@ constexpr uint32_t MAX_NUMBER_OF_NOTIFIERS = build::IOX_MAX_NUMBER_OF_NOTIFIERS;
 /// the variable above must be increased
 constexpr uint32_t MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET = MAX_NUMBER_OF_NOTIFIERS;
 constexpr uint32_t MAX_NUMBER_OF_EVENTS_PER_LISTENER = MAX_NUMBER_OF_NOTIFIERS;
+constexpr uint32_t MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER = 16U;
+/// @brief the maximum number of threads which help a publisher to deliver to many subscribers in parallel
+constexpr uint32_t MAX_NUMBER_OF_DELIVERY_THREADS = 4U;
 //--------- Communication Resources End---------------------
 
 // Memory
 constexpr uint32_t MAX_NUMBER_OF_MEMPOOLS = 32U;
 constexpr uint32_t MAX_SHM_SEGMENTS = 100U;
+/// @brief the max number of shared memory segments which can be added to a payload segment at runtime
+constexpr uint32_t MAX_NUMBER_OF_SEGMENT_EXTENSIONS = 4U;
 
 constexpr uint32_t MAX_NUMBER_OF_MEMORY_PROVIDER = 8U;
 constexpr uint32_t MAX_NUMBER_OF_MEMORY_BLOCKS_PER_MEMORY_PROVIDER = 64U;
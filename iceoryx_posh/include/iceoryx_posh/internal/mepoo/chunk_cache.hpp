@@ -0,0 +1,121 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_MEPOO_CHUNK_CACHE_HPP
+#define IOX_POSH_MEPOO_CHUNK_CACHE_HPP
+
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+class MemPool;
+
+/// @brief The allocation state of one producer. It remembers the mempool which was resolved for the last requested
+/// chunk size, producers with a fixed chunk size like typed publishers therefore skip the mempool lookup. When it is
+/// refilled in batches it is additionally a small stack of chunks of a single mempool, together with the memory for
+/// their ChunkManagement, and the shared free lists of the mempools are only touched once per CAPACITY allocations.
+/// The chunks in the cache are not free from the mempool's point of view, they are returned with drain. The cache
+/// lives in shared memory, therefore RouDi can drain it when the owner is gone. The free lists write the indices of a
+/// batch directly into the cache, a refill which is interrupted by a crash is therefore drained as well. The
+/// allocations are counted in the cache as well and are added to the allocation size histogram of the mempool whenever
+/// the cache accesses the mempools, a cache hit therefore does not write to the mempool at all.
+/// @note the ChunkCache is not thread-safe, it must be used by a single producer
+class ChunkCache
+{
+  public:
+    /// @brief the max number of chunks which are held by the cache
+    static constexpr uint32_t CAPACITY{8U};
+
+    /// @brief creates an empty ChunkCache
+    /// @param[in] isRefilledInBatches if true the cache holds up to CAPACITY chunks, otherwise every chunk is taken
+    /// directly from the mempools
+    explicit ChunkCache(const bool isRefilledInBatches = true) noexcept;
+    ChunkCache(const ChunkCache&) = delete;
+    ChunkCache(ChunkCache&&) = delete;
+    ChunkCache& operator=(const ChunkCache&) = delete;
+    ChunkCache& operator=(ChunkCache&&) = delete;
+    ~ChunkCache() noexcept = default;
+
+    /// @brief takes a chunk of memPool and the memory for its ChunkManagement from the cache; when the cache is empty
+    /// or holds chunks of another mempool it is first refilled with one batch from the mempools, without batches the
+    /// chunks are taken directly from the mempools
+    /// @param[in] memPool the mempool of the requested chunk
+    /// @param[in] chunkManagementPool the mempool for the ChunkManagement
+    /// @param[out] chunk the memory for the chunk
+    /// @param[out] chunkManagement the memory for the ChunkManagement of the chunk
+    /// @return true if a chunk was taken, false if one of the mempools is exhausted
+    bool take(MemPool& memPool, MemPool& chunkManagementPool, void*& chunk, void*& chunkManagement) noexcept;
+
+    /// @brief returns all cached chunks to their mempools and adds the counted allocations to the histogram
+    void drain() noexcept;
+
+    /// @brief counts the required chunk size of an allocation for which memPool was the best fit; the count is added
+    /// to the histogram of memPool with the next access to the mempools, at the latest after CAPACITY allocations
+    /// @param[in] memPool the best fitting mempool of the allocation
+    /// @param[in] requiredChunkSize the required chunk size of the allocation, at most the chunk size of memPool
+    void recordAllocation(MemPool& memPool, const uint32_t requiredChunkSize) noexcept;
+
+    /// @brief returns the number of cached chunks
+    uint32_t size() const noexcept;
+
+    /// @brief returns the index of the mempool which was resolved for the required chunk size of the last allocation
+    /// @param[in] requiredChunkSize the required chunk size of the current allocation
+    /// @param[in] numberOfMemPools the current number of mempools, it grows when mempools are added at runtime
+    /// @return the index of the mempool if the last allocation required the same chunk size and saw the same mempools,
+    /// otherwise nullopt
+    cxx::optional<uint32_t> resolvedMemPoolIndex(const uint32_t requiredChunkSize,
+                                                 const uint32_t numberOfMemPools) const noexcept;
+
+    /// @brief remembers the mempool which was resolved for a required chunk size
+    /// @param[in] requiredChunkSize the required chunk size of the allocation
+    /// @param[in] numberOfMemPools the number of mempools which were considered for the resolution
+    /// @param[in] memPoolIndex the index of the mempool which serves this chunk size
+    void setResolvedMemPoolIndex(const uint32_t requiredChunkSize,
+                                 const uint32_t numberOfMemPools,
+                                 const uint32_t memPoolIndex) noexcept;
+
+  private:
+    void refill(MemPool& memPool, MemPool& chunkManagementPool) noexcept;
+    void flushRecordedAllocations() noexcept;
+
+  private:
+    bool m_isRefilledInBatches{true};
+    uint32_t m_resolvedChunkSize{0U};
+    uint32_t m_resolvedNumberOfMemPools{0U};
+    uint32_t m_resolvedMemPoolIndex{0U};
+    rp::RelativePointer<MemPool> m_memPool;
+    rp::RelativePointer<MemPool> m_chunkManagementPool;
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    uint32_t m_chunkIndices[CAPACITY];
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    uint32_t m_chunkManagementIndices[CAPACITY];
+    /// @brief both are equal except during a refill, when the chunks are already taken but not yet their
+    /// ChunkManagement
+    uint32_t m_numberOfChunks{0U};
+    uint32_t m_numberOfChunkManagements{0U};
+    rp::RelativePointer<MemPool> m_recordedMemPool;
+    uint32_t m_recordedChunkSize{0U};
+    uint64_t m_numberOfRecordedAllocations{0U};
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_CHUNK_CACHE_HPP
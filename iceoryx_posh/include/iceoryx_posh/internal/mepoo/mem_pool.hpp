@@ -18,9 +18,11 @@
 #define IOX_POSH_MEPOO_MEM_POOL_HPP
 
 #include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/internal/concurrent/cache_line_padding.hpp"
 #include "iceoryx_hoofs/internal/concurrent/loffli.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
 #include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
+#include "iceoryx_posh/mepoo/allocation_size_histogram.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 
 #include <atomic>
@@ -36,12 +38,18 @@ struct MemPoolInfo
     MemPoolInfo(const uint32_t usedChunks,
                 const uint32_t minFreeChunks,
                 const uint32_t numChunks,
-                const uint32_t chunkSize) noexcept;
+                const uint32_t chunkSize,
+                const uint64_t numberOfFallbacks) noexcept;
 
     uint32_t m_usedChunks{0};
     uint32_t m_minFreeChunks{0};
     uint32_t m_numChunks{0};
     uint32_t m_chunkSize{0};
+    uint64_t m_numberOfFallbacks{0};
+    /// @brief the number of allocations which failed since neither this mempool nor a fallback had a free chunk
+    uint64_t m_numberOfFailedAllocations{0};
+    /// @brief the required chunk sizes of the allocations for which this mempool was the best fit
+    AllocationSizeHistogram m_allocationSizeHistogram;
 };
 
 class MemPool
@@ -49,6 +57,8 @@ class MemPool
   public:
     using freeList_t = concurrent::LoFFLi;
     static constexpr uint64_t CHUNK_MEMORY_ALIGNMENT = 8U; // default alignment for 64 bit
+    /// @brief the max number of chunks which are obtained or freed with one operation on the free list
+    static constexpr uint32_t MAX_CHUNKS_PER_BATCH{16U};
 
     MemPool(const cxx::greater_or_equal<uint32_t, CHUNK_MEMORY_ALIGNMENT> chunkSize,
             const cxx::greater_or_equal<uint32_t, 1> numberOfChunks,
@@ -67,25 +77,80 @@ class MemPool
     uint32_t getMinFree() const noexcept;
     MemPoolInfo getInfo() const noexcept;
 
+    /// @brief counts a chunk which was taken from a larger mempool since this one was exhausted
+    void increaseNumberOfFallbacks() noexcept;
+    /// @brief returns the number of chunks which were taken from a larger mempool since this one was exhausted
+    uint64_t getNumberOfFallbacks() const noexcept;
+
+    /// @brief counts the required chunk size of allocations for which this mempool was the best fit, regardless
+    /// whether the chunk was finally taken from this mempool, a fallback or none at all
+    /// @param[in] requiredChunkSize the required chunk size of the allocations, at most the chunk size of this mempool
+    /// @param[in] numberOfAllocations the number of allocations with this required chunk size
+    void recordAllocation(const uint32_t requiredChunkSize, const uint64_t numberOfAllocations = 1U) noexcept;
+    /// @brief counts an allocation which failed since neither this mempool nor a fallback had a free chunk
+    void increaseNumberOfFailedAllocations() noexcept;
+    /// @brief returns the number of allocations which failed since neither this mempool nor a fallback had a free chunk
+    uint64_t getNumberOfFailedAllocations() const noexcept;
+
     void freeChunk(const void* chunk) noexcept;
 
+    /// @brief obtains up to numberOfChunks chunks with a single operation on the free list
+    /// @param[out] chunks memory for at least numberOfChunks pointers, the obtained chunks are stored at the front
+    /// @param[in] numberOfChunks the max number of chunks, limited to MAX_CHUNKS_PER_BATCH
+    /// @return the number of obtained chunks, 0 if the mempool is exhausted
+    uint32_t getChunks(cxx::not_null<void**> chunks, const uint32_t numberOfChunks) noexcept;
+
+    /// @brief returns chunks with one operation on the free list per MAX_CHUNKS_PER_BATCH chunks
+    /// @param[in] chunks the chunks which were obtained from this mempool
+    /// @param[in] numberOfChunks the number of chunks
+    void freeChunks(cxx::not_null<void* const*> chunks, const uint32_t numberOfChunks) noexcept;
+
+    /// @brief obtains up to numberOfChunks chunks with a single operation on the free list; the free list writes the
+    /// indices of the chunks directly to chunkIndices, when it is in shared memory the chunks are therefore already
+    /// recorded there and not only on the stack of the caller
+    /// @param[out] chunkIndices memory for at least numberOfChunks indices, the obtained ones are stored at the front
+    /// @param[in] numberOfChunks the max number of chunks, limited to MAX_CHUNKS_PER_BATCH
+    /// @return the number of obtained chunks, 0 if the mempool is exhausted
+    uint32_t getChunkIndices(cxx::not_null<uint32_t*> chunkIndices, const uint32_t numberOfChunks) noexcept;
+
+    /// @brief returns chunks which were obtained with getChunkIndices with a single operation on the free list
+    /// @param[in] chunkIndices the indices of the chunks
+    /// @param[in] numberOfChunks the number of chunks
+    void freeChunkIndices(cxx::not_null<const uint32_t*> chunkIndices, const uint32_t numberOfChunks) noexcept;
+
+    /// @brief returns the chunk with the given index
+    /// @param[in] chunkIndex the index of a chunk which was obtained with getChunkIndices
+    void* chunkOfIndex(const uint32_t chunkIndex) const noexcept;
+
   private:
     void adjustMinFree() noexcept;
     bool isMultipleOfAlignment(const uint32_t value) const noexcept;
+    uint32_t indexOfChunk(const void* chunk) const noexcept;
 
+    /// @brief only written when the mempool is created
     rp::RelativePointer<uint8_t> m_rawMemory;
 
     uint32_t m_chunkSize{0U};
     /// needs to be 32 bit since loffli supports only 32 bit numbers
     /// (cas is only 64 bit and we need the other 32 bit for the aba counter)
     uint32_t m_numberOfChunks{0U};
+    concurrent::CacheLinePadding m_setupPadding;
 
+    /// @brief the statistics are written with every allocation and read by the introspection of RouDi
     /// @todo: put this into one struct and in a separate class in concurrent.
     std::atomic<uint32_t> m_usedChunks{0U};
     std::atomic<uint32_t> m_minFree{0U};
+    std::atomic<uint64_t> m_numberOfFallbacks{0U};
+    std::atomic<uint64_t> m_numberOfFailedAllocations{0U};
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    std::atomic<uint64_t> m_allocationSizeCounts[AllocationSizeHistogram::NUMBER_OF_BUCKETS]{};
     /// @todo: end
+    concurrent::CacheLinePadding m_statisticsPadding;
 
+    /// @brief the head of the free list is written with every allocation and deallocation
     freeList_t m_freeIndices;
+    /// @brief the next mempool of the MemoryManager starts behind this padding
+    concurrent::CacheLinePadding m_freeIndicesPadding;
 };
 
 } // namespace mepoo
@@ -18,12 +18,16 @@
 #define IOX_POSH_MEPOO_MEMORY_MANAGER_HPP
 
 #include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_cache.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <limits>
 
@@ -39,8 +43,6 @@ class LogStream;
 }
 namespace mepoo
 {
-struct MePooConfig;
-
 class MemoryManager
 {
     using MaxChunkPayloadSize_t = cxx::range<uint32_t, 1, std::numeric_limits<uint32_t>::max() - sizeof(ChunkHeader)>;
@@ -53,6 +55,18 @@ class MemoryManager
         MEMPOOL_OUT_OF_CHUNKS,
     };
 
+    /// @brief the reasons why mempools cannot be added at runtime
+    enum class ExtensionError
+    {
+        /// @brief there are no mempools or one of them has no chunks or a size which is not a multiple of
+        /// CHUNK_MEMORY_ALIGNMENT
+        INVALID_MEMPOOL_CONFIG,
+        /// @brief together with the existing mempools there would be more than MAX_NUMBER_OF_MEMPOOLS
+        MEMPOOL_LIMIT_EXCEEDED,
+        /// @brief the mempools have more chunks than are left of the reserved extension chunks
+        CHUNK_LIMIT_EXCEEDED,
+    };
+
     MemoryManager() noexcept = default;
     MemoryManager(const MemoryManager&) = delete;
     MemoryManager(MemoryManager&&) = delete;
@@ -64,21 +78,79 @@ class MemoryManager
                                 posix::Allocator& managementAllocator,
                                 posix::Allocator& chunkMemoryAllocator) noexcept;
 
-    /// @brief Obtains a chunk from the mempools
+    /// @brief Obtains a chunk from the smallest fitting mempool, when it is exhausted the chunk is taken from a larger
+    /// mempool according to the MemPoolFallbackPolicy of the MePooConfig
     /// @param[in] chunkSettings for the requested chunk
     /// @return a SharedChunk if successful, otherwise a MemoryManager::Error
     cxx::expected<SharedChunk, Error> getChunk(const ChunkSettings& chunkSettings) noexcept;
 
+    /// @brief Obtains a chunk via the ChunkCache of a producer, which remembers the mempool of the last chunk size and
+    /// may be refilled in batches from the mempools
+    /// @param[in] chunkSettings for the requested chunk
+    /// @param[in] chunkCache of the producer, it must only be used by one thread at a time
+    /// @return a SharedChunk if successful, otherwise a MemoryManager::Error
+    cxx::expected<SharedChunk, Error> getChunk(const ChunkSettings& chunkSettings, ChunkCache& chunkCache) noexcept;
+
+    /// @brief checks whether the mempools of a MePooConfig can be added at runtime
+    /// @param[in] extensionConfig the mempools which shall be added, they may have any order and chunk sizes of
+    /// existing mempools
+    /// @return an ExtensionError if the mempools do not fit to the reserved extension chunks or mempools
+    cxx::expected<ExtensionError> verifyExtensionMemPools(const MePooConfig& extensionConfig) const noexcept;
+
+    /// @brief adds mempools at runtime, the chunk management and free lists use the memory which was reserved for the
+    /// m_maxNumberOfExtensionChunks of the MePooConfig. The mempools are used when they fit a chunk better than the
+    /// existing ones or when the mempools with the same chunk size are exhausted.
+    /// @param[in] extensionConfig the mempools to add, they must pass verifyExtensionMemPools
+    /// @param[in] chunkMemoryAllocator provides the memory of the chunks, usually an additional segment
+    /// @note must not be called concurrently, concurrent calls of getChunk are allowed
+    void addExtensionMemPools(const MePooConfig& extensionConfig, posix::Allocator& chunkMemoryAllocator) noexcept;
+
+    /// @brief returns the number of mempools including the ones which were added at runtime
     uint32_t getNumberOfMemPools() const noexcept;
 
+    /// @brief returns the MemPoolInfo of a mempool, the indices behind the configured mempools refer to the mempools
+    /// which were added at runtime
     MemPoolInfo getMemPoolInfo(const uint32_t index) const noexcept;
 
     static uint64_t requiredChunkMemorySize(const MePooConfig& mePooConfig) noexcept;
     static uint64_t requiredManagementMemorySize(const MePooConfig& mePooConfig) noexcept;
     static uint64_t requiredFullMemorySize(const MePooConfig& mePooConfig) noexcept;
 
+    /// @brief returns the size of the management memory which is reserved for the free lists of mempools which are
+    /// added at runtime
+    /// @param[in] numberOfExtensionChunks the number of chunks all these mempools together may have
+    /// @return the size in bytes
+    static uint64_t requiredExtensionManagementMemorySize(const uint64_t numberOfExtensionChunks) noexcept;
+
   private:
+    /// @brief the size classes of the chunk sizes, the size class of a chunk size is ceil(log2(size)), therefore
+    /// every uint32_t chunk size has one of 33 size classes
+    static constexpr uint32_t NUMBER_OF_SIZE_CLASSES{33U};
+
     static uint32_t sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t size) noexcept;
+    static uint32_t sizeClass(const uint32_t chunkSize) noexcept;
+
+    /// @brief looks up the mempool with the smallest chunks which fit the required chunk size, of mempools with the
+    /// same chunk size the one which was added first is taken
+    /// @param[in] requiredChunkSize the chunk size of the allocation
+    /// @param[in] numberOfMemPools the number of mempools including the ones which were added at runtime
+    /// @return the index of the mempool, numberOfMemPools if none of them fits
+    uint32_t memPoolIndexForChunkSize(const uint32_t requiredChunkSize, const uint32_t numberOfMemPools) const noexcept;
+
+    /// @brief returns the mempool with an index below getNumberOfMemPools
+    MemPool& memPool(const uint32_t index) noexcept;
+    const MemPool& memPool(const uint32_t index) const noexcept;
+
+    /// @brief takes a chunk from the mempools which serve the chunks of an exhausted mempool, these are the mempools
+    /// with the same chunk size and the larger ones which are allowed by the MemPoolFallbackPolicy; they are visited
+    /// by increasing chunk size
+    /// @param[in] exhaustedMemPool the mempool which has no free chunks
+    /// @param[in] numberOfMemPools the number of mempools including the ones which were added at runtime
+    /// @param[out] fallbackMemPool the mempool of the chunk
+    /// @return the chunk or nullptr if all these mempools are exhausted as well
+    void* getChunkFromFallbackMemPools(MemPool& exhaustedMemPool,
+                                       const uint32_t numberOfMemPools,
+                                       MemPool*& fallbackMemPool) noexcept;
 
     void printMemPoolVector(log::LogStream& log) const noexcept;
     void addMemPool(posix::Allocator& managementAllocator,
@@ -86,13 +158,27 @@ class MemoryManager
                     const cxx::greater_or_equal<uint32_t, MemPool::CHUNK_MEMORY_ALIGNMENT> chunkPayloadSize,
                     const cxx::greater_or_equal<uint32_t, 1> numberOfChunks) noexcept;
     void generateChunkManagementPool(posix::Allocator& managementAllocator) noexcept;
+    cxx::expected<SharedChunk, Error> getChunkImpl(const ChunkSettings& chunkSettings,
+                                                   ChunkCache* const chunkCache) noexcept;
 
   private:
     bool m_denyAddMemPool{false};
+    MemPoolFallbackPolicy m_fallbackPolicy{MemPoolFallbackPolicy::STRICT};
     uint32_t m_totalNumberOfChunks{0};
 
     cxx::vector<MemPool, MAX_NUMBER_OF_MEMPOOLS> m_memPoolVector;
+    /// @brief the mempools which were added at runtime, the applications only access the first
+    /// m_numberOfExtensionMemPools of them
+    cxx::vector<MemPool, MAX_NUMBER_OF_MEMPOOLS> m_extensionMemPools;
+    std::atomic<uint32_t> m_numberOfExtensionMemPools{0U};
+    uint32_t m_numberOfFreeExtensionChunks{0U};
+    /// @brief provides the reserved memory for the free lists of the mempools which are added at runtime, it is only
+    /// used by RouDi
+    cxx::optional<posix::Allocator> m_extensionManagementAllocator;
     cxx::vector<MemPool, 1> m_chunkManagementPool;
+    /// @brief the index of the first mempool whose chunks are larger than the lower bound of each size class, it is
+    /// built in generateChunkManagementPool when no more mempools are added
+    cxx::vector<uint32_t, NUMBER_OF_SIZE_CLASSES> m_firstMemPoolOfSizeClass;
 };
 
 /// @brief Converts the MemoryManager::Error to a string literal
@@ -100,6 +186,11 @@ class MemoryManager
 /// @return pointer to a string literal
 inline constexpr const char* asStringLiteral(const MemoryManager::Error value) noexcept;
 
+/// @brief Converts the MemoryManager::ExtensionError to a string literal
+/// @param[in] value to convert to a string literal
+/// @return pointer to a string literal
+inline constexpr const char* asStringLiteral(const MemoryManager::ExtensionError value) noexcept;
+
 /// @brief Convenience stream operator to easily use the `asStringLiteral` function with std::ostream
 /// @param[in] stream sink to write the message to
 /// @param[in] value to convert to a string literal
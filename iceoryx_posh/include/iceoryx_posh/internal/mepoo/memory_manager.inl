@@ -36,6 +36,21 @@ inline constexpr const char* asStringLiteral(const MemoryManager::Error value) n
     return "[Undefined MemoryManager::Error]";
 }
 
+inline constexpr const char* asStringLiteral(const MemoryManager::ExtensionError value) noexcept
+{
+    switch (value)
+    {
+    case MemoryManager::ExtensionError::INVALID_MEMPOOL_CONFIG:
+        return "MemoryManager::ExtensionError::INVALID_MEMPOOL_CONFIG";
+    case MemoryManager::ExtensionError::MEMPOOL_LIMIT_EXCEEDED:
+        return "MemoryManager::ExtensionError::MEMPOOL_LIMIT_EXCEEDED";
+    case MemoryManager::ExtensionError::CHUNK_LIMIT_EXCEEDED:
+        return "MemoryManager::ExtensionError::CHUNK_LIMIT_EXCEEDED";
+    }
+
+    return "[Undefined MemoryManager::ExtensionError]";
+}
+
 } // namespace mepoo
 } // namespace iox
 
@@ -17,6 +17,7 @@
 #ifndef IOX_POSH_MEPOO_MEPOO_SEGMENT_HPP
 #define IOX_POSH_MEPOO_MEPOO_SEGMENT_HPP
 
+#include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/access_control.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
@@ -25,10 +26,32 @@
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 
+#include <atomic>
+
 namespace iox
 {
 namespace mepoo
 {
+/// @brief the reasons why a payload segment cannot be extended at runtime
+enum class SegmentExtensionError
+{
+    /// @brief there is no segment with the writer group
+    UNKNOWN_WRITER_GROUP,
+    /// @brief there would be more shared memory segments than MAX_SHM_SEGMENTS
+    SEGMENT_LIMIT_EXCEEDED,
+    /// @brief the segment was already extended MAX_NUMBER_OF_SEGMENT_EXTENSIONS times
+    EXTENSION_LIMIT_EXCEEDED,
+    /// @brief see MemoryManager::ExtensionError::INVALID_MEMPOOL_CONFIG
+    INVALID_MEMPOOL_CONFIG,
+    /// @brief see MemoryManager::ExtensionError::MEMPOOL_LIMIT_EXCEEDED
+    MEMPOOL_LIMIT_EXCEEDED,
+    /// @brief see MemoryManager::ExtensionError::CHUNK_LIMIT_EXCEEDED
+    CHUNK_LIMIT_EXCEEDED,
+    UNABLE_TO_CREATE_SHARED_MEMORY_OBJECT,
+    UNABLE_TO_APPLY_ACCESS_RIGHTS,
+    UNABLE_TO_LOCK_SHARED_MEMORY_OBJECT,
+};
+
 template <typename SharedMemoryObjectType = posix::SharedMemoryObject, typename MemoryManagerType = MemoryManager>
 class MePooSegment
 {
@@ -46,17 +69,83 @@ class MePooSegment
 
     uint64_t getSegmentId() const noexcept;
 
+    /// @brief returns the mount point of the hugetlbfs which backs the segment
+    /// @return the mount point or an empty string if the segment is backed by regular pages
+    const MePooConfig::HugePageMount_t& getHugePageMount() const noexcept;
+
+    /// @brief returns whether the segment is locked in RAM
+    /// @return true if the shared memory of the segment was locked, false otherwise
+    bool isLockedInMemory() const noexcept;
+
+    /// @brief an additional shared memory segment which provides the chunks of the mempools which were added at
+    /// runtime
+    struct Extension
+    {
+        Extension(const posix::SharedMemory::Name_t& name,
+                  SharedMemoryObjectType&& sharedMemoryObject,
+                  const uint64_t segmentId,
+                  const MePooConfig::HugePageMount_t& hugePageMount,
+                  const bool isLockedInMemory) noexcept;
+
+        posix::SharedMemory::Name_t m_name;
+        SharedMemoryObjectType m_sharedMemoryObject;
+        uint64_t m_segmentId{0U};
+        MePooConfig::HugePageMount_t m_hugePageMount;
+        bool m_isLockedInMemory{false};
+    };
+
+    /// @brief adds mempools to the segment at runtime, their chunks are placed in an additional shared memory segment
+    /// which is created with the huge page, NUMA, prefault and memory lock settings of the extension config. The
+    /// applications map it when they access one of its chunks the first time.
+    /// @param[in] extensionConfig the mempools to add, their chunks must fit the m_maxNumberOfExtensionChunks which
+    /// were reserved with the config of the segment
+    /// @return a SegmentExtensionError if the segment could not be extended, the segment is then unchanged
+    /// @note must not be called concurrently
+    cxx::expected<SegmentExtensionError> extend(const MePooConfig& extensionConfig) noexcept;
+
+    /// @brief returns the number of extensions of the segment
+    uint32_t getNumberOfExtensions() const noexcept;
+
+    /// @brief returns an extension of the segment
+    /// @param[in] index of the extension, must be less than getNumberOfExtensions
+    const Extension& getExtension(const uint32_t index) const noexcept;
+
   protected:
     SharedMemoryObjectType createSharedMemoryObject(const MePooConfig& mempoolConfig,
                                                     const posix::PosixGroup& writerGroup) noexcept;
 
+    /// @brief creates the shared memory object of the chunks, with huge pages if they are configured and available
+    /// @param[in] mempoolConfig provides the mempools and the settings of the shared memory
+    /// @param[in] name of the shared memory object
+    /// @param[out] hugePageMount the mount point of the hugetlbfs, empty if regular pages are used
+    /// @return the shared memory object or the error of the creation with regular pages
+    cxx::expected<SharedMemoryObjectType, posix::SharedMemoryObjectError>
+    createChunkMemory(const MePooConfig& mempoolConfig,
+                      const posix::SharedMemory::Name_t& name,
+                      MePooConfig::HugePageMount_t& hugePageMount) noexcept;
+
+    bool applyAccessRights(SharedMemoryObjectType& sharedMemoryObject) noexcept;
+
+    cxx::expected<SharedMemoryObjectType, posix::SharedMemoryObjectError>
+    tryCreateSharedMemoryObject(const posix::SharedMemory::Name_t& name,
+                                const uint64_t memorySizeInBytes,
+                                const MePooConfig::HugePageMount_t& hugePageMount,
+                                const posix::NumaPolicy& numaPolicy,
+                                const posix::PrefaultStrategy prefaultStrategy) noexcept;
+
   protected:
+    // is set while m_sharedMemoryObject is created, therefore it must be initialized before
+    MePooConfig::HugePageMount_t m_hugePageMount;
     SharedMemoryObjectType m_sharedMemoryObject;
     MemoryManagerType m_memoryManager;
     posix::PosixGroup m_readerGroup;
     posix::PosixGroup m_writerGroup;
     uint64_t m_segmentId;
     iox::mepoo::MemoryInfo m_memoryInfo;
+    bool m_isLockedInMemory{false};
+    /// @brief the applications only read the first m_numberOfExtensions extensions
+    cxx::vector<Extension, MAX_NUMBER_OF_SEGMENT_EXTENSIONS> m_extensions;
+    std::atomic<uint32_t> m_numberOfExtensions{0U};
 
     static constexpr cxx::perms SEGMENT_PERMISSIONS =
         cxx::perms::owner_read | cxx::perms::owner_write | cxx::perms::group_read | cxx::perms::group_write;
@@ -17,6 +17,8 @@
 #ifndef IOX_POSH_MEPOO_MEPOO_SEGMENT_INL
 #define IOX_POSH_MEPOO_MEPOO_SEGMENT_INL
 
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
 #include "iceoryx_hoofs/log/logging.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
@@ -38,25 +40,22 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
     const posix::PosixGroup& readerGroup,
     const posix::PosixGroup& writerGroup,
     const iox::mepoo::MemoryInfo& memoryInfo) noexcept
-    : m_sharedMemoryObject(std::move(createSharedMemoryObject(mempoolConfig, writerGroup)))
+    : m_hugePageMount()
+    , m_sharedMemoryObject(std::move(createSharedMemoryObject(mempoolConfig, writerGroup)))
     , m_readerGroup(readerGroup)
     , m_writerGroup(writerGroup)
     , m_memoryInfo(memoryInfo)
 {
-    using namespace posix;
-    AccessController accessController;
-    if (!(readerGroup == writerGroup))
+    if (!applyAccessRights(m_sharedMemoryObject))
     {
-        accessController.addGroupPermission(AccessController::Permission::READ, readerGroup.getName());
+        errorHandler(PoshError::MEPOO__SEGMENT_COULD_NOT_APPLY_POSIX_RIGHTS_TO_SHARED_MEMORY);
     }
-    accessController.addGroupPermission(AccessController::Permission::READWRITE, writerGroup.getName());
-    accessController.addPermissionEntry(AccessController::Category::USER, AccessController::Permission::READWRITE);
-    accessController.addPermissionEntry(AccessController::Category::GROUP, AccessController::Permission::READWRITE);
-    accessController.addPermissionEntry(AccessController::Category::OTHERS, AccessController::Permission::NONE);
 
-    if (!accessController.writePermissionsToFile(m_sharedMemoryObject.getFileHandle()))
+    if (mempoolConfig.m_lockInMemory)
     {
-        errorHandler(PoshError::MEPOO__SEGMENT_COULD_NOT_APPLY_POSIX_RIGHTS_TO_SHARED_MEMORY);
+        m_sharedMemoryObject.lockInMemory().and_then([this] { m_isLockedInMemory = true; }).or_else([](auto&) {
+            errorHandler(PoshError::MEPOO__SEGMENT_UNABLE_TO_LOCK_SHARED_MEMORY_OBJECT);
+        });
     }
 
     m_memoryManager.configureMemoryManager(mempoolConfig, managementAllocator, m_sharedMemoryObject.getAllocator());
@@ -68,13 +67,7 @@ inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManager
     const MePooConfig& mempoolConfig, const posix::PosixGroup& writerGroup) noexcept
 {
     return std::move(
-        typename SharedMemoryObjectType::Builder()
-            .name(writerGroup.getName())
-            .memorySizeInBytes(MemoryManager::requiredChunkMemorySize(mempoolConfig))
-            .accessMode(posix::AccessMode::READ_WRITE)
-            .openMode(posix::OpenMode::PURGE_AND_CREATE)
-            .permissions(SEGMENT_PERMISSIONS)
-            .create()
+        createChunkMemory(mempoolConfig, writerGroup.getName(), m_hugePageMount)
             .and_then([this](auto& sharedMemoryObject) {
                 this->setSegmentId(static_cast<uint64_t>(iox::rp::BaseRelativePointer::registerPtr(
                     sharedMemoryObject.getBaseAddress(), sharedMemoryObject.getSizeInBytes())));
@@ -87,6 +80,177 @@ inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManager
             .value());
 }
 
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline cxx::expected<SharedMemoryObjectType, posix::SharedMemoryObjectError>
+MePooSegment<SharedMemoryObjectType, MemoryManagerType>::createChunkMemory(
+    const MePooConfig& mempoolConfig,
+    const posix::SharedMemory::Name_t& name,
+    MePooConfig::HugePageMount_t& hugePageMount) noexcept
+{
+    const uint64_t chunkMemorySize = MemoryManager::requiredChunkMemorySize(mempoolConfig);
+    hugePageMount = MePooConfig::HugePageMount_t();
+
+    if (mempoolConfig.m_hugePageSize != 0U)
+    {
+        // a file in a hugetlbfs can only be truncated to a multiple of the huge page size
+        auto sharedMemoryObject = tryCreateSharedMemoryObject(name,
+                                                              cxx::align(chunkMemorySize, mempoolConfig.m_hugePageSize),
+                                                              mempoolConfig.m_hugePageMount,
+                                                              mempoolConfig.m_numaPolicy,
+                                                              mempoolConfig.m_prefaultStrategy);
+        if (!sharedMemoryObject.has_error())
+        {
+            LogInfo() << "The payload data segment '" << name << "' is backed by huge pages of "
+                      << mempoolConfig.m_hugePageSize << " bytes from '" << mempoolConfig.m_hugePageMount << "'";
+            hugePageMount = mempoolConfig.m_hugePageMount;
+            return sharedMemoryObject;
+        }
+
+        LogWarn() << "Unable to back the payload data segment '" << name << "' with huge pages of "
+                  << mempoolConfig.m_hugePageSize << " bytes from '" << mempoolConfig.m_hugePageMount
+                  << "', falling back to regular pages. Check that a hugetlbfs with "
+                  << "this page size is mounted there, that RouDi may create files in it and that enough huge pages "
+                  << "are free, e.g. with 'HugePages_Free' in /proc/meminfo and /sys/kernel/mm/hugepages.";
+    }
+
+    return tryCreateSharedMemoryObject(name,
+                                       chunkMemorySize,
+                                       MePooConfig::HugePageMount_t(),
+                                       mempoolConfig.m_numaPolicy,
+                                       mempoolConfig.m_prefaultStrategy);
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline bool MePooSegment<SharedMemoryObjectType, MemoryManagerType>::applyAccessRights(
+    SharedMemoryObjectType& sharedMemoryObject) noexcept
+{
+    using namespace posix;
+    AccessController accessController;
+    if (!(m_readerGroup == m_writerGroup))
+    {
+        accessController.addGroupPermission(AccessController::Permission::READ, m_readerGroup.getName());
+    }
+    accessController.addGroupPermission(AccessController::Permission::READWRITE, m_writerGroup.getName());
+    accessController.addPermissionEntry(AccessController::Category::USER, AccessController::Permission::READWRITE);
+    accessController.addPermissionEntry(AccessController::Category::GROUP, AccessController::Permission::READWRITE);
+    accessController.addPermissionEntry(AccessController::Category::OTHERS, AccessController::Permission::NONE);
+
+    return accessController.writePermissionsToFile(sharedMemoryObject.getFileHandle());
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline cxx::expected<SharedMemoryObjectType, posix::SharedMemoryObjectError>
+MePooSegment<SharedMemoryObjectType, MemoryManagerType>::tryCreateSharedMemoryObject(
+    const posix::SharedMemory::Name_t& name,
+    const uint64_t memorySizeInBytes,
+    const MePooConfig::HugePageMount_t& hugePageMount,
+    const posix::NumaPolicy& numaPolicy,
+    const posix::PrefaultStrategy prefaultStrategy) noexcept
+{
+    return typename SharedMemoryObjectType::Builder()
+        .name(name)
+        .memorySizeInBytes(memorySizeInBytes)
+        .accessMode(posix::AccessMode::READ_WRITE)
+        .openMode(posix::OpenMode::PURGE_AND_CREATE)
+        .permissions(SEGMENT_PERMISSIONS)
+        .directory(hugePageMount)
+        .numaPolicy(numaPolicy)
+        .prefaultStrategy(prefaultStrategy)
+        .create();
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::Extension::Extension(
+    const posix::SharedMemory::Name_t& name,
+    SharedMemoryObjectType&& sharedMemoryObject,
+    const uint64_t segmentId,
+    const MePooConfig::HugePageMount_t& hugePageMount,
+    const bool isLockedInMemory) noexcept
+    : m_name(name)
+    , m_sharedMemoryObject(std::move(sharedMemoryObject))
+    , m_segmentId(segmentId)
+    , m_hugePageMount(hugePageMount)
+    , m_isLockedInMemory(isLockedInMemory)
+{
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline cxx::expected<SegmentExtensionError>
+MePooSegment<SharedMemoryObjectType, MemoryManagerType>::extend(const MePooConfig& extensionConfig) noexcept
+{
+    if (m_extensions.size() >= MAX_NUMBER_OF_SEGMENT_EXTENSIONS)
+    {
+        return cxx::error<SegmentExtensionError>(SegmentExtensionError::EXTENSION_LIMIT_EXCEEDED);
+    }
+
+    auto verification = m_memoryManager.verifyExtensionMemPools(extensionConfig);
+    if (verification.has_error())
+    {
+        switch (verification.get_error())
+        {
+        case MemoryManager::ExtensionError::INVALID_MEMPOOL_CONFIG:
+            return cxx::error<SegmentExtensionError>(SegmentExtensionError::INVALID_MEMPOOL_CONFIG);
+        case MemoryManager::ExtensionError::MEMPOOL_LIMIT_EXCEEDED:
+            return cxx::error<SegmentExtensionError>(SegmentExtensionError::MEMPOOL_LIMIT_EXCEEDED);
+        case MemoryManager::ExtensionError::CHUNK_LIMIT_EXCEEDED:
+            return cxx::error<SegmentExtensionError>(SegmentExtensionError::CHUNK_LIMIT_EXCEEDED);
+        }
+    }
+
+    posix::SharedMemory::Name_t name{m_writerGroup.getName()};
+    name.append(cxx::TruncateToCapacity, ".ext");
+    name.append(cxx::TruncateToCapacity, cxx::convert::toString(m_extensions.size() + 1U));
+
+    MePooConfig::HugePageMount_t hugePageMount;
+    auto sharedMemoryObject = createChunkMemory(extensionConfig, name, hugePageMount);
+    if (sharedMemoryObject.has_error())
+    {
+        LogError() << "Unable to create the shared memory object '" << name << "' to extend a payload data segment";
+        return cxx::error<SegmentExtensionError>(SegmentExtensionError::UNABLE_TO_CREATE_SHARED_MEMORY_OBJECT);
+    }
+    if (!applyAccessRights(sharedMemoryObject.value()))
+    {
+        return cxx::error<SegmentExtensionError>(SegmentExtensionError::UNABLE_TO_APPLY_ACCESS_RIGHTS);
+    }
+    if (extensionConfig.m_lockInMemory && sharedMemoryObject.value().lockInMemory().has_error())
+    {
+        return cxx::error<SegmentExtensionError>(SegmentExtensionError::UNABLE_TO_LOCK_SHARED_MEMORY_OBJECT);
+    }
+
+    const auto segmentId = static_cast<uint64_t>(iox::rp::BaseRelativePointer::registerPtr(
+        sharedMemoryObject.value().getBaseAddress(), sharedMemoryObject.value().getSizeInBytes()));
+    LogDebug() << "Roudi registered payload data segment extension "
+               << iox::log::hex(sharedMemoryObject.value().getBaseAddress()) << " with size "
+               << sharedMemoryObject.value().getSizeInBytes() << " to id " << segmentId;
+
+    m_extensions.emplace_back(
+        name, std::move(sharedMemoryObject.value()), segmentId, hugePageMount, extensionConfig.m_lockInMemory);
+    auto& extension = m_extensions.back();
+    // the extension must be known before its chunks can be handed out, the applications map it when they access the
+    // first of them
+    m_numberOfExtensions.store(static_cast<uint32_t>(m_extensions.size()), std::memory_order_release);
+
+    m_memoryManager.addExtensionMemPools(extensionConfig, extension.m_sharedMemoryObject.getAllocator());
+    extension.m_sharedMemoryObject.finalizeAllocation();
+
+    return cxx::success<>();
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline uint32_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getNumberOfExtensions() const noexcept
+{
+    return m_numberOfExtensions.load(std::memory_order_acquire);
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline const typename MePooSegment<SharedMemoryObjectType, MemoryManagerType>::Extension&
+MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getExtension(const uint32_t index) const noexcept
+{
+    // the size of m_extensions is changed by RouDi while the applications read the extensions, the valid extensions
+    // are therefore accessed without reading it
+    return *(m_extensions.begin() + index);
+}
+
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline posix::PosixGroup MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getWriterGroup() const noexcept
 {
@@ -118,6 +282,19 @@ inline uint64_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getSegm
     return m_segmentId;
 }
 
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline const MePooConfig::HugePageMount_t&
+MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getHugePageMount() const noexcept
+{
+    return m_hugePageMount;
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline bool MePooSegment<SharedMemoryObjectType, MemoryManagerType>::isLockedInMemory() const noexcept
+{
+    return m_isLockedInMemory;
+}
+
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline void MePooSegment<SharedMemoryObjectType, MemoryManagerType>::setSegmentId(const uint64_t segmentId) noexcept
 {
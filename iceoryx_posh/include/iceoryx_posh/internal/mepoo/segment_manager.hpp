@@ -59,12 +59,16 @@ class SegmentManager
                        uint64_t size,
                        bool isWritable,
                        uint64_t segmentId,
+                       const MePooConfig::HugePageMount_t& hugePageMount = MePooConfig::HugePageMount_t(),
+                       bool isLockedInMemory = false,
                        const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo()) noexcept
             : m_sharedMemoryName(sharedMemoryName)
             , m_startAddress(startAddress)
             , m_size(size)
             , m_isWritable(isWritable)
             , m_segmentId(segmentId)
+            , m_hugePageMount(hugePageMount)
+            , m_isLockedInMemory(isLockedInMemory)
             , m_memoryInfo(memoryInfo)
 
         {
@@ -75,6 +79,10 @@ class SegmentManager
         uint64_t m_size{0};
         bool m_isWritable{false};
         uint64_t m_segmentId{0};
+        /// @brief the mount point of the hugetlbfs which backs the segment, empty for regular pages
+        MePooConfig::HugePageMount_t m_hugePageMount;
+        /// @brief true if RouDi locked the segment in RAM, the applications then lock their mapping as well
+        bool m_isLockedInMemory{false};
         iox::mepoo::MemoryInfo m_memoryInfo; // we can specify additional info about a segments memory here
     };
 
@@ -89,12 +97,24 @@ class SegmentManager
     SegmentMappingContainer getSegmentMappings(const posix::PosixUser& user) noexcept;
     SegmentUserInformation getSegmentInformationWithWriteAccessForUser(const posix::PosixUser& user) noexcept;
 
+    /// @brief adds mempools to the payload segment of a writer group at runtime, the applications which already run
+    /// map the additional shared memory when they access one of its chunks
+    /// @param[in] writerGroup the writer group of the segment
+    /// @param[in] extensionConfig the mempools to add, see MePooSegment::extend
+    /// @return a SegmentExtensionError if the segment could not be extended
+    /// @note must not be called concurrently
+    cxx::expected<SegmentExtensionError> extendSegment(const posix::PosixGroup& writerGroup,
+                                                       const MePooConfig& extensionConfig) noexcept;
+
     static uint64_t requiredManagementMemorySize(const SegmentConfig& config) noexcept;
     static uint64_t requiredChunkMemorySize(const SegmentConfig& config) noexcept;
     static uint64_t requiredFullMemorySize(const SegmentConfig& config) noexcept;
 
   private:
     void createSegment(const SegmentConfig::SegmentEntry& segmentEntry) noexcept;
+    void addSegmentMappings(SegmentMappingContainer& mappingContainer,
+                            const SegmentType& segment,
+                            const bool isWritable) const noexcept;
 
   private:
     template <typename MemoryManger, typename SegmentManager, typename PublisherPort>
@@ -69,11 +69,7 @@ SegmentManager<SegmentType>::getSegmentMappings(const posix::PosixUser& user) no
                 // process
                 if (!foundInWriterGroup)
                 {
-                    mappingContainer.emplace_back(segment.getWriterGroup().getName(),
-                                                  segment.getSharedMemoryObject().getBaseAddress(),
-                                                  segment.getSharedMemoryObject().getSizeInBytes(),
-                                                  true,
-                                                  segment.getSegmentId());
+                    addSegmentMappings(mappingContainer, segment, true);
                     foundInWriterGroup = true;
                 }
                 else
@@ -95,11 +91,7 @@ SegmentManager<SegmentType>::getSegmentMappings(const posix::PosixUser& user) no
                        return mapping.m_startAddress == segment.getSharedMemoryObject().getBaseAddress();
                    }) == mappingContainer.end())
             {
-                mappingContainer.emplace_back(segment.getWriterGroup().getName(),
-                                              segment.getSharedMemoryObject().getBaseAddress(),
-                                              segment.getSharedMemoryObject().getSizeInBytes(),
-                                              false,
-                                              segment.getSegmentId());
+                addSegmentMappings(mappingContainer, segment, false);
             }
         }
     }
@@ -107,6 +99,33 @@ SegmentManager<SegmentType>::getSegmentMappings(const posix::PosixUser& user) no
     return mappingContainer;
 }
 
+template <typename SegmentType>
+inline void SegmentManager<SegmentType>::addSegmentMappings(SegmentMappingContainer& mappingContainer,
+                                                            const SegmentType& segment,
+                                                            const bool isWritable) const noexcept
+{
+    mappingContainer.emplace_back(segment.getWriterGroup().getName(),
+                                  segment.getSharedMemoryObject().getBaseAddress(),
+                                  segment.getSharedMemoryObject().getSizeInBytes(),
+                                  isWritable,
+                                  segment.getSegmentId(),
+                                  segment.getHugePageMount(),
+                                  segment.isLockedInMemory());
+
+    const uint32_t numberOfExtensions = segment.getNumberOfExtensions();
+    for (uint32_t index = 0U; index < numberOfExtensions; ++index)
+    {
+        const auto& extension = segment.getExtension(index);
+        mappingContainer.emplace_back(ShmName_t(cxx::TruncateToCapacity, extension.m_name.c_str()),
+                                      extension.m_sharedMemoryObject.getBaseAddress(),
+                                      extension.m_sharedMemoryObject.getSizeInBytes(),
+                                      isWritable,
+                                      extension.m_segmentId,
+                                      extension.m_hugePageMount,
+                                      extension.m_isLockedInMemory);
+    }
+}
+
 template <typename SegmentType>
 inline typename SegmentManager<SegmentType>::SegmentUserInformation
 SegmentManager<SegmentType>::getSegmentInformationWithWriteAccessForUser(const posix::PosixUser& user) noexcept
@@ -132,6 +151,35 @@ SegmentManager<SegmentType>::getSegmentInformationWithWriteAccessForUser(const p
     return segmentInfo;
 }
 
+template <typename SegmentType>
+inline cxx::expected<SegmentExtensionError>
+SegmentManager<SegmentType>::extendSegment(const posix::PosixGroup& writerGroup,
+                                           const MePooConfig& extensionConfig) noexcept
+{
+    uint32_t numberOfSharedMemorySegments{0U};
+    SegmentType* segmentOfWriterGroup{nullptr};
+    for (auto& segment : m_segmentContainer)
+    {
+        numberOfSharedMemorySegments += 1U + segment.getNumberOfExtensions();
+        if (segment.getWriterGroup() == writerGroup)
+        {
+            segmentOfWriterGroup = &segment;
+        }
+    }
+
+    if (segmentOfWriterGroup == nullptr)
+    {
+        return cxx::error<SegmentExtensionError>(SegmentExtensionError::UNKNOWN_WRITER_GROUP);
+    }
+    // every application must be able to map all segments
+    if (numberOfSharedMemorySegments >= MAX_SHM_SEGMENTS)
+    {
+        return cxx::error<SegmentExtensionError>(SegmentExtensionError::SEGMENT_LIMIT_EXCEEDED);
+    }
+
+    return segmentOfWriterGroup->extend(extensionConfig);
+}
+
 template <typename SegmentType>
 uint64_t SegmentManager<SegmentType>::requiredManagementMemorySize(const SegmentConfig& config) noexcept
 {
@@ -124,6 +124,11 @@ class BaseSubscriber
     /// port
     cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> takeChunk() noexcept;
 
+    /// @brief small helper method to take up to maxNumberOfChunks chunks in one pass via the `tryGetChunks` method of
+    /// the port
+    cxx::expected<ChunkReceiveResult> takeChunks(typename port_t::ChunkHeaderBatch_t& chunkHeaders,
+                                                 const uint64_t maxNumberOfChunks) noexcept;
+
     void invalidateTrigger(const uint64_t trigger) noexcept;
 
     /// @brief Only usable by the WaitSet, not for public use. Attaches the triggerHandle to the internal trigger.
@@ -93,6 +93,14 @@ inline cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> BaseSubscrib
     return m_port.tryGetChunk();
 }
 
+template <typename port_t>
+inline cxx::expected<ChunkReceiveResult>
+BaseSubscriber<port_t>::takeChunks(typename port_t::ChunkHeaderBatch_t& chunkHeaders,
+                                   const uint64_t maxNumberOfChunks) noexcept
+{
+    return m_port.tryGetChunks(chunkHeaders, maxNumberOfChunks);
+}
+
 template <typename port_t>
 inline void BaseSubscriber<port_t>::releaseQueuedData() noexcept
 {
@@ -17,12 +17,14 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_DISTRIBUTOR_HPP
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_DISTRIBUTOR_HPP
 
+#include "iceoryx_hoofs/cxx/deadline_timer.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/internal/cxx/adaptive_wait.hpp"
 #include "iceoryx_hoofs/internal/cxx/unique_id.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/delivery_thread_pool.hpp"
 
 #include <thread>
 
@@ -33,9 +35,19 @@ namespace popo
 enum class ChunkDistributorError
 {
     QUEUE_CONTAINER_OVERFLOW,
-    QUEUE_NOT_IN_CONTAINER
+    QUEUE_NOT_IN_CONTAINER,
+    SENDER_STILL_REGISTERED
 };
 
+/// @brief Time after which a change of the queues gives up waiting for the sending side to leave a queue snapshot
+/// and returns ChunkDistributorError::SENDER_STILL_REGISTERED. This is only exceeded when the sending process died
+/// while delivering a chunk or was stopped.
+constexpr units::Duration CHUNK_DISTRIBUTOR_SNAPSHOT_READER_TIMEOUT = units::Duration::fromMilliseconds(500U);
+
+/// @brief Maximum time a sender which waits for a consumer sleeps before it checks again whether the pending queues
+/// are still stored. The sender is woken up earlier when the consumer takes a chunk out of the queue.
+constexpr units::Duration CHUNK_DISTRIBUTOR_WAIT_FOR_CONSUMER_TIMEOUT = units::Duration::fromMilliseconds(10U);
+
 /// @brief The ChunkDistributor is the low layer building block to send SharedChunks to a dynamic number of ChunkQueus.
 /// Together with the ChunkQueuePusher, the ChunkDistributor builds the infrastructure to exchange memory chunks between
 /// different data producers and consumers that could be located in different processes. Besides a modifiable container
@@ -48,12 +60,23 @@ enum class ChunkDistributorError
 /// This ChunkDistributor can be used with different LockingPolicies for different scenarios
 /// When different threads operate on it (e.g. application sends chunks and RouDi adds and removes queues),
 /// a locking policy must be used that ensures consistent data in the ChunkDistributorData.
+/// The queues are changed under the lock but deliverToAllStoredQueues does not take it. Every change of the queues
+/// publishes an immutable snapshot of the queue container and the sending side iterates over the active snapshot
+/// while being registered as reader of it. A snapshot is only overwritten when it has no readers, a removed queue
+/// stays in the previous snapshot until all readers left it. A sender which waits for a blocked consumer sleeps
+/// without being registered as reader, a removal of the queue it sleeps on wakes it up and waits until it left the
+/// queue. A removed queue is not accessed anymore after tryRemoveQueue returned successfully. The changing side waits
+/// at most CHUNK_DISTRIBUTOR_SNAPSHOT_READER_TIMEOUT for the sending side, afterwards it returns
+/// ChunkDistributorError::SENDER_STILL_REGISTERED and the change has to be retried; a removed queue must be kept
+/// alive until a retry of its removal succeeded. If a sending process died while being registered, RouDi calls
+/// releaseSenderRegistrations to unblock the changes.
+/// When the number of queues reaches the parallelDeliveryThreshold of the ChunkDistributorData, the queues of the
+/// snapshot are split between the sending thread and the DeliveryThreadPool of the process. The send returns when
+/// the chunks were pushed into all queues, only the waiting for blocked consumers is always done by the sending thread.
 /// @todo There are currently some challenge:
-/// For the stored queues and the history, containers are used which are not thread safe. Therefore we use an
-/// inter-process mutex. But this can lead to deadlocks if a user process gets terminated while one of its
-/// threads is in the ChunkDistributor and holds a lock. An easier setup would be if changing the queues
-/// by a middleware thread and sending chunks by the user process would not interleave. I.e. there is no concurrent
-/// access to the containers. Then a memory synchronization would be sufficient.
+/// For the history, a container is used which is not thread safe. Therefore we use an inter-process mutex. But this
+/// can lead to deadlocks if a user process gets terminated while one of its threads updates the history and holds
+/// the lock. Without history, the sending side never takes the lock.
 /// The cleanup() call is the biggest challenge. This is used to free chunks that are still held by a not properly
 /// terminated user application. Even if access from middleware and user threads do not overlap, the history
 /// container to cleanup could be in an inconsistent state as the application was hard terminated while changing it.
@@ -79,18 +102,24 @@ class ChunkDistributor
     /// deliverToAllStoredQueues
     /// @param[in] queueToAdd chunk queue to add to the list
     /// @param[in] requestedHistory number of last chunks from history to send if available. If history size is smaller
-    /// then the available history size chunks are provided
-    /// @return if the queue could be added it returns success, otherwiese a ChunkDistributor error
+    /// then the available history size chunks are provided. The history is replayed on a copy outside of the lock,
+    /// only chunks which were sent in the meantime are delivered under the lock before the queue is added
+    /// @return if the queue could be added it returns success, otherwiese a ChunkDistributor error;
+    /// SENDER_STILL_REGISTERED when the sending side did not leave the previous snapshot, the queue was not added
     cxx::expected<ChunkDistributorError> tryAddQueue(cxx::not_null<ChunkQueueData_t* const> queueToAdd,
                                                      const uint64_t requestedHistory = 0U) noexcept;
 
     /// @brief Remove a queue from the internal list of chunk queues
     /// @param[in] queueToRemove is the queue to remove from the list
-    /// @return if the queue could be removed it returns success, otherwiese a ChunkDistributor error
+    /// @return if the queue could be removed it returns success, otherwiese a ChunkDistributor error;
+    /// SENDER_STILL_REGISTERED when the sending side could still access the queue, no new chunks are delivered to it
+    /// but the removal is only finished by a later call which returns success
     cxx::expected<ChunkDistributorError> tryRemoveQueue(cxx::not_null<ChunkQueueData_t* const> queueToRemove) noexcept;
 
     /// @brief Delete all the stored chunk queues
-    void removeAllQueues() noexcept;
+    /// @return SENDER_STILL_REGISTERED when the sending side could still access one of the queues, like for
+    /// tryRemoveQueue the removal is only finished by a later call which returns success
+    cxx::expected<ChunkDistributorError> removeAllQueues() noexcept;
 
     /// @brief Get the information whether there are any stored chunk queues
     /// @return true if there are stored chunk queues, false if not
@@ -99,9 +128,18 @@ class ChunkDistributor
     /// @brief Deliver the provided shared chunk to all the stored chunk queues. The chunk will be added to the chunk
     /// history
     /// @param[in] chunk is the SharedChunk to be delivered
-    /// @return the number of queues the chunk was delivered to
+    /// @return the number of queues the chunk was delivered to, queues which dropped it by their decimation or rate
+    /// limit are not counted
     uint64_t deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Deliver the provided shared chunks in one pass to all the stored chunk queues. Every queue gets the
+    /// chunks back-to-back and its consumer is notified once per batch. The chunks will be added to the chunk history
+    /// @param[in] chunks are the SharedChunks to be delivered in the order of the vector
+    /// @return the number of queues at least one of the chunks was delivered to, queues which dropped all of them by
+    /// their decimation or rate limit are not counted
+    template <uint64_t Capacity>
+    uint64_t deliverToAllStoredQueues(const cxx::vector<mepoo::SharedChunk, Capacity>& chunks) noexcept;
+
     /// @brief Deliver the provided shared chunk to the chunk queue with the provided ID. The chunk will NOT be added
     /// to the chunk history
     /// @param[in] uniqueQueueId is an unique ID which identifies the queue to which this chunk shall be delivered
@@ -125,6 +163,11 @@ class ChunkDistributor
     /// @param[in] chunk to add to the chunk history
     void addToHistoryWithoutDelivery(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Update the chunk history with several chunks at once but do not deliver them to any chunk queue
+    /// @param[in] chunks to add to the chunk history in the order of the vector
+    template <uint64_t Capacity>
+    void addToHistoryWithoutDelivery(const cxx::vector<mepoo::SharedChunk, Capacity>& chunks) noexcept;
+
     /// @brief Get the current size of the chunk history
     /// @return chunk history size
     uint64_t getHistorySize() noexcept;
@@ -136,6 +179,10 @@ class ChunkDistributor
     /// @brief Clears the chunk history
     void clearHistory() noexcept;
 
+    /// @brief Resets the registrations of the sending side at the queue snapshots, a change of the queues is postponed
+    /// as long as they are set. Caution: the sending side must not run anymore, e.g. since the sending process died
+    void releaseSenderRegistrations() noexcept;
+
     /// @brief cleanup the used shrared memory chunks
     void cleanup() noexcept;
 
@@ -145,7 +192,89 @@ class ChunkDistributor
 
     bool pushToQueue(cxx::not_null<ChunkQueueData_t* const> queue, mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Registers as reader of the active queue snapshot
+    /// @return the version of the acquired snapshot which must be passed to releaseQueueSnapshot
+    uint64_t acquireQueueSnapshot() const noexcept;
+
+    /// @brief Unregisters as reader of a queue snapshot
+    /// @param[in] snapshotVersion is the version returned by acquireQueueSnapshot
+    void releaseQueueSnapshot(const uint64_t snapshotVersion) const noexcept;
+
+    /// @brief Returns the queues of an acquired snapshot
+    /// @param[in] snapshotVersion is the version returned by acquireQueueSnapshot
+    const typename MemberType_t::QueueContainer_t& getSnapshotQueues(const uint64_t snapshotVersion) const noexcept;
+
   private:
+    /// @brief A queue which did not yet get all chunks of a delivery since it is full and the sender waits for it
+    struct PendingDelivery
+    {
+        PendingDelivery(ChunkQueueData_t* const queue, const uint64_t nextChunkIndex) noexcept
+            : m_queue(queue)
+            , m_nextChunkIndex(nextChunkIndex)
+        {
+        }
+
+        ChunkQueueData_t* m_queue{nullptr};
+        uint64_t m_nextChunkIndex{0U};
+    };
+
+    /// @brief Pushes the chunks into a queue and notifies it once, stops at the first chunk which does not fit into a
+    /// full blocking queue
+    /// @param[out] hasPassedTheFilter is set to true when at least one chunk was not dropped by the decimation or
+    /// rate limit of the queue, otherwise to false
+    /// @return the index of the first chunk which was not delivered, chunks.size() when all were delivered
+    template <uint64_t Capacity>
+    uint64_t deliverWithoutWaitingForConsumer(ChunkQueueData_t* const queue,
+                                              const cxx::vector<mepoo::SharedChunk, Capacity>& chunks,
+                                              const bool willWaitForConsumer,
+                                              bool& hasPassedTheFilter) noexcept;
+
+    using HistoryCopy_t =
+        cxx::vector<mepoo::SharedChunk, MemberType_t::ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY>;
+
+    /// @brief Adds a chunk to the history; must be called with the lock held
+    void addToHistoryUnsafe(mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief Appends the newest chunks of the history to a copy, the oldest one first; must be called with the lock
+    /// held
+    /// @param[out] historyCopy the chunks are appended to this vector
+    /// @param[in] numberOfChunks the number of newest chunks to copy, limited to the history size
+    void copyHistoryUnsafe(HistoryCopy_t& historyCopy, const uint64_t numberOfChunks) noexcept;
+
+    /// @brief must be called with the lock held
+    bool isQueueStoredUnsafe(cxx::not_null<ChunkQueueData_t* const> queue) const noexcept;
+
+    cxx::expected<ChunkDistributorError> reportQueueContainerOverflow() const noexcept;
+
+    /// @brief Copies m_queues into the inactive snapshot and activates it, the inactive snapshot must have been
+    /// released with tryReleasePreviousQueueSnapshot before; must be called with the lock held
+    void publishQueueSnapshot() noexcept;
+
+    /// @brief Waits until the sending side left the previous snapshot and no longer sleeps on a queue which was
+    /// removed with it, afterwards the previous snapshot can be overwritten; must be called with the lock held
+    /// @return true if the previous snapshot was released, false if the sending side is still registered after
+    /// CHUNK_DISTRIBUTOR_SNAPSHOT_READER_TIMEOUT
+    bool tryReleasePreviousQueueSnapshot() noexcept;
+
+    /// @return true if the snapshot has no readers, false if they did not leave it within
+    /// CHUNK_DISTRIBUTOR_SNAPSHOT_READER_TIMEOUT
+    bool waitForQueueSnapshotReaders(const uint64_t snapshotIndex) noexcept;
+
+    bool isInSnapshot(const uint64_t snapshotVersion, cxx::not_null<ChunkQueueData_t* const> queue) const noexcept;
+
+    /// @brief Sleeps until the consumer of the queue took a chunk or CHUNK_DISTRIBUTOR_WAIT_FOR_CONSUMER_TIMEOUT has
+    /// passed; the queue must be registered in m_sleepingSenderQueueId before the snapshot or the lock is released
+    void sleepUntilConsumerTookAChunk(ChunkQueueData_t* const queue) noexcept;
+
+    /// @brief Wakes up a sender which sleeps on a removed queue and waits until it does not access the queue anymore
+    /// @return true if the sender left the queue, false if it is still registered after
+    /// CHUNK_DISTRIBUTOR_SNAPSHOT_READER_TIMEOUT
+    bool waitForSleepingSender(ChunkQueueData_t* const queue) noexcept;
+
+    /// @brief the pusher notifies the queue with the notifier id of this producer, this way RouDi can release the
+    /// notification of a dead producer without affecting the other producers of the queue
+    ChunkQueuePusher_t getPusher(cxx::not_null<ChunkQueueData_t* const> queue) const noexcept;
+
     MemberType_t* m_chunkDistrubutorDataPtr{nullptr};
 };
 
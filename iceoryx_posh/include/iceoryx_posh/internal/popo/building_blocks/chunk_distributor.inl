@@ -49,54 +49,100 @@ inline cxx::expected<ChunkDistributorError>
 ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(cxx::not_null<ChunkQueueData_t* const> queueToAdd,
                                                         const uint64_t requestedHistory) noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
-
-    const auto alreadyKnownReceiver =
-        std::find_if(getMembers()->m_queues.begin(),
-                     getMembers()->m_queues.end(),
-                     [&](const rp::RelativePointer<ChunkQueueData_t> queue) { return queue.get() == queueToAdd; });
+    if (requestedHistory > getMembers()->m_historyCapacity)
+    {
+        LogWarn() << "Chunk history request exceeds history capacity! Request is " << requestedHistory
+                  << ". Capacity is " << getMembers()->m_historyCapacity << ".";
+    }
 
-    // check if the queue is not already in the list
-    if (alreadyKnownReceiver == getMembers()->m_queues.end())
+    // the requested history is copied under the lock but delivered without it, this way a joining queue does not
+    // stall the sending side while the history is replayed
+    HistoryCopy_t historyCopy;
+    uint64_t numberOfChunksAddedToHistory{0U};
     {
-        if (getMembers()->m_queues.size() < getMembers()->m_queues.capacity())
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+        if (isQueueStoredUnsafe(queueToAdd))
         {
-            // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we checked the capacity, so
-            // pushing will be fine
-            getMembers()->m_queues.push_back(rp::RelativePointer<ChunkQueueData_t>(queueToAdd));
-
-            const auto currChunkHistorySize = getMembers()->m_history.size();
-
-            if (requestedHistory > getMembers()->m_historyCapacity)
-            {
-                LogWarn() << "Chunk history request exceeds history capacity! Request is " << requestedHistory
-                          << ". Capacity is " << getMembers()->m_historyCapacity << ".";
-            }
-
-            // if the current history is large enough we send the requested number of chunks, else we send the
-            // total history
-            const auto startIndex =
-                (requestedHistory <= currChunkHistorySize) ? currChunkHistorySize - requestedHistory : 0u;
-            for (auto i = startIndex; i < currChunkHistorySize; ++i)
-            {
-                pushToQueue(queueToAdd, getMembers()->m_history[i].cloneToSharedChunk());
-            }
-
             return cxx::success<void>();
         }
-        else
+        if (getMembers()->m_queues.size() >= getMembers()->m_queues.capacity())
         {
-            // that's not the fault of the chunk distributor user, we report a moderate error and indicate that
-            // adding the queue was not possible
-            errorHandler(PoshError::POPO__CHUNK_DISTRIBUTOR_OVERFLOW_OF_QUEUE_CONTAINER, ErrorLevel::MODERATE);
-
-            return cxx::error<ChunkDistributorError>(ChunkDistributorError::QUEUE_CONTAINER_OVERFLOW);
+            return reportQueueContainerOverflow();
+        }
+        // checked before the history is replayed to not deliver it to a queue which is not added
+        if (!tryReleasePreviousQueueSnapshot())
+        {
+            return cxx::error<ChunkDistributorError>(ChunkDistributorError::SENDER_STILL_REGISTERED);
         }
+
+        numberOfChunksAddedToHistory = getMembers()->m_numberOfChunksAddedToHistory;
+        copyHistoryUnsafe(historyCopy, requestedHistory);
+    }
+
+    for (auto& chunk : historyCopy)
+    {
+        pushToQueue(queueToAdd, chunk);
+    }
+    historyCopy.clear();
+
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+    if (isQueueStoredUnsafe(queueToAdd))
+    {
+        return cxx::success<void>();
+    }
+    if (getMembers()->m_queues.size() >= getMembers()->m_queues.capacity())
+    {
+        return reportQueueContainerOverflow();
+    }
+    if (!tryReleasePreviousQueueSnapshot())
+    {
+        return cxx::error<ChunkDistributorError>(ChunkDistributorError::SENDER_STILL_REGISTERED);
+    }
+
+    // chunks which were sent while the history was replayed were delivered to a snapshot without the queue, they are
+    // delivered now before the queue becomes visible to the sending side to keep the order; all of them are missed
+    // independent of the requested history, only a queue without history never gets chunks from the history
+    const uint64_t numberOfMissedChunks =
+        (requestedHistory > 0U) ? std::min(getMembers()->m_numberOfChunksAddedToHistory - numberOfChunksAddedToHistory,
+                                           getMembers()->m_historyCapacity)
+                                : 0U;
+    copyHistoryUnsafe(historyCopy, numberOfMissedChunks);
+    for (auto& chunk : historyCopy)
+    {
+        pushToQueue(queueToAdd, chunk);
     }
 
+    // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we checked the capacity, so
+    // pushing will be fine
+    getMembers()->m_queues.push_back(rp::RelativePointer<ChunkQueueData_t>(queueToAdd));
+    publishQueueSnapshot();
+
     return cxx::success<void>();
 }
 
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::isQueueStoredUnsafe(
+    cxx::not_null<ChunkQueueData_t* const> queue) const noexcept
+{
+    return std::find_if(getMembers()->m_queues.begin(),
+                        getMembers()->m_queues.end(),
+                        [&](const rp::RelativePointer<ChunkQueueData_t> storedQueue) {
+                            return storedQueue.get() == queue;
+                        })
+           != getMembers()->m_queues.end();
+}
+
+template <typename ChunkDistributorDataType>
+inline cxx::expected<ChunkDistributorError>
+ChunkDistributor<ChunkDistributorDataType>::reportQueueContainerOverflow() const noexcept
+{
+    // that's not the fault of the chunk distributor user, we report a moderate error and indicate that
+    // adding the queue was not possible
+    errorHandler(PoshError::POPO__CHUNK_DISTRIBUTOR_OVERFLOW_OF_QUEUE_CONTAINER, ErrorLevel::MODERATE);
+
+    return cxx::error<ChunkDistributorError>(ChunkDistributorError::QUEUE_CONTAINER_OVERFLOW);
+}
+
 template <typename ChunkDistributorDataType>
 inline cxx::expected<ChunkDistributorError> ChunkDistributor<ChunkDistributorDataType>::tryRemoveQueue(
     cxx::not_null<ChunkQueueData_t* const> queueToRemove) noexcept
@@ -106,121 +152,400 @@ inline cxx::expected<ChunkDistributorError> ChunkDistributor<ChunkDistributorDat
     const auto iter = std::find(getMembers()->m_queues.begin(), getMembers()->m_queues.end(), queueToRemove);
     if (iter != getMembers()->m_queues.end())
     {
+        if (!tryReleasePreviousQueueSnapshot())
+        {
+            return cxx::error<ChunkDistributorError>(ChunkDistributorError::SENDER_STILL_REGISTERED);
+        }
         // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we don't use iter any longer so return value can be ignored
         getMembers()->m_queues.erase(iter);
-
-        return cxx::success<void>();
+        publishQueueSnapshot();
+        getMembers()->m_isQueueRemovalPending = true;
     }
-    else
+    else if (!getMembers()->m_isQueueRemovalPending
+             || !isInSnapshot(getMembers()->m_queueSnapshotVersion.load() + 1U, queueToRemove))
     {
         return cxx::error<ChunkDistributorError>(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
     }
+
+    // the queue is only part of the previous snapshot now, as long as the sending side did not leave it the removal
+    // is pending and finished by a retry
+    if (!tryReleasePreviousQueueSnapshot())
+    {
+        return cxx::error<ChunkDistributorError>(ChunkDistributorError::SENDER_STILL_REGISTERED);
+    }
+
+    return cxx::success<void>();
 }
 
 template <typename ChunkDistributorDataType>
-inline void ChunkDistributor<ChunkDistributorDataType>::removeAllQueues() noexcept
+inline cxx::expected<ChunkDistributorError> ChunkDistributor<ChunkDistributorDataType>::removeAllQueues() noexcept
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    getMembers()->m_queues.clear();
+    if (!getMembers()->m_queues.empty())
+    {
+        if (!tryReleasePreviousQueueSnapshot())
+        {
+            return cxx::error<ChunkDistributorError>(ChunkDistributorError::SENDER_STILL_REGISTERED);
+        }
+        getMembers()->m_queues.clear();
+        publishQueueSnapshot();
+        getMembers()->m_isQueueRemovalPending = true;
+    }
+
+    if (!tryReleasePreviousQueueSnapshot())
+    {
+        return cxx::error<ChunkDistributorError>(ChunkDistributorError::SENDER_STILL_REGISTERED);
+    }
+
+    return cxx::success<void>();
 }
 
 template <typename ChunkDistributorDataType>
 inline bool ChunkDistributor<ChunkDistributorDataType>::hasStoredQueues() const noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    const auto snapshotVersion = acquireQueueSnapshot();
+    const bool hasQueues = !getSnapshotQueues(snapshotVersion).empty();
+    releaseQueueSnapshot(snapshotVersion);
 
-    return !getMembers()->m_queues.empty();
+    return hasQueues;
 }
 
 template <typename ChunkDistributorDataType>
-inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::acquireQueueSnapshot() const noexcept
 {
-    uint64_t numberOfQueuesTheChunkWasDeliveredTo{0U};
-    typename ChunkDistributorDataType::QueueContainer_t remainingQueues;
+    // the reader registration and the re-check of the version must not be reordered, therefore the default
+    // sequentially consistent memory order is used for the snapshot synchronization
+    while (true)
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
-
-        bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
-        // send to all the queues
-        for (auto& queue : getMembers()->m_queues)
+        const auto version = getMembers()->m_queueSnapshotVersion.load();
+        const auto snapshotIndex = version % 2U;
+        getMembers()->m_queueSnapshots[snapshotIndex].m_readerCount.fetch_add(1U);
+        if (version == getMembers()->m_queueSnapshotVersion.load())
         {
-            bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
+            return version;
+        }
+        // the snapshot was replaced in between, it could already be rewritten
+        getMembers()->m_queueSnapshots[snapshotIndex].m_readerCount.fetch_sub(1U);
+    }
+}
 
-            if (pushToQueue(queue.get(), chunk))
-            {
-                ++numberOfQueuesTheChunkWasDeliveredTo;
-            }
-            else
+template <typename ChunkDistributorDataType>
+inline void
+ChunkDistributor<ChunkDistributorDataType>::releaseQueueSnapshot(const uint64_t snapshotVersion) const noexcept
+{
+    getMembers()->m_queueSnapshots[snapshotVersion % 2U].m_readerCount.fetch_sub(1U);
+}
+
+template <typename ChunkDistributorDataType>
+inline const typename ChunkDistributor<ChunkDistributorDataType>::MemberType_t::QueueContainer_t&
+ChunkDistributor<ChunkDistributorDataType>::getSnapshotQueues(const uint64_t snapshotVersion) const noexcept
+{
+    return getMembers()->m_queueSnapshots[snapshotVersion % 2U].m_queues;
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::publishQueueSnapshot() noexcept
+{
+    const auto version = getMembers()->m_queueSnapshotVersion.load();
+    getMembers()->m_queueSnapshots[(version + 1U) % 2U].m_queues = getMembers()->m_queues;
+    getMembers()->m_queueSnapshotVersion.store(version + 1U);
+}
+
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::tryReleasePreviousQueueSnapshot() noexcept
+{
+    const auto previousIndex = (getMembers()->m_queueSnapshotVersion.load() + 1U) % 2U;
+
+    // besides the senders which still iterate over it, readers which registered right before the last version change
+    // need to leave the snapshot; new readers register at the active one
+    if (!waitForQueueSnapshotReaders(previousIndex))
+    {
+        return false;
+    }
+    if (getMembers()->m_isQueueRemovalPending)
+    {
+        for (auto& queue : getMembers()->m_queueSnapshots[previousIndex].m_queues)
+        {
+            if (!isQueueStoredUnsafe(queue.get()) && !waitForSleepingSender(queue.get()))
             {
-                if (isBlockingQueue)
-                {
-                    remainingQueues.emplace_back(queue);
-                }
-                else
-                {
-                    ++numberOfQueuesTheChunkWasDeliveredTo;
-                    ChunkQueuePusher_t(queue.get()).lostAChunk();
-                }
+                return false;
             }
         }
     }
 
-    // busy waiting until every queue is served
+    // the previous snapshot is kept, cleanup needs its queues to release the notifications of a dead sender
+    getMembers()->m_isQueueRemovalPending = false;
+    return true;
+}
+
+template <typename ChunkDistributorDataType>
+inline bool
+ChunkDistributor<ChunkDistributorDataType>::waitForQueueSnapshotReaders(const uint64_t snapshotIndex) noexcept
+{
+    auto& readerCount = getMembers()->m_queueSnapshots[snapshotIndex].m_readerCount;
+    if (readerCount.load() == 0U)
+    {
+        return true;
+    }
+
+    // a live sender leaves the snapshot after it pushed the chunks, we give up only to not block RouDi with a sender
+    // which died while delivering; its registration is reset by RouDi when the process is cleaned up
+    cxx::DeadlineTimer timeout(CHUNK_DISTRIBUTOR_SNAPSHOT_READER_TIMEOUT);
     cxx::internal::adaptive_wait adaptiveWait;
-    while (!remainingQueues.empty())
+    adaptiveWait.wait_loop([&] { return readerCount.load() != 0U && !timeout.hasExpired(); });
+
+    if (readerCount.load() != 0U)
     {
-        adaptiveWait.wait();
+        LogWarn() << "The sender did not release the queue snapshot, the change of the queues is postponed! This "
+                     "indicates that the sending application was terminated while delivering a chunk and was not yet "
+                     "cleaned up.";
+        return false;
+    }
+    return true;
+}
+
+template <typename ChunkDistributorDataType>
+inline void
+ChunkDistributor<ChunkDistributorDataType>::sleepUntilConsumerTookAChunk(ChunkQueueData_t* const queue) noexcept
+{
+    getPusher(queue).waitForSpace(CHUNK_DISTRIBUTOR_WAIT_FOR_CONSUMER_TIMEOUT);
+    getMembers()->m_sleepingSenderQueueId.store(0U);
+}
+
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::waitForSleepingSender(ChunkQueueData_t* const queue) noexcept
+{
+    const auto queueId = static_cast<uint64_t>(queue->m_uniqueId);
+    // the sender registers before it leaves the snapshot or the lock, therefore it either sees the new snapshot or we
+    // see the registration; it is woken up repeatedly since it could become a waiting producer of the queue only
+    // after our first attempt
+    if (getMembers()->m_sleepingSenderQueueId.load() != queueId)
+    {
+        return true;
+    }
+
+    // like for the snapshot readers we give up only on a sender which died while waiting
+    cxx::DeadlineTimer timeout(CHUNK_DISTRIBUTOR_SNAPSHOT_READER_TIMEOUT);
+    cxx::internal::adaptive_wait adaptiveWait;
+    adaptiveWait.wait_loop([&] {
+        if (getMembers()->m_sleepingSenderQueueId.load() != queueId || timeout.hasExpired())
         {
-            // create intersection of current queues and remainingQueues
-            // reason: it is possible that since the last iteration some subscriber have already unsubscribed
-            //          and without this intersection we would deliver to dead queues
-            typename MemberType_t::LockGuard_t lock(*getMembers());
-            typename ChunkDistributorDataType::QueueContainer_t queueIntersection(remainingQueues.size());
-            auto greaterThan = [](rp::RelativePointer<ChunkQueueData_t>& a,
-                                  rp::RelativePointer<ChunkQueueData_t>& b) -> bool {
-                return reinterpret_cast<uint64_t>(a.get()) > reinterpret_cast<uint64_t>(b.get());
-            };
-            std::sort(getMembers()->m_queues.begin(), getMembers()->m_queues.end(), greaterThan);
-            std::sort(remainingQueues.begin(), remainingQueues.end(), greaterThan);
-
-            auto iter = std::set_intersection(getMembers()->m_queues.begin(),
-                                              getMembers()->m_queues.end(),
-                                              remainingQueues.begin(),
-                                              remainingQueues.end(),
-                                              queueIntersection.begin(),
-                                              greaterThan);
-            queueIntersection.resize(static_cast<uint64_t>(iter - queueIntersection.begin()));
-            remainingQueues = queueIntersection;
-
-            // deliver to remaining queues
-            for (uint64_t i = remainingQueues.size() - 1U; !remainingQueues.empty(); --i)
+            return false;
+        }
+        getPusher(queue).wakeUpWaitingProducer(static_cast<uint64_t>(getMembers()->m_notifierId));
+        return true;
+    });
+
+    if (getMembers()->m_sleepingSenderQueueId.load() == queueId)
+    {
+        LogWarn() << "The sender did not wake up from waiting for a removed queue, the removal is postponed! This "
+                     "indicates that the sending application was terminated while waiting and was not yet cleaned up.";
+        return false;
+    }
+    return true;
+}
+
+template <typename ChunkDistributorDataType>
+inline bool
+ChunkDistributor<ChunkDistributorDataType>::isInSnapshot(const uint64_t snapshotVersion,
+                                                         cxx::not_null<ChunkQueueData_t* const> queue) const noexcept
+{
+    const auto& queues = getSnapshotQueues(snapshotVersion);
+    return std::find_if(queues.begin(),
+                        queues.end(),
+                        [&](const rp::RelativePointer<ChunkQueueData_t>& storedQueue) {
+                            return storedQueue.get() == queue;
+                        })
+           != queues.end();
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept
+{
+    cxx::vector<mepoo::SharedChunk, 1U> chunks;
+    chunks.emplace_back(std::move(chunk));
+    return deliverToAllStoredQueues(chunks);
+}
+
+template <typename ChunkDistributorDataType>
+template <uint64_t Capacity>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(
+    const cxx::vector<mepoo::SharedChunk, Capacity>& chunks) noexcept
+{
+    uint64_t numberOfQueuesTheChunksWereDeliveredTo{0U};
+    cxx::vector<PendingDelivery, MemberType_t::ChunkDistributorDataProperties_t::MAX_QUEUES> pendingDeliveries;
+
+    uint64_t snapshotVersion{0U};
+    if (0U < getMembers()->m_historyCapacity)
+    {
+        // the history is updated together with acquiring the snapshot, this way tryAddQueue sees every chunk either
+        // in the history or it will be delivered to a snapshot which already contains the new queue
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+        for (auto& chunk : chunks)
+        {
+            addToHistoryUnsafe(chunk);
+        }
+        snapshotVersion = acquireQueueSnapshot();
+    }
+    else
+    {
+        snapshotVersion = acquireQueueSnapshot();
+    }
+    const auto& queues = getSnapshotQueues(snapshotVersion);
+
+    const bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    // the index of the first chunk which could not be delivered to the queue with the same index in the snapshot;
+    // every queue has its own entry, therefore the delivery threads can write them without synchronization
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    uint64_t nextChunkIndices[MemberType_t::ChunkDistributorDataProperties_t::MAX_QUEUES];
+    // queues which dropped all chunks by their decimation or rate limit did not receive anything and are not counted
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    bool hasPassedTheFilter[MemberType_t::ChunkDistributorDataProperties_t::MAX_QUEUES];
+    auto deliverToSnapshotQueue = [&](const uint64_t queueIndex) {
+        nextChunkIndices[queueIndex] = deliverWithoutWaitingForConsumer(
+            queues[queueIndex].get(), chunks, willWaitForConsumer, hasPassedTheFilter[queueIndex]);
+    };
+
+    // send to all the queues
+    const uint64_t parallelDeliveryThreshold = getMembers()->m_parallelDeliveryThreshold;
+    if (parallelDeliveryThreshold != 0U && queues.size() >= parallelDeliveryThreshold)
+    {
+        DeliveryThreadPool::instance().run(queues.size(), deliverToSnapshotQueue);
+    }
+    else
+    {
+        for (uint64_t i = 0U; i < queues.size(); ++i)
+        {
+            deliverToSnapshotQueue(i);
+        }
+    }
+
+    for (uint64_t i = 0U; i < queues.size(); ++i)
+    {
+        if (nextChunkIndices[i] < chunks.size())
+        {
+            pendingDeliveries.emplace_back(queues[i].get(), nextChunkIndices[i]);
+        }
+        else if (hasPassedTheFilter[i])
+        {
+            ++numberOfQueuesTheChunksWereDeliveredTo;
+        }
+    }
+
+    // a pending delivery always points to a chunk which has passed the filter of the queue, therefore the filter is
+    // applied to every chunk exactly once even when the push of a chunk is retried
+    auto skipToNextUnfilteredChunk = [&](PendingDelivery& pendingDelivery) {
+        auto pusher = getPusher(pendingDelivery.m_queue);
+        do
+        {
+            ++pendingDelivery.m_nextChunkIndex;
+        } while (pendingDelivery.m_nextChunkIndex < chunks.size() && pusher.isNextChunkFilteredOut());
+    };
+
+    // wait until every blocking queue is served; the sender sleeps until the consumer of the last pending queue took
+    // a chunk and revisits only the queues which are still pending
+    while (!pendingDeliveries.empty())
+    {
+        // the snapshot is released while sleeping to not block changes of the queues, a removal of the queue we sleep
+        // on wakes us up; the queues are only accessed again after they were validated with the next snapshot
+        const auto lastSnapshotVersion = snapshotVersion;
+        auto sleepingQueue = pendingDeliveries.back().m_queue;
+        getMembers()->m_sleepingSenderQueueId.store(static_cast<uint64_t>(sleepingQueue->m_uniqueId));
+        releaseQueueSnapshot(snapshotVersion);
+        sleepUntilConsumerTookAChunk(sleepingQueue);
+        snapshotVersion = acquireQueueSnapshot();
+
+        for (uint64_t i = pendingDeliveries.size(); i > 0U; --i)
+        {
+            auto& pendingDelivery = pendingDeliveries[i - 1U];
+            // queues which are not part of the current snapshot have unsubscribed in the meantime and are dropped
+            // since we would deliver to dead queues otherwise; this is only checked when the snapshot changed
+            if (snapshotVersion != lastSnapshotVersion && !isInSnapshot(snapshotVersion, pendingDelivery.m_queue))
+            {
+                pendingDeliveries.erase(pendingDeliveries.begin() + (i - 1U));
+                continue;
+            }
+
+            auto pusher = getPusher(pendingDelivery.m_queue);
+            const auto firstChunkIndex = pendingDelivery.m_nextChunkIndex;
+            while (pendingDelivery.m_nextChunkIndex < chunks.size()
+                   && pusher.pushWithoutNotification(chunks[pendingDelivery.m_nextChunkIndex]))
+            {
+                skipToNextUnfilteredChunk(pendingDelivery);
+            }
+            if (pendingDelivery.m_nextChunkIndex != firstChunkIndex)
+            {
+                pusher.notify();
+            }
+
+            if (pendingDelivery.m_nextChunkIndex == chunks.size())
             {
-                if (pushToQueue(remainingQueues[i].get(), chunk))
-                {
-                    remainingQueues.erase(remainingQueues.begin() + i);
-                    ++numberOfQueuesTheChunkWasDeliveredTo;
-                }
-
-                // don't move this up since the for loop counts downwards and the algorithm would break
-                if (i == 0U)
-                {
-                    break;
-                }
+                pendingDeliveries.erase(pendingDeliveries.begin() + (i - 1U));
+                ++numberOfQueuesTheChunksWereDeliveredTo;
             }
         }
     }
 
-    addToHistoryWithoutDelivery(chunk);
+    releaseQueueSnapshot(snapshotVersion);
+
+    return numberOfQueuesTheChunksWereDeliveredTo;
+}
 
-    return numberOfQueuesTheChunkWasDeliveredTo;
+template <typename ChunkDistributorDataType>
+inline typename ChunkDistributor<ChunkDistributorDataType>::ChunkQueuePusher_t
+ChunkDistributor<ChunkDistributorDataType>::getPusher(cxx::not_null<ChunkQueueData_t* const> queue) const noexcept
+{
+    return ChunkQueuePusher_t(queue, static_cast<uint64_t>(getMembers()->m_notifierId));
 }
 
 template <typename ChunkDistributorDataType>
 inline bool ChunkDistributor<ChunkDistributorDataType>::pushToQueue(cxx::not_null<ChunkQueueData_t* const> queue,
                                                                     mepoo::SharedChunk chunk) noexcept
 {
-    return ChunkQueuePusher_t(queue).push(chunk);
+    return getPusher(queue).push(chunk);
+}
+
+template <typename ChunkDistributorDataType>
+template <uint64_t Capacity>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverWithoutWaitingForConsumer(
+    ChunkQueueData_t* const queue,
+    const cxx::vector<mepoo::SharedChunk, Capacity>& chunks,
+    const bool willWaitForConsumer,
+    bool& hasPassedTheFilter) noexcept
+{
+    const bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
+
+    auto pusher = getPusher(queue);
+    bool hasPushedAChunk{false};
+    uint64_t chunkIndex{0U};
+    for (; chunkIndex < chunks.size(); ++chunkIndex)
+    {
+        // chunks which are dropped by the decimation or rate limit of the consumer neither touch the queue nor wake
+        // up the consumer
+        if (pusher.isNextChunkFilteredOut())
+        {
+            continue;
+        }
+
+        hasPushedAChunk = true;
+        if (!pusher.pushWithoutNotification(chunks[chunkIndex]))
+        {
+            if (isBlockingQueue)
+            {
+                break;
+            }
+            pusher.lostAChunk();
+        }
+    }
+
+    if (hasPushedAChunk)
+    {
+        pusher.notify();
+    }
+
+    hasPassedTheFilter = hasPushedAChunk;
+    return chunkIndex;
 }
 
 template <typename ChunkDistributorDataType>
@@ -229,37 +554,45 @@ ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const cxx::UniqueId u
                                                            const uint32_t lastKnownQueueIndex,
                                                            mepoo::SharedChunk chunk IOX_MAYBE_UNUSED) noexcept
 {
-    bool retry{false};
-    do
+    while (true)
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
+        ChunkQueueData_t* queue{nullptr};
+        {
+            typename MemberType_t::LockGuard_t lock(*getMembers());
 
-        auto queueIndex = getQueueIndex(uniqueQueueId, lastKnownQueueIndex);
+            auto queueIndex = getQueueIndex(uniqueQueueId, lastKnownQueueIndex);
 
-        if (!queueIndex.has_value())
-        {
-            return cxx::error<ChunkDistributorError>(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
-        }
+            if (!queueIndex.has_value())
+            {
+                return cxx::error<ChunkDistributorError>(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
+            }
 
-        auto& queue = getMembers()->m_queues[queueIndex.value()];
+            queue = getMembers()->m_queues[queueIndex.value()].get();
 
-        bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+            bool willWaitForConsumer =
+                getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
 
-        bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
+            bool isBlockingQueue =
+                (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
 
-        retry = false;
-        if (!pushToQueue(queue.get(), chunk))
-        {
-            if (isBlockingQueue)
+            if (pushToQueue(queue, chunk))
             {
-                retry = true;
+                break;
             }
-            else
+            if (!isBlockingQueue)
             {
-                ChunkQueuePusher_t(queue.get()).lostAChunk();
+                getPusher(queue).lostAChunk();
+                break;
             }
+
+            // registered under the lock, therefore a removal of the queue either happens before the lookup or wakes
+            // us up and waits until we left the queue
+            getMembers()->m_sleepingSenderQueueId.store(static_cast<uint64_t>(queue->m_uniqueId));
         }
-    } while (retry);
+
+        // sleep without the lock to not block changes of the queues and retry with a fresh lookup of the queue
+        sleepUntilConsumerTookAChunk(queue);
+    }
 
     return cxx::success<>();
 }
@@ -293,20 +626,61 @@ ChunkDistributor<ChunkDistributorDataType>::getQueueIndex(const cxx::UniqueId un
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::addToHistoryWithoutDelivery(mepoo::SharedChunk chunk) noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    // the capacity is constant, so the lock is only required if there is a history at all
+    if (0u < getMembers()->m_historyCapacity)
+    {
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+        addToHistoryUnsafe(chunk);
+    }
+}
 
+template <typename ChunkDistributorDataType>
+template <uint64_t Capacity>
+inline void ChunkDistributor<ChunkDistributorDataType>::addToHistoryWithoutDelivery(
+    const cxx::vector<mepoo::SharedChunk, Capacity>& chunks) noexcept
+{
+    // the capacity is constant, so the lock is only required if there is a history at all
     if (0u < getMembers()->m_historyCapacity)
     {
-        if (getMembers()->m_history.size() >= getMembers()->m_historyCapacity)
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+        for (auto& chunk : chunks)
         {
-            auto chunkToRemove = getMembers()->m_history.begin();
-            chunkToRemove->releaseToSharedChunk();
-            // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we are not iterating here, so return value can be ignored
-            getMembers()->m_history.erase(chunkToRemove);
+            addToHistoryUnsafe(chunk);
         }
-        // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we ensured that there is space in the
-        // history, so return value can be ignored
-        getMembers()->m_history.push_back(chunk);
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::addToHistoryUnsafe(mepoo::SharedChunk chunk) noexcept
+{
+    auto& history = getMembers()->m_history;
+    if (history.size() < getMembers()->m_historyCapacity)
+    {
+        // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we ensured that there is space in
+        // the history, so return value can be ignored
+        history.push_back(chunk);
+    }
+    else
+    {
+        // the history is full, the oldest chunk is replaced and the next one becomes the oldest
+        auto& oldestChunk = history[getMembers()->m_historyStart];
+        oldestChunk.releaseToSharedChunk();
+        oldestChunk = mepoo::ShmSafeUnmanagedChunk(chunk);
+        getMembers()->m_historyStart = (getMembers()->m_historyStart + 1U) % history.size();
+    }
+    ++getMembers()->m_numberOfChunksAddedToHistory;
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::copyHistoryUnsafe(HistoryCopy_t& historyCopy,
+                                                                          const uint64_t numberOfChunks) noexcept
+{
+    auto& history = getMembers()->m_history;
+    const uint64_t historySize = history.size();
+    const uint64_t numberOfChunksToCopy = std::min(numberOfChunks, historySize);
+    for (uint64_t i = historySize - numberOfChunksToCopy; i < historySize; ++i)
+    {
+        historyCopy.emplace_back(history[(getMembers()->m_historyStart + i) % historySize].cloneToSharedChunk());
     }
 }
 
@@ -335,11 +709,44 @@ inline void ChunkDistributor<ChunkDistributorDataType>::clearHistory() noexcept
     }
 
     getMembers()->m_history.clear();
+    getMembers()->m_historyStart = 0U;
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::releaseSenderRegistrations() noexcept
+{
+    // the sending side is gone, therefore a reader registration which was not released is stale
+    for (auto& snapshot : getMembers()->m_queueSnapshots)
+    {
+        snapshot.m_readerCount.store(0U);
+    }
+    getMembers()->m_sleepingSenderQueueId.store(0U);
 }
 
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::cleanup() noexcept
 {
+    // a notification which was not finished would block every change of the condition variable of the queue and a
+    // registration as waiting producer would take a post of the consumer; every queue the sending side could notify
+    // or wait for is in one of the snapshots, a queue which was removed meanwhile is replaced by a queue of the same
+    // type, therefore only slots with our notifier id are freed
+    for (auto& snapshot : getMembers()->m_queueSnapshots)
+    {
+        for (auto& queue : snapshot.m_queues)
+        {
+            auto pusher = getPusher(queue.get());
+            pusher.releaseNotifier(static_cast<uint64_t>(getMembers()->m_notifierId));
+            pusher.releaseWaitingProducer(static_cast<uint64_t>(getMembers()->m_notifierId));
+        }
+    }
+    releaseSenderRegistrations();
+
+    // without history the sending side never takes the lock and there is nothing to cleanup
+    if (getMembers()->m_historyCapacity == 0U)
+    {
+        return;
+    }
+
     if (getMembers()->tryLock())
     {
         clearHistory();
@@ -19,6 +19,7 @@
 
 #include "iceoryx_hoofs/cxx/algorithm.hpp"
 #include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_hoofs/internal/cxx/unique_id.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/mutex.hpp"
 #include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
@@ -28,6 +29,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <mutex>
 
@@ -44,21 +46,51 @@ struct ChunkDistributorData : public LockingPolicy
     using ChunkQueueData_t = typename ChunkQueuePusherType::MemberType_t;
     using ChunkDistributorDataProperties_t = ChunkDistributorDataProperties;
 
-    ChunkDistributorData(const ConsumerTooSlowPolicy policy, const uint64_t historyCapacity = 0u) noexcept;
+    ChunkDistributorData(const ConsumerTooSlowPolicy policy,
+                         const uint64_t historyCapacity = 0u,
+                         const uint64_t parallelDeliveryThreshold = 0U) noexcept;
 
+    /// @brief identifies this producer in the notifier slots of the queues, see ChunkQueuePusher::releaseNotifier
+    const cxx::UniqueId m_notifierId{};
     const uint64_t m_historyCapacity;
+    /// @brief the number of queues from which on the DeliveryThreadPool is used, zero means never
+    const uint64_t m_parallelDeliveryThreshold;
 
     using QueueContainer_t =
         cxx::vector<rp::RelativePointer<ChunkQueueData_t>, ChunkDistributorDataProperties_t::MAX_QUEUES>;
     QueueContainer_t m_queues;
 
-    /// @todo If we would make the ChunkDistributor lock-free, can we than extend the UsedChunkList to
-    /// be like a ring buffer and use this for the history? This would be needed to be able to safely cleanup.
+    /// @brief Immutable copy of m_queues which is used by the sending side to iterate over the queues without taking
+    /// the lock. The snapshot is only rewritten when no reader is registered in m_readerCount.
+    struct QueueSnapshot
+    {
+        QueueContainer_t m_queues;
+        mutable std::atomic<uint64_t> m_readerCount{0U};
+    };
+
+    /// @note two snapshots are used alternately; the one with the index 'm_queueSnapshotVersion % 2' is the active one
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    QueueSnapshot m_queueSnapshots[2];
+    std::atomic<uint64_t> m_queueSnapshotVersion{0U};
+    /// @brief the unique id of the queue the sending side waits for while it sleeps without being registered at a
+    /// snapshot or holding the lock, 0 if it does not sleep. A removal of this queue wakes the sender up and waits
+    /// until the id is reset, i.e. until the sender does not access the queue anymore
+    std::atomic<uint64_t> m_sleepingSenderQueueId{0U};
+    /// @brief true while the queues which were removed with the last change are still in the previous snapshot and
+    /// could be accessed by the sending side; only accessed under the lock
+    bool m_isQueueRemovalPending{false};
+
+    /// @brief The history is a ring buffer. It grows until it holds m_historyCapacity chunks, afterwards the oldest
+    /// chunk at m_historyStart is overwritten, i.e. adding a chunk and evicting the oldest one are O(1).
     /// Using ShmSafeUnmanagedChunk since RouDi must access this list to cleanup the chunks in case of an application
     /// crash.
     using HistoryContainer_t =
         cxx::vector<mepoo::ShmSafeUnmanagedChunk, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY>;
     HistoryContainer_t m_history;
+    uint64_t m_historyStart{0U};
+    /// @brief counts all chunks ever added to the history, tryAddQueue uses it to find the chunks which were added
+    /// while it replayed the history outside of the lock
+    uint64_t m_numberOfChunksAddedToHistory{0U};
     const ConsumerTooSlowPolicy m_consumerTooSlowPolicy;
 };
 
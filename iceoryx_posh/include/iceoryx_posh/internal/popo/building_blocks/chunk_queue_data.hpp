@@ -18,14 +18,17 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_DATA_HPP
 
 #include "iceoryx_hoofs/cxx/variant_queue.hpp"
+#include "iceoryx_hoofs/internal/concurrent/cache_line_padding.hpp"
 #include "iceoryx_hoofs/internal/cxx/unique_id.hpp"
 #include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
+#include "iceoryx_hoofs/posix_wrapper/unnamed_semaphore.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 
+#include <atomic>
 #include <mutex>
 
 namespace iox
@@ -39,17 +42,80 @@ struct ChunkQueueData : public LockingPolicy
     using LockGuard_t = std::lock_guard<const ThisType_t>;
     using ChunkQueueDataProperties_t = ChunkQueueDataProperties;
 
-    ChunkQueueData(const QueueFullPolicy policy, const cxx::VariantQueueTypes queueType) noexcept;
+    /// @param[in] policy the behavior when the queue is full
+    /// @param[in] queueType the type of the underlying queue
+    /// @param[in] latestChunkOnly when true the queue is bypassed and only the latest chunk is kept in
+    /// m_latestChunk, every push replaces the previous chunk
+    ChunkQueueData(const QueueFullPolicy policy,
+                   const cxx::VariantQueueTypes queueType,
+                   const bool latestChunkOnly = false) noexcept;
 
     cxx::UniqueId m_uniqueId{};
 
     static constexpr uint64_t MAX_CAPACITY = ChunkQueueDataProperties_t::MAX_QUEUE_CAPACITY;
-    cxx::VariantQueue<mepoo::ShmSafeUnmanagedChunk, MAX_CAPACITY> m_queue;
-    std::atomic_bool m_queueHasLostChunks{false};
 
+    /// @brief producers and consumer run in different processes, therefore the members are grouped by the side which
+    /// writes them and the groups are separated by a cache line. The members of the first group are written only when
+    /// the queue is set up or the condition variable changes.
+    const bool m_latestChunkOnly;
+    const QueueFullPolicy m_queueFullPolicy;
+
+    /// @brief the producers push only every m_decimation-th chunk which is offered to the queue and at most one chunk
+    /// per m_minimumPushIntervalNs, the other chunks are dropped before they touch the queue or the condition
+    /// variable. A value of 0 disables the respective filter, the state is shared by all producers of the queue
+    uint64_t m_decimation{1U};
+    uint64_t m_minimumPushIntervalNs{0U};
+
+    /// @brief m_conditionVariableDataPtr and m_conditionVariableNotificationIndex are only read by the notifying side
+    /// when m_isConditionVariablePublished is set. They are changed under the queue lock after the publication was
+    /// withdrawn and all notifiers registered in m_activeNotifiers are done, therefore the notify path of the
+    /// ChunkQueuePusher does not need the lock
     rp::RelativePointer<ConditionVariableData> m_conditionVariableDataPtr;
     cxx::optional<uint64_t> m_conditionVariableNotificationIndex;
-    const QueueFullPolicy m_queueFullPolicy;
+    std::atomic_bool m_isConditionVariablePublished{false};
+    concurrent::CacheLinePadding m_setupPadding;
+
+    /// @brief written by producers and consumer, the queue keeps track of its own read and write positions
+    cxx::VariantQueue<mepoo::ShmSafeUnmanagedChunk, MAX_CAPACITY> m_queue;
+    concurrent::CacheLinePadding m_queuePadding;
+
+    /// @brief written by the producers with every push, the consumer only resets m_queueHasLostChunks when it is set
+    std::atomic_bool m_queueHasLostChunks{false};
+    std::atomic<uint64_t> m_numberOfOfferedChunks{0U};
+    /// @brief steady clock time of the last push in nanoseconds for m_minimumPushIntervalNs, 0 if nothing was pushed
+    std::atomic<uint64_t> m_lastPushTimestampNs{0U};
+    /// @brief every producer which uses the condition variable right now occupies a slot with its notifier id, this
+    /// way RouDi can free exactly the slots of a producer which died while notifying
+    static constexpr uint64_t MAX_NUMBER_OF_ACTIVE_NOTIFIERS{8U};
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    std::atomic<uint64_t> m_activeNotifiers[MAX_NUMBER_OF_ACTIVE_NOTIFIERS]{};
+    /// @brief every producer which waits for free space occupies a slot with its notifier id, the consumer frees one
+    /// occupied slot for every taken chunk and posts m_spaceAvailableSemaphore once for it
+    static constexpr uint64_t MAX_NUMBER_OF_WAITING_PRODUCERS{8U};
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    std::atomic<uint64_t> m_waitingProducers[MAX_NUMBER_OF_WAITING_PRODUCERS]{};
+    concurrent::CacheLinePadding m_producerPadding;
+
+    /// @brief with m_latestChunkOnly the producers exchange their chunk with the one in m_latestChunk and release the
+    /// displaced chunk, the consumer exchanges it with an empty chunk. A replaced chunk is not reported as lost since
+    /// the consumer asked only for the latest one
+    std::atomic<mepoo::ShmSafeUnmanagedChunk> m_latestChunk{mepoo::ShmSafeUnmanagedChunk()};
+    /// @brief m_latestChunk is shared by processes, an atomic which falls back to a lock would use a process local
+    /// lock and could tear the chunk
+#if __cplusplus >= 201703L
+    static_assert(std::atomic<mepoo::ShmSafeUnmanagedChunk>::is_always_lock_free,
+                  "std::atomic<ShmSafeUnmanagedChunk> must be lock-free");
+#else
+    static_assert(sizeof(mepoo::ShmSafeUnmanagedChunk) == sizeof(uint64_t) && 2 <= ATOMIC_LLONG_LOCK_FREE,
+                  "std::atomic<ShmSafeUnmanagedChunk> must be lock-free");
+#endif
+
+    /// @brief producers which wait for free space in a full queue (QueueFullPolicy::BLOCK_PRODUCER) sleep on this
+    /// semaphore, it is only posted for a slot in m_waitingProducers which the consumer freed and therefore never
+    /// holds more posts than there are slots
+    cxx::optional<posix::UnnamedSemaphore> m_spaceAvailableSemaphore;
+    /// @brief the data of the next port in shared memory starts behind this padding
+    concurrent::CacheLinePadding m_consumerPadding;
 };
 
 } // namespace popo
@@ -23,10 +23,22 @@ namespace popo
 {
 template <typename ChunkQueueProperties, typename LockingPolicy>
 inline ChunkQueueData<ChunkQueueProperties, LockingPolicy>::ChunkQueueData(
-    const QueueFullPolicy policy, const cxx::VariantQueueTypes queueType) noexcept
-    : m_queue(queueType)
+    const QueueFullPolicy policy, const cxx::VariantQueueTypes queueType, const bool latestChunkOnly) noexcept
+    : m_latestChunkOnly(latestChunkOnly)
     , m_queueFullPolicy(policy)
+    , m_queue(queueType)
 {
+    // the latest chunk is always replaced, therefore a producer never has to wait for free space
+    if (m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER && !m_latestChunkOnly)
+    {
+        posix::UnnamedSemaphoreBuilder()
+            .initialValue(0U)
+            .isInterProcessCapable(true)
+            .create(m_spaceAvailableSemaphore)
+            .or_else([](auto) {
+                errorHandler(PoshError::POPO__CHUNK_QUEUE_DATA_FAILED_TO_CREATE_SEMAPHORE, ErrorLevel::FATAL);
+            });
+    }
 }
 
 } // namespace popo
@@ -17,16 +17,26 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_POPPER_HPP
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_POPPER_HPP
 
+#include "iceoryx_hoofs/cxx/deadline_timer.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_hoofs/internal/cxx/adaptive_wait.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 
+#include <algorithm>
+
 namespace iox
 {
 namespace popo
 {
+/// @brief Time after which a change of the condition variable warns that it still waits for the notifying producers to
+/// leave the notify path. This is only exceeded when a producing process died while notifying the queue, the wait
+/// continues until RouDi cleaned up the dead producer.
+constexpr units::Duration CHUNK_QUEUE_NOTIFIER_TIMEOUT = units::Duration::fromSeconds(1U);
+
 /// @brief The ChunkQueuePopper is the low layer building block to receive SharedChunks. It follows a first-in-first-out
 /// principle. Together with the ChunkDistributor and the ChunkQueuePusher, the ChunkQueuePopper builds the
 /// infrastructure to exchange memory chunks between different data producers and consumers that could be located in
@@ -46,10 +56,19 @@ class ChunkQueuePopper
     ChunkQueuePopper& operator=(ChunkQueuePopper&& rhs) noexcept = default;
     virtual ~ChunkQueuePopper() noexcept = default;
 
-    /// @brief pop a chunk from the chunk queue
+    /// @brief pop a chunk from the chunk queue and wake up a producer which waits for free space in the queue
     /// @return optional for a shared chunk that is set if the queue is not empty
     cxx::optional<mepoo::SharedChunk> tryPop() noexcept;
 
+    /// @brief pop up to maxNumberOfChunks chunks from the chunk queue in one pass and wake up a producer which waits
+    /// for free space in the queue
+    /// @param[out] chunks the pop'ed chunks are appended to this vector
+    /// @param[in] maxNumberOfChunks the maximum number of chunks to pop, it is further limited by the free space in
+    /// chunks
+    /// @return the number of chunks which were appended to chunks
+    template <uint64_t Capacity>
+    uint64_t tryPopMany(cxx::vector<mepoo::SharedChunk, Capacity>& chunks, const uint64_t maxNumberOfChunks) noexcept;
+
     /// @brief check if chunks were lost and reset flag
     /// @return true if the underlying queue has lost chunks due to an overflow since the last call of this method
     bool hasLostChunks() noexcept;
@@ -64,13 +83,14 @@ class ChunkQueuePopper
     uint64_t size() noexcept;
 
     /// @brief set the capacity of the queue
-    /// @param[in] newCapacity valid values are 0 < newCapacity < MAX_SUBSCRIBER_QUEUE_CAPACITY
+    /// @param[in] newCapacity valid values are 0 < newCapacity < MAX_SUBSCRIBER_QUEUE_CAPACITY, a queue which keeps
+    /// only the latest chunk ignores it
     /// @pre it is important that no pop or push calls occur during this call
     /// @concurrent not thread safe
     void setCapacity(const uint64_t newCapacity) noexcept;
 
     /// @brief get the current capacity of the queue.
-    /// @return current queue capacity
+    /// @return current queue capacity, 1 for a queue which keeps only the latest chunk
     uint64_t getCurrentCapacity() const noexcept;
 
     /// @brief get the maximum capacity of the queue.
@@ -97,6 +117,11 @@ class ChunkQueuePopper
     MemberType_t* getMembers() noexcept;
 
   private:
+    void notifyWaitingProducers(const uint64_t numberOfTakenChunks) noexcept;
+    void withdrawConditionVariable() noexcept;
+    cxx::optional<mepoo::SharedChunk> tryTakeLatestChunk() noexcept;
+    bool hasCompatibleChunkHeaderVersion(const mepoo::SharedChunk& chunk) const noexcept;
+
     MemberType_t* m_chunkQueueDataPtr;
 };
 
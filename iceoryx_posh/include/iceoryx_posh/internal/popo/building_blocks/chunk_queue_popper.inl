@@ -48,20 +48,22 @@ ChunkQueuePopper<ChunkQueueDataType>::getMembers() noexcept
 template <typename ChunkQueueDataType>
 inline cxx::optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::tryPop() noexcept
 {
+    if (getMembers()->m_latestChunkOnly)
+    {
+        return tryTakeLatestChunk();
+    }
+
     auto retVal = getMembers()->m_queue.pop();
 
     // check if queue had an element that was poped and return if so
     if (retVal.has_value())
     {
+        notifyWaitingProducers(1U);
+
         auto chunk = retVal.value().releaseToSharedChunk();
 
-        auto receivedChunkHeaderVersion = chunk.getChunkHeader()->chunkHeaderVersion();
-        if (receivedChunkHeaderVersion != mepoo::ChunkHeader::CHUNK_HEADER_VERSION)
+        if (!hasCompatibleChunkHeaderVersion(chunk))
         {
-            LogError() << "Received chunk with CHUNK_HEADER_VERSION '" << receivedChunkHeaderVersion
-                       << "' but expected '" << mepoo::ChunkHeader::CHUNK_HEADER_VERSION << "'! Dropping chunk!";
-            errorHandler(PoshError::POPO__CHUNK_QUEUE_POPPER_CHUNK_WITH_INCOMPATIBLE_CHUNK_HEADER_VERSION,
-                         ErrorLevel::SEVERE);
             return cxx::nullopt_t();
         }
         return cxx::make_optional<mepoo::SharedChunk>(chunk);
@@ -72,6 +74,84 @@ inline cxx::optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::t
     }
 }
 
+template <typename ChunkQueueDataType>
+template <uint64_t Capacity>
+inline uint64_t ChunkQueuePopper<ChunkQueueDataType>::tryPopMany(cxx::vector<mepoo::SharedChunk, Capacity>& chunks,
+                                                                 const uint64_t maxNumberOfChunks) noexcept
+{
+    const uint64_t numberOfChunksToPop = std::min(maxNumberOfChunks, chunks.capacity() - chunks.size());
+
+    if (getMembers()->m_latestChunkOnly)
+    {
+        if (numberOfChunksToPop == 0U)
+        {
+            return 0U;
+        }
+        auto latestChunk = tryTakeLatestChunk();
+        if (!latestChunk.has_value())
+        {
+            return 0U;
+        }
+        chunks.emplace_back(std::move(latestChunk.value()));
+        return 1U;
+    }
+
+    cxx::vector<mepoo::ShmSafeUnmanagedChunk, Capacity> unmanagedChunks(numberOfChunksToPop);
+    const uint64_t numberOfPoppedChunks = getMembers()->m_queue.popMany(unmanagedChunks.data(), numberOfChunksToPop);
+
+    if (numberOfPoppedChunks == 0U)
+    {
+        return 0U;
+    }
+
+    notifyWaitingProducers(numberOfPoppedChunks);
+
+    uint64_t numberOfAppendedChunks{0U};
+    for (uint64_t i = 0U; i < numberOfPoppedChunks; ++i)
+    {
+        auto chunk = unmanagedChunks[i].releaseToSharedChunk();
+        if (hasCompatibleChunkHeaderVersion(chunk))
+        {
+            chunks.emplace_back(std::move(chunk));
+            ++numberOfAppendedChunks;
+        }
+    }
+    return numberOfAppendedChunks;
+}
+
+template <typename ChunkQueueDataType>
+inline cxx::optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::tryTakeLatestChunk() noexcept
+{
+    auto latestChunk = getMembers()->m_latestChunk.exchange(mepoo::ShmSafeUnmanagedChunk(), std::memory_order_acq_rel);
+    if (latestChunk.isLogicalNullptr())
+    {
+        return cxx::nullopt_t();
+    }
+
+    auto chunk = latestChunk.releaseToSharedChunk();
+    if (!hasCompatibleChunkHeaderVersion(chunk))
+    {
+        return cxx::nullopt_t();
+    }
+    return cxx::make_optional<mepoo::SharedChunk>(chunk);
+}
+
+template <typename ChunkQueueDataType>
+inline bool
+ChunkQueuePopper<ChunkQueueDataType>::hasCompatibleChunkHeaderVersion(const mepoo::SharedChunk& chunk) const noexcept
+{
+    auto receivedChunkHeaderVersion = chunk.getChunkHeader()->chunkHeaderVersion();
+    if (receivedChunkHeaderVersion != mepoo::ChunkHeader::CHUNK_HEADER_VERSION)
+    {
+        LogError() << "Received chunk with CHUNK_HEADER_VERSION '" << receivedChunkHeaderVersion << "' but expected '"
+                   << mepoo::ChunkHeader::CHUNK_HEADER_VERSION << "'! Dropping chunk!";
+        errorHandler(PoshError::POPO__CHUNK_QUEUE_POPPER_CHUNK_WITH_INCOMPATIBLE_CHUNK_HEADER_VERSION,
+                     ErrorLevel::SEVERE);
+        return false;
+    }
+    return true;
+}
+
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePopper<ChunkQueueDataType>::hasLostChunks() noexcept
 {
@@ -86,24 +166,40 @@ inline bool ChunkQueuePopper<ChunkQueueDataType>::hasLostChunks() noexcept
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePopper<ChunkQueueDataType>::empty() const noexcept
 {
+    if (getMembers()->m_latestChunkOnly)
+    {
+        return getMembers()->m_latestChunk.load(std::memory_order_relaxed).isLogicalNullptr();
+    }
     return getMembers()->m_queue.empty();
 }
 
 template <typename ChunkQueueDataType>
 inline uint64_t ChunkQueuePopper<ChunkQueueDataType>::size() noexcept
 {
+    if (getMembers()->m_latestChunkOnly)
+    {
+        return empty() ? 0U : 1U;
+    }
     return getMembers()->m_queue.size();
 }
 
 template <typename ChunkQueueDataType>
 inline void ChunkQueuePopper<ChunkQueueDataType>::setCapacity(const uint64_t newCapacity) noexcept
 {
-    getMembers()->m_queue.setCapacity(newCapacity);
+    // the single slot of a queue which keeps only the latest chunk has no capacity to adjust
+    if (!getMembers()->m_latestChunkOnly)
+    {
+        getMembers()->m_queue.setCapacity(newCapacity);
+    }
 }
 
 template <typename ChunkQueueDataType>
 inline uint64_t ChunkQueuePopper<ChunkQueueDataType>::getCurrentCapacity() const noexcept
 {
+    if (getMembers()->m_latestChunkOnly)
+    {
+        return 1U;
+    }
     return getMembers()->m_queue.capacity();
 }
 
@@ -116,11 +212,50 @@ inline uint64_t ChunkQueuePopper<ChunkQueueDataType>::getMaximumCapacity() const
 template <typename ChunkQueueDataType>
 inline void ChunkQueuePopper<ChunkQueueDataType>::clear() noexcept
 {
+    auto latestChunk = getMembers()->m_latestChunk.exchange(mepoo::ShmSafeUnmanagedChunk(), std::memory_order_acq_rel);
+    if (!latestChunk.isLogicalNullptr())
+    {
+        latestChunk.releaseToSharedChunk();
+    }
+
+    uint64_t numberOfTakenChunks{0U};
     while (auto maybeUnmanagedChunk = getMembers()->m_queue.pop())
     {
         // AXIVION Next Construct AutosarC++19_03-A0.1.2 : d'tor of SharedChunk will release the memory, so RAII has the
         // side effect here and return value does not need to be evaluated
         maybeUnmanagedChunk.value().releaseToSharedChunk();
+        ++numberOfTakenChunks;
+    }
+    notifyWaitingProducers(numberOfTakenChunks);
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePopper<ChunkQueueDataType>::notifyWaitingProducers(const uint64_t numberOfTakenChunks) noexcept
+{
+    if (!getMembers()->m_spaceAvailableSemaphore.has_value())
+    {
+        return;
+    }
+
+    // every taken chunk wakes up at most one waiting producer; the producer finds its slot freed and knows that a post
+    // belongs to it, therefore the semaphore is never posted without a waiter
+    uint64_t numberOfWokenProducers{0U};
+    for (auto& slot : getMembers()->m_waitingProducers)
+    {
+        if (numberOfWokenProducers == numberOfTakenChunks)
+        {
+            break;
+        }
+        uint64_t waitingProducer = slot.load(std::memory_order_seq_cst);
+        if (waitingProducer != 0U
+            && slot.compare_exchange_strong(
+                waitingProducer, 0U, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            getMembers()->m_spaceAvailableSemaphore->post().or_else([](auto) {
+                errorHandler(PoshError::POPO__CHUNK_QUEUE_POPPER_SEMAPHORE_CORRUPTED_IN_NOTIFY, ErrorLevel::FATAL);
+            });
+            ++numberOfWokenProducers;
+        }
     }
 }
 
@@ -130,8 +265,10 @@ inline void ChunkQueuePopper<ChunkQueueDataType>::setConditionVariable(Condition
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
+    withdrawConditionVariable();
     getMembers()->m_conditionVariableDataPtr = &conditionVariableDataRef;
     getMembers()->m_conditionVariableNotificationIndex.emplace(notificationIndex);
+    getMembers()->m_isConditionVariablePublished.store(true, std::memory_order_release);
 }
 
 template <typename ChunkQueueDataType>
@@ -139,10 +276,48 @@ inline void ChunkQueuePopper<ChunkQueueDataType>::unsetConditionVariable() noexc
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
+    withdrawConditionVariable();
     getMembers()->m_conditionVariableDataPtr = nullptr;
     getMembers()->m_conditionVariableNotificationIndex.reset();
 }
 
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePopper<ChunkQueueDataType>::withdrawConditionVariable() noexcept
+{
+    // a notifier either sees the withdrawn publication or is registered as active notifier when we look at the
+    // counter, in the latter case we have to wait until it is done with the condition variable
+    getMembers()->m_isConditionVariablePublished.store(false, std::memory_order_seq_cst);
+    auto hasActiveNotifiers = [this] {
+        for (auto& slot : getMembers()->m_activeNotifiers)
+        {
+            if (slot.load(std::memory_order_seq_cst) != 0U)
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+    if (!hasActiveNotifiers())
+    {
+        return;
+    }
+
+    // a live notifier could still use the condition variable, therefore we must not give up; the slot of a producer
+    // which died while notifying is freed by RouDi
+    cxx::DeadlineTimer timeout(CHUNK_QUEUE_NOTIFIER_TIMEOUT);
+    bool hasWarned{false};
+    cxx::internal::adaptive_wait adaptiveWait;
+    adaptiveWait.wait_loop([&] {
+        if (!hasWarned && timeout.hasExpired())
+        {
+            LogWarn() << "Still waiting for the producers to leave the notification of the queue! This indicates that "
+                         "a producing application was terminated while notifying and was not yet cleaned up.";
+            hasWarned = true;
+        }
+        return hasActiveNotifiers();
+    });
+}
+
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePopper<ChunkQueueDataType>::isConditionVariableSet() const noexcept
 {
@@ -17,12 +17,18 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_PUSHER_HPP
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_PUSHER_HPP
 
+#include "iceoryx_hoofs/cxx/deadline_timer.hpp"
 #include "iceoryx_hoofs/cxx/expected.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/internal/cxx/adaptive_wait.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 
+#include <chrono>
+#include <limits>
+
 namespace iox
 {
 namespace popo
@@ -37,7 +43,13 @@ class ChunkQueuePusher
   public:
     using MemberType_t = ChunkQueueDataType;
 
-    explicit ChunkQueuePusher(cxx::not_null<MemberType_t* const> chunkQueueDataPtr) noexcept;
+    /// @brief the notifier id of a pusher whose notifications are not cleaned up by RouDi
+    static constexpr uint64_t ANONYMOUS_NOTIFIER_ID{std::numeric_limits<uint64_t>::max()};
+
+    /// @param[in] chunkQueueDataPtr the data of the queue
+    /// @param[in] notifierId identifies the producer while it notifies the queue, it must be unique and not 0
+    explicit ChunkQueuePusher(cxx::not_null<MemberType_t* const> chunkQueueDataPtr,
+                              const uint64_t notifierId = ANONYMOUS_NOTIFIER_ID) noexcept;
 
     ChunkQueuePusher(const ChunkQueuePusher& other) = delete;
     ChunkQueuePusher& operator=(const ChunkQueuePusher&) = delete;
@@ -45,11 +57,55 @@ class ChunkQueuePusher
     ChunkQueuePusher& operator=(ChunkQueuePusher&& rhs) noexcept = default;
     ~ChunkQueuePusher() noexcept = default;
 
-    /// @brief push a new chunk to the chunk queue
+    /// @brief push a new chunk to the chunk queue, a queue which keeps only the latest chunk replaces the previous one
     /// @param[in] shared chunk object
     /// @return false if a queue overflow occurred, otherwise true
     bool push(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief push a new chunk to the chunk queue; if the queue is full, wait until the consumer took a chunk or the
+    /// timeout has passed and try it once more. Only a queue with QueueFullPolicy::BLOCK_PRODUCER supports waiting,
+    /// for all other queues this is the same as push without timeout. When more producers wait than the queue has
+    /// waiting slots, the additional producers poll the queue until the timeout has passed
+    /// @param[in] shared chunk object
+    /// @param[in] timeout is the maximum time to wait for free space in the queue
+    /// @return false if the chunk could not be pushed, otherwise true
+    bool push(mepoo::SharedChunk chunk, const units::Duration& timeout) noexcept;
+
+    /// @brief wait until the consumer took a chunk out of the full queue or the timeout has passed, returns right away
+    /// when the queue is not full. This lets a producer check whether it still shall deliver to the queue before it
+    /// pushes the chunk. Only a queue with QueueFullPolicy::BLOCK_PRODUCER supports waiting
+    /// @param[in] timeout is the maximum time to wait for free space in the queue
+    void waitForSpace(const units::Duration& timeout) noexcept;
+
+    /// @brief push a new chunk to the chunk queue without notifying the consumer; used to push several chunks in a
+    /// row which are announced with a single call to notify
+    /// @param[in] shared chunk object
+    /// @return false if a queue overflow occurred, otherwise true
+    bool pushWithoutNotification(mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief applies the decimation and the rate limit of the consumer to the next chunk which is offered to the
+    /// queue, must be called once for every offered chunk before it is pushed
+    /// @return true if the chunk shall be dropped without pushing it, otherwise false
+    bool isNextChunkFilteredOut() noexcept;
+
+    /// @brief notify the consumer that there are new chunks in the queue
+    void notify() noexcept;
+
+    /// @brief frees the notifier slots of a producer which died while notifying the queue, the slots of all other
+    /// producers are kept; only used by RouDi
+    /// @param[in] notifierId the notifier id of the dead producer
+    void releaseNotifier(const uint64_t notifierId) noexcept;
+
+    /// @brief frees the waiting slots of a producer which died while waiting for free space in the queue, the slots of
+    /// all other producers are kept; only used by RouDi
+    /// @param[in] notifierId the notifier id of the dead producer
+    void releaseWaitingProducer(const uint64_t notifierId) noexcept;
+
+    /// @brief wakes up a producer which waits for free space in the queue like a consumer which took a chunk, the
+    /// slots of all other producers are kept; used when the queue is removed while the producer waits for it
+    /// @param[in] notifierId the notifier id of the waiting producer
+    void wakeUpWaitingProducer(const uint64_t notifierId) noexcept;
+
     /// @brief tell the queue that it lost a chunk (e.g. because push failed and there will be no retry)
     void lostAChunk() noexcept;
 
@@ -58,7 +114,19 @@ class ChunkQueuePusher
     MemberType_t* getMembers() noexcept;
 
   private:
+    std::atomic<uint64_t>& acquireNotifierSlot() noexcept;
+    std::atomic<uint64_t>* registerWaitingProducer() noexcept;
+    bool takeSpaceAvailablePost(const units::Duration& timeout) noexcept;
+    bool isFull() noexcept;
+
+    /// @brief registers as waiting producer and sleeps until the consumer took a chunk or the timeout has passed when
+    /// hasSucceeded returns false, afterwards hasSucceeded is called once more
+    /// @return the result of the last call to hasSucceeded
+    template <typename Condition_t>
+    bool waitForConsumerUnless(const units::Duration& timeout, const Condition_t& hasSucceeded) noexcept;
+
     MemberType_t* m_chunkQueueDataPtr{nullptr};
+    uint64_t m_notifierId{ANONYMOUS_NOTIFIER_ID};
 };
 
 } // namespace popo
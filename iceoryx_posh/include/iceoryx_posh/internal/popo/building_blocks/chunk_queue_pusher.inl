@@ -23,9 +23,10 @@ namespace iox
 namespace popo
 {
 template <typename ChunkQueueDataType>
-inline ChunkQueuePusher<ChunkQueueDataType>::ChunkQueuePusher(
-    cxx::not_null<MemberType_t* const> chunkQueueDataPtr) noexcept
+inline ChunkQueuePusher<ChunkQueueDataType>::ChunkQueuePusher(cxx::not_null<MemberType_t* const> chunkQueueDataPtr,
+                                                               const uint64_t notifierId) noexcept
     : m_chunkQueueDataPtr(chunkQueueDataPtr)
+    , m_notifierId(notifierId)
 {
 }
 
@@ -46,6 +47,25 @@ ChunkQueuePusher<ChunkQueueDataType>::getMembers() noexcept
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk) noexcept
 {
+    const bool hasPushedWithoutOverflow = pushWithoutNotification(chunk);
+    notify();
+    return hasPushedWithoutOverflow;
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::pushWithoutNotification(mepoo::SharedChunk chunk) noexcept
+{
+    if (getMembers()->m_latestChunkOnly)
+    {
+        auto displacedChunk =
+            getMembers()->m_latestChunk.exchange(mepoo::ShmSafeUnmanagedChunk(chunk), std::memory_order_acq_rel);
+        if (!displacedChunk.isLogicalNullptr())
+        {
+            displacedChunk.releaseToSharedChunk();
+        }
+        return true;
+    }
+
     auto pushRet = getMembers()->m_queue.push(chunk);
     bool hasQueueOverflow = false;
 
@@ -57,17 +77,217 @@ inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk)
         hasQueueOverflow = true;
     }
 
+    return !hasQueueOverflow;
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::isNextChunkFilteredOut() noexcept
+{
+    const uint64_t decimation = getMembers()->m_decimation;
+    if (decimation > 1U
+        && getMembers()->m_numberOfOfferedChunks.fetch_add(1U, std::memory_order_relaxed) % decimation != 0U)
+    {
+        return true;
+    }
+
+    const uint64_t minimumPushIntervalNs = getMembers()->m_minimumPushIntervalNs;
+    if (minimumPushIntervalNs != 0U)
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
-        if (getMembers()->m_conditionVariableDataPtr)
+        const auto now = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+                .count());
+        auto lastPushTimestamp = getMembers()->m_lastPushTimestampNs.load(std::memory_order_relaxed);
+        // a timestamp of 0 means that nothing was pushed yet; the steady clock starts at boot, therefore the first
+        // chunk would be dropped during the first interval of the uptime otherwise. The interval is compared via the
+        // difference to not overflow, a newer timestamp from another producer counts as being inside the interval.
+        // When another producer of the queue wins the race for the time slot, the chunk is dropped as well
+        const bool isInsideInterval = lastPushTimestamp != 0U
+                                      && (now < lastPushTimestamp || now - lastPushTimestamp < minimumPushIntervalNs);
+        if (isInsideInterval
+            || !getMembers()->m_lastPushTimestampNs.compare_exchange_strong(
+                lastPushTimestamp, now, std::memory_order_relaxed, std::memory_order_relaxed))
         {
-            ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
-                              *getMembers()->m_conditionVariableNotificationIndex)
-                .notify();
+            return true;
         }
     }
 
-    return !hasQueueOverflow;
+    return false;
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::notify() noexcept
+{
+    // register before looking at the publication, see ChunkQueuePopper::withdrawConditionVariable
+    auto& notifierSlot = acquireNotifierSlot();
+    if (getMembers()->m_isConditionVariablePublished.load(std::memory_order_seq_cst))
+    {
+        ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
+                          *getMembers()->m_conditionVariableNotificationIndex)
+            .notify();
+    }
+    notifierSlot.store(0U, std::memory_order_release);
+}
+
+template <typename ChunkQueueDataType>
+inline std::atomic<uint64_t>& ChunkQueuePusher<ChunkQueueDataType>::acquireNotifierSlot() noexcept
+{
+    // all slots are only occupied when more producers notify at the same time than there are slots or when dead
+    // producers were not yet cleaned up by RouDi
+    cxx::internal::adaptive_wait adaptiveWait;
+    while (true)
+    {
+        for (auto& slot : getMembers()->m_activeNotifiers)
+        {
+            uint64_t expected{0U};
+            if (slot.compare_exchange_strong(
+                    expected, m_notifierId, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                return slot;
+            }
+        }
+        adaptiveWait.wait();
+    }
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::releaseNotifier(const uint64_t notifierId) noexcept
+{
+    for (auto& slot : getMembers()->m_activeNotifiers)
+    {
+        uint64_t expected{notifierId};
+        slot.compare_exchange_strong(expected, 0U, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::releaseWaitingProducer(const uint64_t notifierId) noexcept
+{
+    for (auto& slot : getMembers()->m_waitingProducers)
+    {
+        uint64_t expected{notifierId};
+        slot.compare_exchange_strong(expected, 0U, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+}
+
+template <typename ChunkQueueDataType>
+inline std::atomic<uint64_t>* ChunkQueuePusher<ChunkQueueDataType>::registerWaitingProducer() noexcept
+{
+    for (auto& slot : getMembers()->m_waitingProducers)
+    {
+        uint64_t expected{0U};
+        if (slot.compare_exchange_strong(expected, m_notifierId, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return &slot;
+        }
+    }
+    return nullptr;
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::wakeUpWaitingProducer(const uint64_t notifierId) noexcept
+{
+    if (!getMembers()->m_spaceAvailableSemaphore.has_value())
+    {
+        return;
+    }
+
+    // the same handshake as for a taken chunk, the producer finds its slot freed and knows that the post belongs to it
+    for (auto& slot : getMembers()->m_waitingProducers)
+    {
+        uint64_t expected{notifierId};
+        if (slot.compare_exchange_strong(expected, 0U, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            getMembers()->m_spaceAvailableSemaphore->post().or_else([](auto) {
+                errorHandler(PoshError::POPO__CHUNK_QUEUE_PUSHER_SEMAPHORE_CORRUPTED_IN_POST, ErrorLevel::FATAL);
+            });
+        }
+    }
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::takeSpaceAvailablePost(const units::Duration& timeout) noexcept
+{
+    bool hasTakenAPost{false};
+    getMembers()
+        ->m_spaceAvailableSemaphore->timedWait(timeout)
+        .and_then([&](auto waitState) { hasTakenAPost = (waitState == posix::SemaphoreWaitState::NO_TIMEOUT); })
+        .or_else([](auto) {
+            errorHandler(PoshError::POPO__CHUNK_QUEUE_PUSHER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT, ErrorLevel::FATAL);
+        });
+    return hasTakenAPost;
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::isFull() noexcept
+{
+    return !getMembers()->m_latestChunkOnly && getMembers()->m_queue.size() >= getMembers()->m_queue.capacity();
+}
+
+template <typename ChunkQueueDataType>
+template <typename Condition_t>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::waitForConsumerUnless(const units::Duration& timeout,
+                                                                        const Condition_t& hasSucceeded) noexcept
+{
+    if (!getMembers()->m_spaceAvailableSemaphore.has_value())
+    {
+        return hasSucceeded();
+    }
+
+    // register as waiting producer before trying it, otherwise a chunk taken by the consumer right after a failed
+    // try would not wake us up
+    auto waitingSlot = registerWaitingProducer();
+    if (waitingSlot == nullptr)
+    {
+        cxx::DeadlineTimer deadline(timeout);
+        cxx::internal::adaptive_wait adaptiveWait;
+        bool hasSucceededInTime{false};
+        adaptiveWait.wait_loop([&] {
+            hasSucceededInTime = hasSucceeded();
+            return !hasSucceededInTime && !deadline.hasExpired();
+        });
+        return hasSucceededInTime;
+    }
+
+    bool hasSucceededInTime = hasSucceeded();
+    bool hasTakenAPost{false};
+    if (!hasSucceededInTime)
+    {
+        hasTakenAPost = takeSpaceAvailablePost(timeout);
+        hasSucceededInTime = hasSucceeded();
+    }
+
+    // the consumer frees the slot of exactly one producer for every post; whoever takes the post, the producer whose
+    // slot was freed ends up with it, therefore no post is left behind for a later producer
+    uint64_t expected{m_notifierId};
+    const bool isStillRegistered =
+        waitingSlot->compare_exchange_strong(expected, 0U, std::memory_order_seq_cst, std::memory_order_relaxed);
+    if (!isStillRegistered && !hasTakenAPost)
+    {
+        // the consumer freed the slot after the timeout or a successful try, its post is about to arrive
+        takeSpaceAvailablePost(timeout);
+    }
+    else if (isStillRegistered && hasTakenAPost)
+    {
+        // the post was meant for another producer whose slot was freed, it is handed over
+        getMembers()->m_spaceAvailableSemaphore->post().or_else([](auto) {
+            errorHandler(PoshError::POPO__CHUNK_QUEUE_PUSHER_SEMAPHORE_CORRUPTED_IN_POST, ErrorLevel::FATAL);
+        });
+    }
+
+    return hasSucceededInTime;
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk,
+                                                       const units::Duration& timeout) noexcept
+{
+    return waitForConsumerUnless(timeout, [&] { return push(chunk); });
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::waitForSpace(const units::Duration& timeout) noexcept
+{
+    waitForConsumerUnless(timeout, [&] { return !isFull(); });
 }
 
 template <typename ChunkQueueDataType>
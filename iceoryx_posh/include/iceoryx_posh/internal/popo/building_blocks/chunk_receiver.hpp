@@ -20,10 +20,13 @@
 #include "iceoryx_hoofs/cxx/expected.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver_data.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 
+#include <algorithm>
+
 namespace iox
 {
 namespace popo
@@ -63,6 +66,7 @@ class ChunkReceiver : public ChunkQueuePopper<typename ChunkReceiverDataType::Ch
   public:
     using MemberType_t = ChunkReceiverDataType;
     using Base_t = ChunkQueuePopper<typename ChunkReceiverDataType::ChunkQueueData_t>;
+    using ChunkHeaderBatch_t = cxx::vector<const mepoo::ChunkHeader*, MemberType_t::MAX_CHUNKS_IN_USE>;
 
     explicit ChunkReceiver(cxx::not_null<MemberType_t* const> chunkReceiverDataPtr) noexcept;
 
@@ -79,6 +83,15 @@ class ChunkReceiver : public ChunkQueuePopper<typename ChunkReceiverDataType::Ch
     /// or if there are no new chunks in the underlying queue
     cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGet() noexcept;
 
+    /// @brief Tries to get up to maxNumberOfChunks received chunks in one pass. The chunks are popped from the
+    /// underlying queue at once and are stored in the list of used chunks with a single synchronization. Only as many
+    /// chunks as can be held in parallel are popped, so no chunk is dropped because the user holds too many of them
+    /// @param[out] chunkHeaders the ChunkHeaders of the new chunks are appended to this vector
+    /// @param[in] maxNumberOfChunks the maximum number of chunks to get
+    /// @return ChunkReceiveResult on error or if there are no new chunks in the underlying queue
+    cxx::expected<ChunkReceiveResult> tryGetMany(ChunkHeaderBatch_t& chunkHeaders,
+                                                 const uint64_t maxNumberOfChunks) noexcept;
+
     /// @brief Release a chunk that was obtained with get
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void release(const mepoo::ChunkHeader* const chunkHeader) noexcept;
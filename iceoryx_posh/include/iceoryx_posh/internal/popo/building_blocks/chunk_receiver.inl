@@ -97,6 +97,37 @@ ChunkReceiver<ChunkReceiverDataType>::tryGet() noexcept
     return cxx::error<ChunkReceiveResult>(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
 }
 
+template <typename ChunkReceiverDataType>
+inline cxx::expected<ChunkReceiveResult>
+ChunkReceiver<ChunkReceiverDataType>::tryGetMany(ChunkHeaderBatch_t& chunkHeaders,
+                                                 const uint64_t maxNumberOfChunks) noexcept
+{
+    auto& chunksInUse = getMembers()->m_chunksInUse;
+
+    // only pop what can be stored in the used chunk list, contrary to tryGet no chunk is released on the floor
+    const uint64_t numberOfChunksToGet = std::min({maxNumberOfChunks,
+                                                   static_cast<uint64_t>(chunksInUse.freeSpace()),
+                                                   chunkHeaders.capacity() - chunkHeaders.size()});
+    if (numberOfChunksToGet == 0U)
+    {
+        return (this->empty()) ? cxx::error<ChunkReceiveResult>(ChunkReceiveResult::NO_CHUNK_AVAILABLE)
+                               : cxx::error<ChunkReceiveResult>(ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
+    }
+
+    cxx::vector<mepoo::SharedChunk, MemberType_t::MAX_CHUNKS_IN_USE> chunks;
+    if (this->tryPopMany(chunks, numberOfChunksToGet) == 0U)
+    {
+        return cxx::error<ChunkReceiveResult>(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+    }
+
+    chunksInUse.insert(chunks);
+    for (const auto& chunk : chunks)
+    {
+        chunkHeaders.emplace_back(const_cast<const mepoo::ChunkHeader*>(chunk.getChunkHeader()));
+    }
+    return cxx::success<>();
+}
+
 template <typename ChunkReceiverDataType>
 inline void ChunkReceiver<ChunkReceiverDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
@@ -33,7 +33,8 @@ struct ChunkReceiverData : public ChunkQueueDataType
 {
     explicit ChunkReceiverData(const cxx::VariantQueueTypes queueType,
                                const QueueFullPolicy queueFullPolicy,
-                               const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
+                               const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo(),
+                               const bool latestChunkOnly = false) noexcept;
 
     using ChunkQueueData_t = ChunkQueueDataType;
 
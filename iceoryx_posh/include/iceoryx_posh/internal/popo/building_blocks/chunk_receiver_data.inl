@@ -25,8 +25,9 @@ template <uint32_t MaxChunksHeldSimultaneously, typename ChunkQueueDataType>
 inline ChunkReceiverData<MaxChunksHeldSimultaneously, ChunkQueueDataType>::ChunkReceiverData(
     const cxx::VariantQueueTypes queueType,
     const QueueFullPolicy queueFullPolicy,
-    const mepoo::MemoryInfo& memoryInfo) noexcept
-    : ChunkQueueDataType(queueFullPolicy, queueType)
+    const mepoo::MemoryInfo& memoryInfo,
+    const bool latestChunkOnly) noexcept
+    : ChunkQueueDataType(queueFullPolicy, queueType, latestChunkOnly)
     , m_memoryInfo(memoryInfo)
 {
 }
@@ -20,6 +20,7 @@
 #include "iceoryx_hoofs/cxx/expected.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_hoofs/internal/cxx/unique_id.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
@@ -80,6 +81,7 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
   public:
     using MemberType_t = ChunkSenderDataType;
     using Base_t = ChunkDistributor<typename ChunkSenderDataType::ChunkDistributorData_t>;
+    using ChunkHeaderBatch_t = cxx::vector<mepoo::ChunkHeader*, MemberType_t::MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY>;
 
     explicit ChunkSender(cxx::not_null<MemberType_t* const> chunkSenderDataPtr) noexcept;
 
@@ -116,6 +118,13 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @return the number of receiver the chunk was send to
     uint64_t send(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Send several allocated chunks in one pass to all connected ChunkQueuePopper. Every queue gets the chunks
+    /// back-to-back and is notified once, the history is updated once for the whole batch
+    /// @param[in] chunkHeaders, pointers to the ChunkHeaders to send in the order of the vector; the ownership of the
+    /// pointers is transferred to this method
+    /// @return the number of receiver the chunks were send to
+    uint64_t sendMany(const ChunkHeaderBatch_t& chunkHeaders) noexcept;
+
     /// @brief Send an allocated chunk to a specific ChunkQueuePopper
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send; the ownership of the pointer is transferred to this
     /// method
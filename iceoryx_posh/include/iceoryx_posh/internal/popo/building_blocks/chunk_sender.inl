@@ -139,7 +139,7 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     {
         // BEGIN of critical section, chunk will be lost if the process terminates in this section
         // get a new chunk
-        auto getChunkResult = getMembers()->m_memoryMgr->getChunk(chunkSettings);
+        auto getChunkResult = getMembers()->m_memoryMgr->getChunk(chunkSettings, getMembers()->m_chunkCache);
 
         if (!getChunkResult.has_error())
         {
@@ -196,6 +196,33 @@ inline uint64_t ChunkSender<ChunkSenderDataType>::send(mepoo::ChunkHeader* const
     return numberOfReceiverTheChunkWasDelivered;
 }
 
+template <typename ChunkSenderDataType>
+inline uint64_t ChunkSender<ChunkSenderDataType>::sendMany(const ChunkHeaderBatch_t& chunkHeaders) noexcept
+{
+    uint64_t numberOfReceiverTheChunksWereDelivered{0};
+    cxx::vector<mepoo::SharedChunk, MemberType_t::MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY> chunks;
+    // BEGIN of critical section, chunks will be lost if the process terminates in this section
+    for (auto chunkHeader : chunkHeaders)
+    {
+        mepoo::SharedChunk chunk(nullptr);
+        if (getChunkReadyForSend(chunkHeader, chunk))
+        {
+            chunks.emplace_back(chunk);
+        }
+    }
+
+    if (!chunks.empty())
+    {
+        numberOfReceiverTheChunksWereDelivered = this->deliverToAllStoredQueues(chunks);
+
+        getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+        getMembers()->m_lastChunkUnmanaged = chunks.back();
+    }
+    // END of critical section
+
+    return numberOfReceiverTheChunksWereDelivered;
+}
+
 template <typename ChunkSenderDataType>
 inline bool ChunkSender<ChunkSenderDataType>::sendToQueue(mepoo::ChunkHeader* const chunkHeader,
                                                           const cxx::UniqueId uniqueQueueId,
@@ -251,6 +278,7 @@ inline void ChunkSender<ChunkSenderDataType>::releaseAll() noexcept
     getMembers()->m_chunksInUse.cleanup();
     this->cleanup();
     getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+    getMembers()->m_chunkCache.drain();
 }
 
 template <typename ChunkSenderDataType>
@@ -26,10 +26,13 @@ inline ChunkSenderData<MaxChunksAllocatedSimultaneously, ChunkDistributorDataTyp
     cxx::not_null<mepoo::MemoryManager* const> memoryManager,
     const ConsumerTooSlowPolicy consumerTooSlowPolicy,
     const uint64_t historyCapacity,
-    const mepoo::MemoryInfo& memoryInfo) noexcept
-    : ChunkDistributorDataType(consumerTooSlowPolicy, historyCapacity)
+    const mepoo::MemoryInfo& memoryInfo,
+    const uint64_t parallelDeliveryThreshold,
+    const bool useChunkCache) noexcept
+    : ChunkDistributorDataType(consumerTooSlowPolicy, historyCapacity, parallelDeliveryThreshold)
     , m_memoryMgr(memoryManager)
     , m_memoryInfo(memoryInfo)
+    , m_chunkCache(useChunkCache)
 {
 }
 
@@ -19,6 +19,7 @@
 
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/notification_socket.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 
 namespace iox
@@ -32,7 +33,7 @@ class ConditionListener
     using NotificationVector_t = cxx::vector<cxx::BestFittingType_t<MAX_NUMBER_OF_NOTIFIERS>, MAX_NUMBER_OF_NOTIFIERS>;
 
     explicit ConditionListener(ConditionVariableData& condVarData) noexcept;
-    ~ConditionListener() noexcept = default;
+    ~ConditionListener() noexcept;
     ConditionListener(const ConditionListener& rhs) = delete;
     ConditionListener(ConditionListener&& rhs) noexcept = delete;
     ConditionListener& operator=(const ConditionListener& rhs) = delete;
@@ -48,6 +49,29 @@ class ConditionListener
     ///         returns an empty vector.
     void destroy() noexcept;
 
+    /// @brief Sets how long wait() and timedWait() poll for notifications before they block. During the spin budget
+    /// the listener checks the active notifications with a cpu pause in between and causes no syscall. Every push
+    /// into an attached queue sets a notification, therefore the queues themselves do not have to be polled.
+    /// @param[in] spinBudget zero (default) blocks right away, units::Duration::max() is the pure polling mode
+    /// which never blocks
+    /// @note the spin budget can be changed while another thread waits, it takes effect with the next wait
+    void setSpinBudget(const units::Duration spinBudget) noexcept;
+
+    /// @brief returns the time wait() and timedWait() poll for notifications before they block
+    units::Duration getSpinBudget() const noexcept;
+
+    /// @brief Returns a file descriptor which is readable as long as notifications are pending, it can be used in
+    /// select, poll or epoll based event loops. wait() and timedWait() make it unreadable again when they collect the
+    /// notifications, a readable file descriptor can therefore be handled with timedWait(units::Duration::zero()).
+    /// The file descriptor is created with the first call and stays valid as long as the ConditionListener exists.
+    /// @note must not be called concurrently to wait() or timedWait()
+    /// @return the file descriptor or an error if it could not be created
+    cxx::expected<int32_t, NotificationSocketError> getFileDescriptor() noexcept;
+
+    /// @brief makes the file descriptor readable without a notification, useful when notifications were collected
+    /// but not all of them were handled. Does nothing when getFileDescriptor() was never called.
+    void signalFileDescriptor() noexcept;
+
     /// @brief returns a sorted vector of indices of active notifications; blocking if ConditionVariableData was
     /// not notified unless destroy() was called before. The indices of active notifications are
     /// never empty unless destroy() was called, then it's always empty.
@@ -69,14 +93,19 @@ class ConditionListener
     ConditionVariableData* getMembers() noexcept;
 
   private:
-    void resetUnchecked(const uint64_t index) noexcept;
+    void collectActiveNotifications(NotificationVector_t& activeNotifications) noexcept;
+    bool hasPendingNotifications() const noexcept;
     void resetSemaphore() noexcept;
 
-    NotificationVector_t waitImpl(const cxx::function_ref<bool()>& waitCall) noexcept;
+    NotificationVector_t waitImpl(const cxx::function_ref<bool()>& waitCall,
+                                  const units::Duration pollTime) noexcept;
+    bool pollForNotifications(const units::Duration pollTime) const noexcept;
 
   private:
     ConditionVariableData* m_condVarDataPtr{nullptr};
     std::atomic_bool m_toBeDestroyed{false};
+    std::atomic<uint64_t> m_spinBudgetInNanoseconds{0U};
+    cxx::optional<NotificationSocket> m_notificationSocket;
 };
 
 } // namespace popo
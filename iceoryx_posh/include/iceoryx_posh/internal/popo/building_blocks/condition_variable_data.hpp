@@ -17,11 +17,16 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CONDITION_VARIABLE_DATA_HPP
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CONDITION_VARIABLE_DATA_HPP
 
+#include "iceoryx_hoofs/internal/concurrent/cache_line_padding.hpp"
+#include "iceoryx_hoofs/internal/concurrent/futex_semaphore.hpp"
 #include "iceoryx_hoofs/posix_wrapper/unnamed_semaphore.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 
+#include "iceoryx_platform/platform_settings.hpp"
+
 #include <atomic>
+#include <type_traits>
 
 namespace iox
 {
@@ -29,6 +34,12 @@ namespace popo
 {
 struct ConditionVariableData
 {
+    /// @brief the futex semaphore wakes the listener without a drain loop and only with a syscall when the listener
+    /// sleeps, the posix semaphore is the fallback for platforms without futexes
+    using Semaphore_t = std::conditional<platform::IOX_SUPPORT_FUTEX,
+                                         concurrent::FutexSemaphore,
+                                         posix::UnnamedSemaphore>::type;
+
     ConditionVariableData() noexcept;
     explicit ConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
 
@@ -38,11 +49,50 @@ struct ConditionVariableData
     ConditionVariableData& operator=(ConditionVariableData&& rhs) = delete;
     ~ConditionVariableData() noexcept = default;
 
-    cxx::optional<posix::UnnamedSemaphore> m_semaphore;
+    static constexpr uint64_t NOTIFICATION_WORD_SIZE{64U};
+    static constexpr uint64_t NUMBER_OF_NOTIFICATION_WORDS{
+        (MAX_NUMBER_OF_NOTIFIERS + NOTIFICATION_WORD_SIZE - 1U) / NOTIFICATION_WORD_SIZE};
+
+    /// @brief returns the index of the word in m_activeNotifications which contains the bit of the notifier index
+    static constexpr uint64_t notificationWordIndex(const uint64_t notifierIndex) noexcept
+    {
+        return notifierIndex / NOTIFICATION_WORD_SIZE;
+    }
+
+    /// @brief returns the bit mask of the notifier index in its word of m_activeNotifications
+    static constexpr uint64_t notificationBitMask(const uint64_t notifierIndex) noexcept
+    {
+        return static_cast<uint64_t>(1U) << (notifierIndex % NOTIFICATION_WORD_SIZE);
+    }
+
+    /// @brief forgets the waiters which are registered at the semaphore; only used by RouDi when the process of the
+    /// listener died, the notifiers would wake up a dead waiter with a syscall otherwise
+    void resetWaiters() noexcept;
+
+    /// @brief the notifiers and the listener run in different processes, therefore the members are grouped by the
+    /// side which writes them and the groups are separated by a cache line. The first group is written by the
+    /// listener when it goes to sleep and by a notifier which wakes it up.
+    cxx::optional<Semaphore_t> m_semaphore;
+    /// @brief set by the ConditionListener before it waits on the semaphore; as long as it is not set, a notifier
+    /// whose notification is still pending does not need to post the semaphore since the listener collects the
+    /// notification before it goes to sleep
+    std::atomic_bool m_isListenerSleeping{false};
+    concurrent::CacheLinePadding m_sleepPadding;
+
+    /// @brief only written when the condition variable is set up or torn down, RouDi polls m_toBeDestroyed
     RuntimeName_t m_runtimeName;
     std::atomic_bool m_toBeDestroyed{false};
-    std::atomic_bool m_activeNotifications[MAX_NUMBER_OF_NOTIFIERS];
+    /// @brief the id of the NotificationSocket of the listener, a notifier signals it when it sets a notification
+    /// which was not pending so that the file descriptor of the listener becomes readable; zero when the listener has
+    /// no file descriptor
+    std::atomic<uint64_t> m_notificationSocketId{0U};
+    concurrent::CacheLinePadding m_setupPadding;
+
+    /// @brief one bit per notifier index, the listener collects a whole word with a single exchange
+    std::atomic<uint64_t> m_activeNotifications[NUMBER_OF_NOTIFICATION_WORDS];
     std::atomic_bool m_wasNotified{false};
+    /// @brief the data of the next condition variable in shared memory starts behind this padding
+    concurrent::CacheLinePadding m_notificationPadding;
 };
 
 } // namespace popo
@@ -0,0 +1,97 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_DELIVERY_THREAD_POOL_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_DELIVERY_THREAD_POOL_HPP
+
+#include "iceoryx_hoofs/cxx/function_ref.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/posix_wrapper/unnamed_semaphore.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief A small pool of threads which helps the calling thread to execute a number of independent tasks, it is
+///        used by the ChunkDistributor to push a chunk into many queues in parallel. The calling thread always takes
+///        part in the execution and run() returns when all tasks are finished.
+///        The tasks are claimed in blocks from a shared counter, therefore a delivery thread which wakes up late
+///        finds no work left and does not delay the caller.
+class DeliveryThreadPool
+{
+  public:
+    using Task_t = cxx::function_ref<void(const uint64_t)>;
+
+    /// @brief the number of tasks which are claimed at once
+    static constexpr uint64_t TASK_BLOCK_SIZE{4U};
+
+    /// @brief starts the delivery threads
+    /// @param[in] numberOfThreads the number of delivery threads in addition to the calling thread, limited to
+    ///            MAX_NUMBER_OF_DELIVERY_THREADS; with zero all tasks are executed by the calling thread
+    explicit DeliveryThreadPool(const uint64_t numberOfThreads) noexcept;
+
+    /// @brief stops and joins the delivery threads
+    ~DeliveryThreadPool() noexcept;
+
+    DeliveryThreadPool(const DeliveryThreadPool&) = delete;
+    DeliveryThreadPool(DeliveryThreadPool&&) = delete;
+    DeliveryThreadPool& operator=(const DeliveryThreadPool&) = delete;
+    DeliveryThreadPool& operator=(DeliveryThreadPool&&) = delete;
+
+    /// @brief returns the pool of the process which is shared by all publishers. It is created with the first call
+    ///        and uses one thread less than the hardware provides, at most MAX_NUMBER_OF_DELIVERY_THREADS.
+    static DeliveryThreadPool& instance() noexcept;
+
+    /// @brief executes task(index) for every index in [0, numberOfTasks) and returns when all of them are finished.
+    ///        When the pool is already in use by another thread the calling thread executes all tasks alone.
+    /// @param[in] numberOfTasks the number of tasks
+    /// @param[in] task the task which is called with the index of the task, must be safe to be called concurrently
+    ///            with different indices
+    void run(const uint64_t numberOfTasks, const Task_t& task) noexcept;
+
+    /// @brief returns the number of delivery threads
+    uint64_t numberOfThreads() const noexcept;
+
+  private:
+    void threadLoop() noexcept;
+    void executeTasks() noexcept;
+
+  private:
+    static constexpr uint64_t RUN_CLOSED{1ULL << 63U};
+
+    uint64_t m_numberOfThreads{0U};
+    std::atomic_bool m_keepRunning{true};
+    cxx::optional<posix::UnnamedSemaphore> m_wakeUp;
+    std::mutex m_runMutex;
+
+    const Task_t* m_task{nullptr};
+    uint64_t m_numberOfTasks{0U};
+    std::atomic<uint64_t> m_nextTask{0U};
+    /// @brief the number of threads which execute tasks of the current run, RUN_CLOSED is set when the run is
+    ///        finished and no thread is allowed to join it anymore
+    std::atomic<uint64_t> m_participants{RUN_CLOSED};
+
+    std::thread m_threads[MAX_NUMBER_OF_DELIVERY_THREADS];
+};
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_DELIVERY_THREAD_POOL_HPP
@@ -0,0 +1,114 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_NOTIFICATION_SOCKET_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_NOTIFICATION_SOCKET_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+enum class NotificationSocketError
+{
+    UNABLE_TO_CREATE_SOCKET,
+    UNABLE_TO_BIND_SOCKET
+};
+
+/// @brief A datagram unix domain socket whose file descriptor becomes readable when any process signals it. It
+///        makes the notifications of a ConditionVariableData usable in select, poll or epoll based event loops.
+///        The socket is bound to a path which is derived from its id, therefore a notifier in another process only
+///        needs the id, which is stored in the shared memory, and no file descriptor has to be passed between
+///        the processes.
+class NotificationSocket
+{
+  public:
+    using Id_t = uint64_t;
+    static constexpr Id_t INVALID_ID{0U};
+
+    NotificationSocket(const NotificationSocket&) = delete;
+    NotificationSocket(NotificationSocket&&) = delete;
+    NotificationSocket& operator=(const NotificationSocket&) = delete;
+    NotificationSocket& operator=(NotificationSocket&&) = delete;
+
+    /// @brief closes the socket and removes its path
+    ~NotificationSocket() noexcept;
+
+    /// @brief returns the file descriptor which becomes readable when the socket is signaled
+    int32_t getFileDescriptor() const noexcept;
+
+    /// @brief returns the id with which other processes can signal the socket
+    Id_t getId() const noexcept;
+
+    /// @brief reads all pending signals so that the file descriptor is no longer readable
+    void drain() noexcept;
+
+    /// @brief signals the socket with the provided id with the NotificationSender of the process
+    /// @param[in] id the id of the socket which should be signaled
+    static void signal(const Id_t id) noexcept;
+
+  private:
+    friend class NotificationSocketBuilder;
+    friend class cxx::optional<NotificationSocket>;
+
+    NotificationSocket(const int32_t fileDescriptor, const Id_t id) noexcept;
+
+  private:
+    int32_t m_fileDescriptor{-1};
+    Id_t m_id{INVALID_ID};
+};
+
+/// @brief Owns the unbound non-blocking datagram socket with which a process signals the NotificationSockets of any
+///        process. The socket is created on construction and closed on destruction.
+class NotificationSender
+{
+  public:
+    NotificationSender() noexcept;
+    ~NotificationSender() noexcept;
+
+    NotificationSender(const NotificationSender&) = delete;
+    NotificationSender(NotificationSender&&) = delete;
+    NotificationSender& operator=(const NotificationSender&) = delete;
+    NotificationSender& operator=(NotificationSender&&) = delete;
+
+    /// @brief returns the sender which is shared by all notifiers of the process
+    static NotificationSender& instance() noexcept;
+
+    /// @brief makes the file descriptor of the socket with the provided id readable. This never blocks, when the
+    ///        socket buffer is full it is readable anyway and when the socket does not exist anymore the signal is
+    ///        dropped.
+    /// @param[in] id the id of the socket which should be signaled
+    void signal(const NotificationSocket::Id_t id) noexcept;
+
+  private:
+    int32_t m_fileDescriptor{-1};
+};
+
+class NotificationSocketBuilder
+{
+  public:
+    /// @brief creates a NotificationSocket which is bound to a path that is unique for the calling process
+    /// @param[in] socket the optional in which the NotificationSocket is created
+    /// @return an error describing the failure or success
+    cxx::expected<NotificationSocketError> create(cxx::optional<NotificationSocket>& socket) const noexcept;
+};
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_NOTIFICATION_SOCKET_HPP
@@ -88,6 +88,18 @@ inline void ListenerImpl<Capacity>::detachEvent(T& eventOrigin) noexcept
     NotificationAttorney::disableEvent(eventOrigin);
 }
 
+template <uint64_t Capacity>
+inline void ListenerImpl<Capacity>::setSpinBudget(const units::Duration spinBudget) noexcept
+{
+    m_conditionListener.setSpinBudget(spinBudget);
+}
+
+template <uint64_t Capacity>
+inline units::Duration ListenerImpl<Capacity>::getSpinBudget() const noexcept
+{
+    return m_conditionListener.getSpinBudget();
+}
+
 template <uint64_t Capacity>
 inline constexpr uint64_t ListenerImpl<Capacity>::capacity() noexcept
 {
@@ -96,15 +108,33 @@ inline constexpr uint64_t ListenerImpl<Capacity>::capacity() noexcept
 
 template <uint64_t Capacity>
 inline ListenerImpl<Capacity>::ListenerImpl() noexcept
-    : ListenerImpl(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable())
+    : ListenerImpl(ListenerOptions())
+{
+}
+
+template <uint64_t Capacity>
+inline ListenerImpl<Capacity>::ListenerImpl(const ListenerOptions& options) noexcept
+    : ListenerImpl(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable(), options)
 {
 }
 
 template <uint64_t Capacity>
-inline ListenerImpl<Capacity>::ListenerImpl(ConditionVariableData& conditionVariable) noexcept
+inline ListenerImpl<Capacity>::ListenerImpl(ConditionVariableData& conditionVariable,
+                                            const ListenerOptions& options) noexcept
     : m_conditionVariableData(&conditionVariable)
     , m_conditionListener(conditionVariable)
 {
+    for (uint64_t i = 0U; i < Capacity; ++i)
+    {
+        m_isExecutedByWorker[i].store(false, std::memory_order_relaxed);
+        m_isRemovalDeferred[i].store(false, std::memory_order_relaxed);
+    }
+
+    if (options.numberOfWorkerThreads > 0U)
+    {
+        m_workerPool.emplace(options.numberOfWorkerThreads,
+                             [this](const uint64_t eventId) { executeCallbackOnWorker(eventId); });
+    }
     m_thread = std::thread(&ListenerImpl<Capacity>::threadLoop, this);
 }
 
@@ -115,6 +145,7 @@ inline ListenerImpl<Capacity>::~ListenerImpl() noexcept
     m_conditionListener.destroy();
 
     m_thread.join();
+    m_workerPool.reset();
     m_conditionVariableData->m_toBeDestroyed.store(true, std::memory_order_relaxed);
 }
 
@@ -158,6 +189,12 @@ inline uint64_t ListenerImpl<Capacity>::size() const noexcept
     return m_indexManager.indicesInUse();
 }
 
+template <uint64_t Capacity>
+inline uint64_t ListenerImpl<Capacity>::numberOfWorkerThreads() const noexcept
+{
+    return (m_workerPool) ? m_workerPool->numberOfWorkerThreads() : 0U;
+}
+
 template <uint64_t Capacity>
 inline void ListenerImpl<Capacity>::threadLoop() noexcept
 {
@@ -167,7 +204,14 @@ inline void ListenerImpl<Capacity>::threadLoop() noexcept
 
         for (auto& id : activateNotificationIds)
         {
-            m_events[id]->executeCallback();
+            if (m_workerPool)
+            {
+                m_workerPool->dispatch(id);
+            }
+            else
+            {
+                m_events[id]->executeCallback();
+            }
         }
     }
 }
@@ -180,7 +224,44 @@ inline void ListenerImpl<Capacity>::removeTrigger(const uint64_t index) noexcept
         return;
     }
 
-    if (m_events[index]->reset())
+    if (m_workerPool && m_workerPool->isWorkerThread())
+    {
+        // a callback which waits for the lock of an event whose callback is running deadlocks when that callback
+        // detaches the event of the waiting one, therefore the detach is handed over to the worker of the event
+        m_isRemovalDeferred[index].store(true);
+        if (m_isExecutedByWorker[index].load())
+        {
+            return;
+        }
+
+        auto event = m_events[index].getScopeGuard();
+        if (m_isRemovalDeferred[index].exchange(false) && event->reset())
+        {
+            m_indexManager.push(static_cast<uint32_t>(index));
+        }
+        return;
+    }
+
+    auto event = m_events[index].getScopeGuard();
+    m_isRemovalDeferred[index].store(false);
+    if (event->reset())
+    {
+        m_indexManager.push(static_cast<uint32_t>(index));
+    }
+}
+
+template <uint64_t Capacity>
+inline void ListenerImpl<Capacity>::executeCallbackOnWorker(const uint64_t index) noexcept
+{
+    auto event = m_events[index].getScopeGuard();
+
+    // sequentially consistent, pairs with the check in removeTrigger so that two callbacks which detach each other
+    // cannot both miss that the other one is running
+    m_isExecutedByWorker[index].store(true);
+    event->executeCallback();
+    m_isExecutedByWorker[index].store(false);
+
+    if (m_isRemovalDeferred[index].exchange(false) && event->reset())
     {
         m_indexManager.push(static_cast<uint32_t>(index));
     }
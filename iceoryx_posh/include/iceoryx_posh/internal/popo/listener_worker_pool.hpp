@@ -0,0 +1,100 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_LISTENER_WORKER_POOL_HPP
+#define IOX_POSH_POPO_LISTENER_WORKER_POOL_HPP
+
+#include "iceoryx_hoofs/cxx/function.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/internal/concurrent/lockfree_queue/index_queue.hpp"
+#include "iceoryx_hoofs/posix_wrapper/unnamed_semaphore.hpp"
+#include "iceoryx_posh/error_handling/error_handling.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+
+#include <atomic>
+#include <thread>
+
+namespace iox
+{
+namespace popo
+{
+namespace internal
+{
+/// @brief Executes the callbacks of a Listener in a pool of worker threads. Every worker has its own queue and steals
+///        from the queues of the other workers when its own one is empty.
+///        An event is in at most one queue at a time. Notifications which arrive while its callback is running are
+///        handled by the same worker right afterwards, therefore the callback of an event never runs concurrently with
+///        itself and is called in the order of the notifications while different events run in parallel.
+/// @tparam Capacity the number of events, event ids must be smaller than Capacity
+template <uint64_t Capacity>
+class ListenerWorkerPool
+{
+  public:
+    using ExecuteCallback_t = cxx::function<void(const uint64_t)>;
+
+    /// @brief starts the worker threads
+    /// @param[in] numberOfWorkerThreads the number of worker threads, limited to
+    ///            MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER
+    /// @param[in] executeCallback is called by the workers with the id of the event whose callback should run
+    ListenerWorkerPool(const uint64_t numberOfWorkerThreads, const ExecuteCallback_t& executeCallback) noexcept;
+
+    /// @brief stops and joins all worker threads. Callbacks which are currently running are finished, events which
+    ///        are still queued are dropped.
+    ~ListenerWorkerPool() noexcept;
+
+    ListenerWorkerPool(const ListenerWorkerPool&) = delete;
+    ListenerWorkerPool(ListenerWorkerPool&&) = delete;
+    ListenerWorkerPool& operator=(const ListenerWorkerPool&) = delete;
+    ListenerWorkerPool& operator=(ListenerWorkerPool&&) = delete;
+
+    /// @brief schedules the callback of an event. If the event is already queued or running, its callback is
+    ///        executed once more by the worker which currently owns the event.
+    /// @note must always be called from the same thread
+    /// @param[in] eventId the id of the event, must be smaller than Capacity
+    void dispatch(const uint64_t eventId) noexcept;
+
+    /// @brief returns the number of worker threads
+    uint64_t numberOfWorkerThreads() const noexcept;
+
+    /// @brief returns true when it is called from one of the worker threads, e.g. from within a callback
+    bool isWorkerThread() const noexcept;
+
+  private:
+    void workerLoop(const uint64_t workerIndex) noexcept;
+    cxx::optional<uint64_t> popEvent(const uint64_t workerIndex) noexcept;
+    void execute(const uint64_t eventId) noexcept;
+
+  private:
+    uint64_t m_numberOfWorkerThreads{0U};
+    ExecuteCallback_t m_executeCallback;
+    std::atomic_bool m_keepRunning{true};
+    cxx::optional<posix::UnnamedSemaphore> m_eventsToExecute;
+
+    /// @brief the number of notifications of an event which are not yet handled, the event is queued or running as
+    ///        long as it is greater than zero
+    std::atomic<uint64_t> m_pendingNotifications[Capacity];
+    concurrent::IndexQueue<Capacity> m_queues[MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER];
+    uint64_t m_nextQueue{0U};
+
+    std::thread m_workerThreads[MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER];
+};
+} // namespace internal
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/listener_worker_pool.inl"
+
+#endif // IOX_POSH_POPO_LISTENER_WORKER_POOL_HPP
@@ -0,0 +1,179 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_LISTENER_WORKER_POOL_INL
+#define IOX_POSH_POPO_LISTENER_WORKER_POOL_INL
+
+#include "iceoryx_posh/internal/popo/listener_worker_pool.hpp"
+
+namespace iox
+{
+namespace popo
+{
+namespace internal
+{
+template <uint64_t Capacity>
+inline ListenerWorkerPool<Capacity>::ListenerWorkerPool(const uint64_t numberOfWorkerThreads,
+                                                        const ExecuteCallback_t& executeCallback) noexcept
+    : m_numberOfWorkerThreads(numberOfWorkerThreads)
+    , m_executeCallback(executeCallback)
+{
+    cxx::Expects(numberOfWorkerThreads > 0U);
+    cxx::Expects(static_cast<bool>(executeCallback));
+
+    if (m_numberOfWorkerThreads > MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER)
+    {
+        LogWarn() << "The Listener supports at most " << MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER
+                  << " worker threads but " << numberOfWorkerThreads << " were requested. Limiting it to "
+                  << MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER << " worker threads.";
+        errorHandler(PoshError::POPO__LISTENER_TOO_MANY_WORKER_THREADS, ErrorLevel::MODERATE);
+        m_numberOfWorkerThreads = MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER;
+    }
+
+    for (auto& pendingNotifications : m_pendingNotifications)
+    {
+        pendingNotifications.store(0U, std::memory_order_relaxed);
+    }
+
+    posix::UnnamedSemaphoreBuilder().initialValue(0U).isInterProcessCapable(false).create(m_eventsToExecute).or_else(
+        [](auto) {
+            errorHandler(PoshError::POPO__LISTENER_WORKER_POOL_FAILED_TO_CREATE_SEMAPHORE, ErrorLevel::FATAL);
+        });
+
+    for (uint64_t i = 0U; i < m_numberOfWorkerThreads; ++i)
+    {
+        m_workerThreads[i] = std::thread(&ListenerWorkerPool<Capacity>::workerLoop, this, i);
+    }
+}
+
+template <uint64_t Capacity>
+inline ListenerWorkerPool<Capacity>::~ListenerWorkerPool() noexcept
+{
+    m_keepRunning.store(false, std::memory_order_relaxed);
+    for (uint64_t i = 0U; i < m_numberOfWorkerThreads; ++i)
+    {
+        if (m_eventsToExecute->post().has_error())
+        {
+            errorHandler(PoshError::POPO__LISTENER_WORKER_POOL_SEMAPHORE_CORRUPTED, ErrorLevel::FATAL);
+        }
+    }
+
+    for (uint64_t i = 0U; i < m_numberOfWorkerThreads; ++i)
+    {
+        m_workerThreads[i].join();
+    }
+}
+
+template <uint64_t Capacity>
+inline void ListenerWorkerPool<Capacity>::dispatch(const uint64_t eventId) noexcept
+{
+    // only the first pending notification queues the event, the following ones are picked up by the worker which
+    // owns the event after its current callback has finished
+    if (m_pendingNotifications[eventId].fetch_add(1U, std::memory_order_acq_rel) != 0U)
+    {
+        return;
+    }
+
+    m_queues[m_nextQueue].push(eventId);
+    m_nextQueue = (m_nextQueue + 1U) % m_numberOfWorkerThreads;
+
+    if (m_eventsToExecute->post().has_error())
+    {
+        errorHandler(PoshError::POPO__LISTENER_WORKER_POOL_SEMAPHORE_CORRUPTED, ErrorLevel::FATAL);
+    }
+}
+
+template <uint64_t Capacity>
+inline uint64_t ListenerWorkerPool<Capacity>::numberOfWorkerThreads() const noexcept
+{
+    return m_numberOfWorkerThreads;
+}
+
+template <uint64_t Capacity>
+inline bool ListenerWorkerPool<Capacity>::isWorkerThread() const noexcept
+{
+    const auto threadId = std::this_thread::get_id();
+    for (uint64_t i = 0U; i < m_numberOfWorkerThreads; ++i)
+    {
+        if (m_workerThreads[i].get_id() == threadId)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <uint64_t Capacity>
+inline void ListenerWorkerPool<Capacity>::workerLoop(const uint64_t workerIndex) noexcept
+{
+    while (true)
+    {
+        if (m_eventsToExecute->wait().has_error())
+        {
+            errorHandler(PoshError::POPO__LISTENER_WORKER_POOL_SEMAPHORE_CORRUPTED, ErrorLevel::FATAL);
+            return;
+        }
+
+        // every post belongs to exactly one queued event, which is pushed before the post. Another worker
+        // can steal it, but then the event of that worker's post is still in a queue.
+        cxx::optional<uint64_t> eventId;
+        while (m_keepRunning.load(std::memory_order_relaxed) && !(eventId = popEvent(workerIndex)).has_value())
+        {
+            std::this_thread::yield();
+        }
+
+        if (!eventId.has_value())
+        {
+            return;
+        }
+
+        execute(*eventId);
+    }
+}
+
+template <uint64_t Capacity>
+inline cxx::optional<uint64_t> ListenerWorkerPool<Capacity>::popEvent(const uint64_t workerIndex) noexcept
+{
+    // start with the own queue and steal from the others when it is empty
+    for (uint64_t i = 0U; i < m_numberOfWorkerThreads; ++i)
+    {
+        auto eventId = m_queues[(workerIndex + i) % m_numberOfWorkerThreads].pop();
+        if (eventId.has_value())
+        {
+            return eventId;
+        }
+    }
+    return cxx::nullopt;
+}
+
+template <uint64_t Capacity>
+inline void ListenerWorkerPool<Capacity>::execute(const uint64_t eventId) noexcept
+{
+    uint64_t notificationsToHandle = m_pendingNotifications[eventId].load(std::memory_order_acquire);
+    do
+    {
+        m_executeCallback(eventId);
+        // when notifications arrived during the callback, the event stays with this worker and the callback is
+        // executed once more
+        notificationsToHandle =
+            m_pendingNotifications[eventId].fetch_sub(notificationsToHandle, std::memory_order_acq_rel)
+            - notificationsToHandle;
+    } while (notificationsToHandle != 0U);
+}
+} // namespace internal
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_LISTENER_WORKER_POOL_INL
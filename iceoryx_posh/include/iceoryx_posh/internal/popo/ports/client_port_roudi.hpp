@@ -66,6 +66,17 @@ class ClientPortRouDi : public BasePort
     cxx::optional<capro::CaproMessage>
     dispatchCaProMessageAndGetPossibleResponse(const capro::CaproMessage& caProMessage) noexcept;
 
+    /// @brief reset the registrations of the sending side of the client, this must be done before the queues of a
+    /// client whose process died are removed since the removal is postponed otherwise
+    /// @attention Contract is that user process is no more sending when this is called
+    void releaseSenderRegistrations() noexcept;
+
+    /// @brief removes the request queue of a server which is destroyed if the client could still deliver to it
+    /// @param[in] queue is the request queue of the server
+    /// @return true if the client does not access the queue anymore, false if the removal is postponed since the
+    /// client process is still registered as sender
+    bool tryReleaseQueue(ServerChunkQueueData_t* const queue) noexcept;
+
     /// @brief cleanup the client and release all the chunks it currently holds
     /// @attention Contract is that user process is no more running when cleanup is called
     void releaseAllChunks() noexcept;
@@ -59,6 +59,17 @@ class PublisherPortRouDi : public BasePort
     cxx::optional<capro::CaproMessage>
     dispatchCaProMessageAndGetPossibleResponse(const capro::CaproMessage& caProMessage) noexcept;
 
+    /// @brief reset the registrations of the sending side of the publisher, this must be done before the queues of a
+    /// publisher whose process died are removed since the removal is postponed otherwise
+    /// Caution: Contract is that user process is no more sending when this is called
+    void releaseSenderRegistrations() noexcept;
+
+    /// @brief removes the queue of a subscriber which is destroyed if the publisher could still deliver to it
+    /// @param[in] queue of the subscriber
+    /// @return true if the publisher does not access the queue anymore, false if the removal is postponed since the
+    /// publishing process is still registered as sender
+    bool tryReleaseQueue(PublisherPortData::ChunkQueueData_t* const queue) noexcept;
+
     /// @brief cleanup the publisher and release all the chunks it currently holds
     /// Caution: Contract is that user process is no more running when cleanup is called
     void releaseAllChunks() noexcept;
@@ -39,6 +39,7 @@ class PublisherPortUser : public BasePort
 {
   public:
     using MemberType_t = PublisherPortData;
+    using ChunkHeaderBatch_t = ChunkSender<PublisherPortData::ChunkSenderData_t>::ChunkHeaderBatch_t;
 
     explicit PublisherPortUser(cxx::not_null<MemberType_t* const> publisherPortDataPtr) noexcept;
 
@@ -71,6 +72,10 @@ class PublisherPortUser : public BasePort
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send
     void sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Send several allocated chunks in one pass to all connected subscriber ports
+    /// @param[in] chunkHeaders, pointers to the ChunkHeaders to send in the order of the vector
+    void sendChunks(const ChunkHeaderBatch_t& chunkHeaders) noexcept;
+
     /// @brief Returns the last sent chunk if there is one
     /// @return pointer to the ChunkHeader of the last sent Chunk if there is one, empty optional if not
     cxx::optional<const mepoo::ChunkHeader*> tryGetPreviousChunk() const noexcept;
@@ -63,6 +63,17 @@ class ServerPortRouDi : public BasePort
     cxx::optional<capro::CaproMessage>
     dispatchCaProMessageAndGetPossibleResponse(const capro::CaproMessage& caProMessage) noexcept;
 
+    /// @brief reset the registrations of the sending side of the server, this must be done before the queues of a
+    /// server whose process died are removed since the removal is postponed otherwise
+    /// Caution: Contract is that user process is no more sending when this is called
+    void releaseSenderRegistrations() noexcept;
+
+    /// @brief removes the response queue of a client which is destroyed if the server could still deliver to it
+    /// @param[in] queue is the response queue of the client
+    /// @return true if the server does not access the queue anymore, false if the removal is postponed since the
+    /// server process is still registered as sender
+    bool tryReleaseQueue(ClientChunkQueueData_t* const queue) noexcept;
+
     /// @brief cleanup the server and release all the chunks it currently holds
     /// Caution: Contract is that user process is no more running when cleanup is called
     void releaseAllChunks() noexcept;
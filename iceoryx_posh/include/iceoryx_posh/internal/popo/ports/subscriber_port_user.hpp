@@ -41,6 +41,7 @@ class SubscriberPortUser : public BasePort
 {
   public:
     using MemberType_t = SubscriberPortData;
+    using ChunkHeaderBatch_t = ChunkReceiver<SubscriberPortData::ChunkReceiverData_t>::ChunkHeaderBatch_t;
 
     explicit SubscriberPortUser(cxx::not_null<MemberType_t* const> subscriberPortDataPtr) noexcept;
 
@@ -68,6 +69,14 @@ class SubscriberPortUser : public BasePort
     /// or if there are no new chunks in the underlying queue
     cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGetChunk() noexcept;
 
+    /// @brief Tries to get up to maxNumberOfChunks chunks from the queue in one pass. The ChunkHeaders are appended to
+    /// chunkHeaders in the order of the queue (FiFo queue)
+    /// @param[out] chunkHeaders the ChunkHeaders of the new chunks are appended to this vector
+    /// @param[in] maxNumberOfChunks the maximum number of chunks to get
+    /// @return ChunkReceiveResult on error or if there are no new chunks in the underlying queue
+    cxx::expected<ChunkReceiveResult> tryGetChunks(ChunkHeaderBatch_t& chunkHeaders,
+                                                   const uint64_t maxNumberOfChunks) noexcept;
+
     /// @brief Release a chunk that was obtained with tryGetChunk
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void releaseChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -19,6 +19,7 @@
 #define IOX_POSH_POPO_TYPED_PUBLISHER_IMPL_HPP
 
 #include "iceoryx_hoofs/cxx/type_traits.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_posh/internal/popo/base_publisher.hpp"
 #include "iceoryx_posh/internal/popo/publisher_interface.hpp"
 #include "iceoryx_posh/internal/popo/typed_port_api_trait.hpp"
@@ -37,6 +38,8 @@ class PublisherImpl : public BasePublisherType, private PublisherInterface<T, H>
     using HeaderTypeAssert = typename TypedPortApiTrait<H>::Assert;
 
   public:
+    using SampleBatch_t = cxx::vector<Sample<T, H>, MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY>;
+
     explicit PublisherImpl(const capro::ServiceDescription& service,
                            const PublisherOptions& publisherOptions = PublisherOptions());
     PublisherImpl(const PublisherImpl& other) = delete;
@@ -61,6 +64,13 @@ class PublisherImpl : public BasePublisherType, private PublisherInterface<T, H>
     ///
     void publish(Sample<T, H>&& sample) noexcept override;
 
+    ///
+    /// @brief publishBatch Publishes the given samples in one pass and then releases their loans. Every subscriber
+    ///        receives the samples back-to-back and is notified once for the whole batch.
+    /// @param samples The samples to publish in the order in which they shall be received.
+    ///
+    void publishBatch(SampleBatch_t&& samples) noexcept;
+
     ///
     /// @brief publishCopyOf Copy the provided value into a loaned shared memory chunk and publish it.
     /// @param val Value to copy.
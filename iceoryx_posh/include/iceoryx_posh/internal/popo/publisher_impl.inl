@@ -91,6 +91,19 @@ inline void PublisherImpl<T, H, BasePublisherType>::publish(Sample<T, H>&& sampl
     port().sendChunk(chunkHeader);
 }
 
+template <typename T, typename H, typename BasePublisherType>
+inline void PublisherImpl<T, H, BasePublisherType>::publishBatch(SampleBatch_t&& samples) noexcept
+{
+    typename BasePublisherType::PortType::ChunkHeaderBatch_t chunkHeaders;
+    for (auto& sample : samples)
+    {
+        auto userPayload = sample.release(); // release the Samples ownership of the chunk before publishing
+        chunkHeaders.emplace_back(mepoo::ChunkHeader::fromUserPayload(userPayload));
+    }
+    samples.clear();
+    port().sendChunks(chunkHeaders);
+}
+
 template <typename T, typename H, typename BasePublisherType>
 inline Sample<T, H>
 PublisherImpl<T, H, BasePublisherType>::convertChunkHeaderToSample(mepoo::ChunkHeader* const header) noexcept
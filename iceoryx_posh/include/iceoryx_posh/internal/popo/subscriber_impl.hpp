@@ -52,10 +52,24 @@ class SubscriberImpl : public BaseSubscriberType
     ///
     cxx::expected<Sample<const T, const H>, ChunkReceiveResult> take() noexcept;
 
+    ///
+    /// @brief Take up to maxCount samples from the top of the receive queue in one pass and hand them over to the
+    /// callback in the order of the queue.
+    /// @param[in] maxCount the maximum number of samples to take
+    /// @param[in] callback callable of type void(Sample<const T, const H>&&) which is called for every taken sample
+    /// @return Either the number of taken samples or a ChunkReceiveResult.
+    /// @details Like with take, the sample takes care of the cleanup. The callback can move the sample out to keep it.
+    ///
+    template <typename Callable>
+    cxx::expected<uint64_t, ChunkReceiveResult> takeMany(const uint64_t maxCount, const Callable& callback) noexcept;
+
     using PortType = typename BaseSubscriberType::PortType;
 
   protected:
     using BaseSubscriberType::port;
+
+  private:
+    Sample<const T, const H> convertChunkHeaderToSample(const mepoo::ChunkHeader* const chunkHeader) noexcept;
 };
 
 } // namespace popo
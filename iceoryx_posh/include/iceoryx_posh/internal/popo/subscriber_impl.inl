@@ -40,12 +40,38 @@ SubscriberImpl<T, H, BaseSubscriberType>::take() noexcept
     {
         return cxx::error<ChunkReceiveResult>(result.get_error());
     }
-    auto userPayloadPtr = static_cast<const T*>(result.value()->userPayload());
+    return cxx::success<Sample<const T, const H>>(convertChunkHeaderToSample(result.value()));
+}
+
+template <typename T, typename H, typename BaseSubscriberType>
+template <typename Callable>
+inline cxx::expected<uint64_t, ChunkReceiveResult>
+SubscriberImpl<T, H, BaseSubscriberType>::takeMany(const uint64_t maxCount, const Callable& callback) noexcept
+{
+    typename PortType::ChunkHeaderBatch_t chunkHeaders;
+    auto result = BaseSubscriberType::takeChunks(chunkHeaders, maxCount);
+    if (result.has_error())
+    {
+        return cxx::error<ChunkReceiveResult>(result.get_error());
+    }
+    for (auto chunkHeader : chunkHeaders)
+    {
+        callback(convertChunkHeaderToSample(chunkHeader));
+    }
+    return cxx::success<uint64_t>(chunkHeaders.size());
+}
+
+template <typename T, typename H, typename BaseSubscriberType>
+inline Sample<const T, const H>
+SubscriberImpl<T, H, BaseSubscriberType>::convertChunkHeaderToSample(
+    const mepoo::ChunkHeader* const chunkHeader) noexcept
+{
+    auto userPayloadPtr = static_cast<const T*>(chunkHeader->userPayload());
     auto samplePtr = cxx::unique_ptr<const T>(userPayloadPtr, [this](auto* userPayload) {
         auto chunkHeader = iox::mepoo::ChunkHeader::fromUserPayload(userPayload);
         this->port().releaseChunk(chunkHeader);
     });
-    return cxx::success<Sample<const T, const H>>(std::move(samplePtr));
+    return Sample<const T, const H>(std::move(samplePtr));
 }
 
 template <typename T, typename H, typename BaseSubscriberType>
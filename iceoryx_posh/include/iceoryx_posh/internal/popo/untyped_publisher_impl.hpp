@@ -18,6 +18,7 @@
 #ifndef IOX_POSH_POPO_UNTYPED_PUBLISHER_IMPL_HPP
 #define IOX_POSH_POPO_UNTYPED_PUBLISHER_IMPL_HPP
 
+#include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_posh/internal/popo/base_publisher.hpp"
 #include "iceoryx_posh/popo/sample.hpp"
 
@@ -31,6 +32,8 @@ template <typename BasePublisherType = BasePublisher<>>
 class UntypedPublisherImpl : public BasePublisherType
 {
   public:
+    using UserPayloadBatch_t = cxx::vector<void*, MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY>;
+
     explicit UntypedPublisherImpl(const capro::ServiceDescription& service,
                                   const PublisherOptions& publisherOptions = PublisherOptions());
     UntypedPublisherImpl(const UntypedPublisherImpl& other) = delete;
@@ -60,6 +63,14 @@ class UntypedPublisherImpl : public BasePublisherType
     ///
     void publish(void* const userPayload) noexcept;
 
+    ///
+    /// @brief Publish several memory chunks in one pass. Every subscriber receives the chunks back-to-back and is
+    ///        notified once for the whole batch.
+    /// @param userPayloads Pointers to the user-payloads of the allocated shared memory chunks in the order in which
+    ///        they shall be received.
+    ///
+    void publishBatch(const UserPayloadBatch_t& userPayloads) noexcept;
+
     ///
     /// @brief Releases the ownership of the chunk provided by the user-payload pointer.
     /// @param userPayload pointer to the user-payload of the chunk to be released
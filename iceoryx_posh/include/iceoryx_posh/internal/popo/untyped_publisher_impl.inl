@@ -38,6 +38,17 @@ inline void UntypedPublisherImpl<BasePublisherType>::publish(void* const userPay
     port().sendChunk(chunkHeader);
 }
 
+template <typename BasePublisherType>
+inline void UntypedPublisherImpl<BasePublisherType>::publishBatch(const UserPayloadBatch_t& userPayloads) noexcept
+{
+    typename BasePublisherType::PortType::ChunkHeaderBatch_t chunkHeaders;
+    for (auto userPayload : userPayloads)
+    {
+        chunkHeaders.emplace_back(mepoo::ChunkHeader::fromUserPayload(userPayload));
+    }
+    port().sendChunks(chunkHeaders);
+}
+
 template <typename BasePublisherType>
 inline cxx::expected<void*, AllocationError>
 UntypedPublisherImpl<BasePublisherType>::loan(const uint32_t userPayloadSize,
@@ -57,6 +57,19 @@ class UntypedSubscriberImpl : public BaseSubscriberType
     ///
     cxx::expected<const void*, ChunkReceiveResult> take() noexcept;
 
+    ///
+    /// @brief Take up to maxCount chunks from the top of the receive queue in one pass and hand them over to the
+    /// callback in the order of the queue.
+    /// @param[in] maxCount the maximum number of chunks to take
+    /// @param[in] callback callable of type void(const void*) which is called with the user-payload pointer of every
+    /// taken chunk
+    /// @return Either the number of taken chunks or a ChunkReceiveResult.
+    /// @details Like with take, no automatic cleanup of the associated chunks is performed
+    ///          and must be manually done by calling `release`
+    ///
+    template <typename Callable>
+    cxx::expected<uint64_t, ChunkReceiveResult> takeMany(const uint64_t maxCount, const Callable& callback) noexcept;
+
     ///
     /// @brief Releases the ownership of the chunk provided by the user-payload pointer.
     /// @param userPayload pointer to the user-payload of the chunk to be released
@@ -42,6 +42,24 @@ inline cxx::expected<const void*, ChunkReceiveResult> UntypedSubscriberImpl<Base
     return cxx::success<const void*>(result.value()->userPayload());
 }
 
+template <typename BaseSubscriberType>
+template <typename Callable>
+inline cxx::expected<uint64_t, ChunkReceiveResult>
+UntypedSubscriberImpl<BaseSubscriberType>::takeMany(const uint64_t maxCount, const Callable& callback) noexcept
+{
+    typename BaseSubscriber::PortType::ChunkHeaderBatch_t chunkHeaders;
+    auto result = BaseSubscriber::takeChunks(chunkHeaders, maxCount);
+    if (result.has_error())
+    {
+        return cxx::error<ChunkReceiveResult>(result.get_error());
+    }
+    for (auto chunkHeader : chunkHeaders)
+    {
+        callback(static_cast<const void*>(chunkHeader->userPayload()));
+    }
+    return cxx::success<uint64_t>(chunkHeaders.size());
+}
+
 template <typename BaseSubscriberType>
 inline void UntypedSubscriberImpl<BaseSubscriberType>::release(const void* const userPayload) noexcept
 {
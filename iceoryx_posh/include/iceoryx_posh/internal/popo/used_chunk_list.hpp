@@ -17,6 +17,7 @@
 #ifndef IOX_POSH_POPO_USED_CHUNK_LIST_HPP
 #define IOX_POSH_POPO_USED_CHUNK_LIST_HPP
 
+#include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
@@ -53,6 +54,18 @@ class UsedChunkList
     /// @note only from runtime context
     bool insert(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Inserts multiple SharedChunks into the list and synchronizes with RouDi only once for all of them
+    /// @param[in] chunks to store in the list
+    /// @return the number of stored chunks; if the list runs full, only the chunks at the front of chunks are stored
+    /// @note only from runtime context
+    template <uint64_t ChunksCapacity>
+    uint64_t insert(const cxx::vector<mepoo::SharedChunk, ChunksCapacity>& chunks) noexcept;
+
+    /// @brief Returns the number of chunks which can still be inserted into the list
+    /// @return the number of free entries
+    /// @note only from runtime context
+    uint32_t freeSpace() const noexcept;
+
     /// @brief Removes a chunk from the list
     /// @param[in] chunkHeader to look for a corresponding SharedChunk
     /// @param[out] chunk which is removed
@@ -67,6 +80,7 @@ class UsedChunkList
 
   private:
     void init() noexcept;
+    void insertUnsynchronized(const mepoo::SharedChunk& chunk) noexcept;
 
   private:
     static constexpr uint32_t INVALID_INDEX{Capacity};
@@ -78,6 +92,7 @@ class UsedChunkList
     std::atomic_flag m_synchronizer = ATOMIC_FLAG_INIT;
     uint32_t m_usedListHead{INVALID_INDEX};
     uint32_t m_freeListHead{0u};
+    uint32_t m_numberOfFreeEntries{Capacity};
     uint32_t m_listIndices[Capacity];
     DataElement_t m_listData[Capacity];
 };
@@ -41,17 +41,7 @@ bool UsedChunkList<Capacity>::insert(mepoo::SharedChunk chunk) noexcept
     auto hasFreeSpace = m_freeListHead != INVALID_INDEX;
     if (hasFreeSpace)
     {
-        // get next free entry after freelistHead
-        auto nextFree = m_listIndices[m_freeListHead];
-
-        // freeListHead is getting new usedListHead, next of this entry is updated to next in usedList
-        m_listIndices[m_freeListHead] = m_usedListHead;
-        m_usedListHead = m_freeListHead;
-
-        m_listData[m_usedListHead] = DataElement_t(chunk);
-
-        // set freeListHead to the next free entry
-        m_freeListHead = nextFree;
+        insertUnsynchronized(chunk);
 
         /// @todo can we do this cheaper with a global fence in cleanup?
         m_synchronizer.clear(std::memory_order_release);
@@ -63,6 +53,51 @@ bool UsedChunkList<Capacity>::insert(mepoo::SharedChunk chunk) noexcept
     }
 }
 
+template <uint32_t Capacity>
+template <uint64_t ChunksCapacity>
+uint64_t UsedChunkList<Capacity>::insert(const cxx::vector<mepoo::SharedChunk, ChunksCapacity>& chunks) noexcept
+{
+    uint64_t numberOfInsertedChunks{0U};
+    for (const auto& chunk : chunks)
+    {
+        if (m_freeListHead == INVALID_INDEX)
+        {
+            break;
+        }
+        insertUnsynchronized(chunk);
+        ++numberOfInsertedChunks;
+    }
+
+    if (numberOfInsertedChunks > 0U)
+    {
+        m_synchronizer.clear(std::memory_order_release);
+    }
+    return numberOfInsertedChunks;
+}
+
+template <uint32_t Capacity>
+uint32_t UsedChunkList<Capacity>::freeSpace() const noexcept
+{
+    return m_numberOfFreeEntries;
+}
+
+template <uint32_t Capacity>
+void UsedChunkList<Capacity>::insertUnsynchronized(const mepoo::SharedChunk& chunk) noexcept
+{
+    // get next free entry after freelistHead
+    auto nextFree = m_listIndices[m_freeListHead];
+
+    // freeListHead is getting new usedListHead, next of this entry is updated to next in usedList
+    m_listIndices[m_freeListHead] = m_usedListHead;
+    m_usedListHead = m_freeListHead;
+
+    m_listData[m_usedListHead] = DataElement_t(chunk);
+
+    // set freeListHead to the next free entry
+    m_freeListHead = nextFree;
+    --m_numberOfFreeEntries;
+}
+
 template <uint32_t Capacity>
 bool UsedChunkList<Capacity>::remove(const mepoo::ChunkHeader* chunkHeader, mepoo::SharedChunk& chunk) noexcept
 {
@@ -91,6 +126,7 @@ bool UsedChunkList<Capacity>::remove(const mepoo::ChunkHeader* chunkHeader, mepo
                 // insert index to free list
                 m_listIndices[current] = m_freeListHead;
                 m_freeListHead = current;
+                ++m_numberOfFreeEntries;
 
                 /// @todo can we do this cheaper with a global fence in cleanup?
                 m_synchronizer.clear(std::memory_order_release);
@@ -140,6 +176,7 @@ void UsedChunkList<Capacity>::init() noexcept
 
     m_usedListHead = INVALID_INDEX;
     m_freeListHead = 0U;
+    m_numberOfFreeEntries = Capacity;
 
     // clear data
     for (auto& data : m_listData)
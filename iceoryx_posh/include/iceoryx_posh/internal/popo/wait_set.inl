@@ -276,6 +276,7 @@ inline typename WaitSet<Capacity>::NotificationInfoVector
 WaitSet<Capacity>::createVectorWithTriggeredTriggers() noexcept
 {
     NotificationInfoVector triggers;
+    bool hasSatisfiedState = false;
     if (!m_activeNotifications.empty())
     {
         for (uint64_t i = m_activeNotifications.size() - 1U;; --i)
@@ -288,6 +289,7 @@ WaitSet<Capacity>::createVectorWithTriggeredTriggers() noexcept
             {
                 cxx::Expects(triggers.push_back(&m_triggerArray[index]->getNotificationInfo()));
                 doRemoveNotificationId = (trigger->getTriggerType() == TriggerType::EVENT_BASED);
+                hasSatisfiedState = hasSatisfiedState || !doRemoveNotificationId;
             }
 
             if (doRemoveNotificationId)
@@ -302,6 +304,12 @@ WaitSet<Capacity>::createVectorWithTriggeredTriggers() noexcept
         }
     }
 
+    // the wait has drained the file descriptor but a satisfied state is returned again with the next wait
+    if (hasSatisfiedState)
+    {
+        m_conditionListener.signalFileDescriptor();
+    }
+
     return triggers;
 }
 
@@ -339,6 +347,29 @@ WaitSet<Capacity>::waitAndReturnTriggeredTriggers(const WaitFunction& wait) noex
     return createVectorWithTriggeredTriggers();
 }
 
+template <uint64_t Capacity>
+inline void WaitSet<Capacity>::setSpinBudget(const units::Duration spinBudget) noexcept
+{
+    m_conditionListener.setSpinBudget(spinBudget);
+}
+
+template <uint64_t Capacity>
+inline units::Duration WaitSet<Capacity>::getSpinBudget() const noexcept
+{
+    return m_conditionListener.getSpinBudget();
+}
+
+template <uint64_t Capacity>
+inline cxx::expected<int32_t, WaitSetError> WaitSet<Capacity>::getFileDescriptor() noexcept
+{
+    auto fileDescriptor = m_conditionListener.getFileDescriptor();
+    if (fileDescriptor.has_error())
+    {
+        return cxx::error<WaitSetError>(WaitSetError::FILE_DESCRIPTOR_UNAVAILABLE);
+    }
+    return cxx::success<int32_t>(fileDescriptor.value());
+}
+
 template <uint64_t Capacity>
 inline uint64_t WaitSet<Capacity>::size() const noexcept
 {
@@ -18,6 +18,7 @@
 #define IOX_POSH_ROUDI_INTROSPECTION_MEMPOOL_INTROSPECTION_HPP
 
 #include "iceoryx_hoofs/cxx/function.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/internal/concurrent/periodic_task.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
@@ -51,6 +52,11 @@ class MemPoolIntrospection
 
     ~MemPoolIntrospection() noexcept;
 
+    /// @brief This function registers and offers the publisher port for the allocation size histograms of the
+    ///        mempools. They are large, therefore they are only collected and sent while the port has subscribers.
+    /// @param[in] allocationSizePublisherPort is the publisher port for transmission of the allocation size histograms
+    void registerAllocationSizePublisherPort(PublisherPort&& allocationSizePublisherPort) noexcept;
+
     // delete copy constructor and assignment operator
     MemPoolIntrospection(MemPoolIntrospection const&) = delete;
     MemPoolIntrospection& operator=(MemPoolIntrospection const&) = delete;
@@ -75,6 +81,7 @@ class MemPoolIntrospection
     MemoryManager* m_rouDiInternalMemoryManager{nullptr}; // mempool handler needs to outlive this class (!)
     SegmentManager* m_segmentManager{nullptr};
     PublisherPort m_publisherPort{nullptr};
+    cxx::optional<PublisherPort> m_allocationSizePublisherPort;
     void send() noexcept;
 
   private:
@@ -86,6 +93,10 @@ class MemPoolIntrospection
     /// @brief copy data fro internal struct into interface struct
     void copyMemPoolInfo(const MemoryManager& memoryManager, MemPoolInfoContainer& dest) noexcept;
 
+    void sendAllocationSizes() noexcept;
+    static void copyAllocationSizes(const MemoryManager& memoryManager,
+                                    AllocationSizeHistogramContainer& dest) noexcept;
+
   private:
     units::Duration m_sendInterval{units::Duration::fromSeconds(1U)};
     concurrent::PeriodicTask<cxx::function<void()>> m_publishingTask{
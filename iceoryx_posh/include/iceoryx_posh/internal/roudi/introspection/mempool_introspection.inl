@@ -39,6 +39,22 @@ inline MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::~MemP
 {
     stop();
     m_publisherPort.stopOffer();
+    if (m_allocationSizePublisherPort.has_value())
+    {
+        m_allocationSizePublisherPort->stopOffer();
+    }
+}
+
+template <typename MemoryManager, typename SegmentManager, typename PublisherPort>
+inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::registerAllocationSizePublisherPort(
+    PublisherPort&& allocationSizePublisherPort) noexcept
+{
+    // we do not want to call this twice
+    if (!m_allocationSizePublisherPort.has_value())
+    {
+        m_allocationSizePublisherPort.emplace(std::move(allocationSizePublisherPort));
+        m_allocationSizePublisherPort->offer();
+    }
 }
 
 template <typename MemoryManager, typename SegmentManager, typename PublisherPort>
@@ -141,6 +157,54 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
 
         m_publisherPort.sendChunk(maybeChunkHeader.value());
     }
+
+    if (m_allocationSizePublisherPort.has_value() && m_allocationSizePublisherPort->hasSubscribers())
+    {
+        sendAllocationSizes();
+    }
+}
+
+template <typename MemoryManager, typename SegmentManager, typename PublisherPort>
+inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::sendAllocationSizes() noexcept
+{
+    auto maybeChunkHeader =
+        m_allocationSizePublisherPort->tryAllocateChunk(sizeof(MemPoolAllocationSizeIntrospectionInfoContainer),
+                                                       alignof(MemPoolAllocationSizeIntrospectionInfoContainer),
+                                                       CHUNK_NO_USER_HEADER_SIZE,
+                                                       CHUNK_NO_USER_HEADER_ALIGNMENT);
+    if (maybeChunkHeader.has_error())
+    {
+        LogWarn() << "Cannot allocate chunk for mempool allocation size introspection!";
+        errorHandler(PoshError::MEPOO__CANNOT_ALLOCATE_CHUNK, ErrorLevel::MODERATE);
+        return;
+    }
+
+    auto sample =
+        static_cast<MemPoolAllocationSizeIntrospectionInfoContainer*>(maybeChunkHeader.value()->userPayload());
+    new (sample) MemPoolAllocationSizeIntrospectionInfoContainer;
+
+    // the ids are the ones of the MemPoolIntrospectionInfo, RouDi's shm segment is always the first one
+    uint32_t id = 0U;
+    sample->emplace_back();
+    sample->back().m_id = id;
+    copyAllocationSizes(*m_rouDiInternalMemoryManager, sample->back().m_allocationSizeHistograms);
+    ++id;
+
+    for (auto& segment : m_segmentManager->m_segmentContainer)
+    {
+        if (!sample->emplace_back())
+        {
+            LogWarn() << "Mempool Allocation Size Introspection Container full, Data not fully updated! " << id
+                      << " of " << (m_segmentManager->m_segmentContainer.size() + 1U) << " memory segments sent.";
+            errorHandler(PoshError::MEPOO__INTROSPECTION_CONTAINER_FULL, ErrorLevel::MODERATE);
+            break;
+        }
+        sample->back().m_id = id;
+        copyAllocationSizes(segment.getMemoryManager(), sample->back().m_allocationSizeHistograms);
+        ++id;
+    }
+
+    m_allocationSizePublisherPort->sendChunk(maybeChunkHeader.value());
 }
 
 // copy data fro internal struct into interface struct
@@ -160,6 +224,20 @@ MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::copyMemPoolI
         dst.m_numChunks = src.m_numChunks;
         dst.m_chunkSize = src.m_chunkSize;
         dst.m_chunkPayloadSize = src.m_chunkSize - static_cast<uint32_t>(sizeof(mepoo::ChunkHeader));
+        dst.m_numberOfFallbacks = src.m_numberOfFallbacks;
+        dst.m_numberOfFailedAllocations = src.m_numberOfFailedAllocations;
+    }
+}
+
+template <typename MemoryManager, typename SegmentManager, typename PublisherPort>
+inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::copyAllocationSizes(
+    const MemoryManager& memoryManager, AllocationSizeHistogramContainer& dest) noexcept
+{
+    auto numOfMemPools = memoryManager.getNumberOfMemPools();
+    dest.clear();
+    for (uint32_t i = 0U; i < numOfMemPools; ++i)
+    {
+        dest.emplace_back(memoryManager.getMemPoolInfo(i).m_allocationSizeHistogram);
     }
 }
 
@@ -185,6 +185,19 @@ class PortManager
 
     void sendToAllMatchingInterfacePorts(const capro::CaproMessage& message) noexcept;
 
+    /// @brief removes the queue of a subscriber which is destroyed from all publishers, a publisher whose process
+    /// is still registered as sender could access it and the destruction of the subscriber must be postponed
+    /// @return true if no publisher accesses the queue anymore
+    bool tryReleaseQueueAtAllPublisherPorts(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept;
+
+    /// @brief removes the response queue of a client which is destroyed from all servers
+    /// @return true if no server accesses the queue anymore
+    bool tryReleaseQueueAtAllServerPorts(popo::ClientPortData* const clientPortData) noexcept;
+
+    /// @brief removes the request queue of a server which is destroyed from all clients
+    /// @return true if no client accesses the queue anymore
+    bool tryReleaseQueueAtAllClientPorts(popo::ServerPortData* const serverPortData) noexcept;
+
     void addPublisherToServiceRegistry(const capro::ServiceDescription& service) noexcept;
     void removePublisherFromServiceRegistry(const capro::ServiceDescription& service) noexcept;
 
@@ -41,6 +41,14 @@ class SharedMemoryUser
                      const uint64_t segmentId,
                      const rp::BaseRelativePointer::offset_t segmentManagerAddressOffset) noexcept;
 
+    SharedMemoryUser(const SharedMemoryUser&) = delete;
+    SharedMemoryUser(SharedMemoryUser&& rhs) noexcept;
+    SharedMemoryUser& operator=(const SharedMemoryUser&) = delete;
+    SharedMemoryUser& operator=(SharedMemoryUser&&) = delete;
+
+    /// @brief stops the mapping of payload data segments which were added at runtime and unmaps them
+    ~SharedMemoryUser() noexcept;
+
   private:
     void openDataSegments(const uint64_t segmentId,
                           const rp::BaseRelativePointer::offset_t segmentManagerAddressOffset) noexcept;
@@ -48,8 +56,8 @@ class SharedMemoryUser
   private:
     cxx::optional<posix::SharedMemoryObject> m_shmObject;
     cxx::vector<posix::SharedMemoryObject, MAX_SHM_SEGMENTS> m_dataShmObjects;
-    static constexpr cxx::perms SHM_SEGMENT_PERMISSIONS =
-        cxx::perms::owner_read | cxx::perms::owner_write | cxx::perms::group_read | cxx::perms::group_write;
+    /// @brief true for the SharedMemoryUser which maps the payload data segments that are added at runtime
+    bool m_mapsDataSegmentExtensions{false};
 };
 
 } // namespace runtime
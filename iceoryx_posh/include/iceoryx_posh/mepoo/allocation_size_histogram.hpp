@@ -0,0 +1,62 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_MEPOO_ALLOCATION_SIZE_HISTOGRAM_HPP
+#define IOX_POSH_MEPOO_ALLOCATION_SIZE_HISTOGRAM_HPP
+
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief Counts the required chunk sizes of the allocations for which a mempool was the best fit. The buckets are
+/// logarithmic relative to the chunk size of the mempool with BUCKETS_PER_OCTAVE buckets per power of two. Bucket i
+/// counts the required chunk sizes in (upperBound(i + 1), upperBound(i)] with upperBound(i) = chunkSize * 2^(-i/4),
+/// the last bucket counts all smaller ones. The allocations of bucket i waste at least chunkSize - upperBound(i) bytes.
+struct AllocationSizeHistogram
+{
+    static constexpr uint32_t NUMBER_OF_BUCKETS{16U};
+    static constexpr uint32_t BUCKETS_PER_OCTAVE{4U};
+
+    /// @brief returns the largest required chunk size which is counted in a bucket
+    /// @param[in] chunkSize the chunk size of the mempool
+    /// @param[in] bucket the index of the bucket, less than NUMBER_OF_BUCKETS
+    /// @return the upper bound of the bucket, it is rounded down to whole bytes
+    static uint32_t upperBound(const uint32_t chunkSize, const uint32_t bucket) noexcept;
+
+    /// @brief returns the bucket which counts a required chunk size
+    /// @param[in] chunkSize the chunk size of the mempool
+    /// @param[in] requiredChunkSize the required chunk size of the allocation, at most chunkSize
+    /// @return the index of the bucket
+    static uint32_t bucket(const uint32_t chunkSize, const uint32_t requiredChunkSize) noexcept;
+
+    /// @brief returns the number of counted allocations
+    uint64_t numberOfAllocations() const noexcept;
+
+    /// @brief estimates how much of the chunks the counted allocations use with the upper bounds of the buckets
+    /// @param[in] chunkSize the chunk size of the mempool
+    /// @return the percentage of the chunk size which the allocations required at most on average, 0 without any
+    /// allocation
+    uint32_t maxAverageUsageInPercent(const uint32_t chunkSize) const noexcept;
+
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    uint64_t m_counts[NUMBER_OF_BUCKETS]{};
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_ALLOCATION_SIZE_HISTOGRAM_HPP
@@ -16,7 +16,11 @@
 #ifndef IOX_POSH_MEPOO_MEPOO_CONFIG_HPP
 #define IOX_POSH_MEPOO_MEPOO_CONFIG_HPP
 
+#include "iceoryx_hoofs/cxx/string.hpp"
 #include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/numa_policy.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/prefault_strategy.hpp"
+#include "iceoryx_platform/platform_settings.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 
 #include <cstdint>
@@ -29,6 +33,17 @@ class PortManager;
 }
 namespace mepoo
 {
+/// @brief the behavior of the MemoryManager when the smallest fitting mempool of a chunk is exhausted
+enum class MemPoolFallbackPolicy : uint8_t
+{
+    /// @brief only the mempools with the same chunk size are used, e.g. the ones which were added at runtime
+    STRICT,
+    /// @brief the chunk is taken from the mempools with the next larger chunk size
+    NEXT_LARGER,
+    /// @brief the chunk is taken from the smallest of all larger mempools which has free chunks
+    ANY_LARGER
+};
+
 struct MePooConfig
 {
   public:
@@ -45,7 +60,33 @@ struct MePooConfig
     };
 
     using MePooConfigContainerType = cxx::vector<Entry, MAX_NUMBER_OF_MEMPOOLS>;
+    using HugePageMount_t = cxx::string<platform::IOX_MAX_PATH_LENGTH>;
+
+    /// @brief the huge page sizes which are supported by x86-64 and aarch64 with 4 KiB pages
+    static constexpr uint64_t HUGE_PAGE_SIZE_2M{2U * 1024U * 1024U};
+    static constexpr uint64_t HUGE_PAGE_SIZE_1G{1024U * 1024U * 1024U};
+
+    /// @brief the default mount point of the hugetlbfs, e.g. systemd mounts the hugetlbfs of the default huge page
+    /// size there
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    static constexpr const char DEFAULT_HUGE_PAGE_MOUNT[] = "/dev/hugepages";
+
     MePooConfigContainerType m_mempoolConfig;
+    MemPoolFallbackPolicy m_fallbackPolicy{MemPoolFallbackPolicy::STRICT};
+    /// @brief the size of the huge pages which back the chunk memory, 0 for regular pages
+    uint64_t m_hugePageSize{0U};
+    /// @brief the mount point of a hugetlbfs with pages of m_hugePageSize
+    HugePageMount_t m_hugePageMount{DEFAULT_HUGE_PAGE_MOUNT};
+    /// @brief the NUMA nodes on which the chunk memory is placed, by default it is placed by first touch
+    posix::NumaPolicy m_numaPolicy;
+    /// @brief how RouDi faults in the chunk memory when the segment is created
+    posix::PrefaultStrategy m_prefaultStrategy{posix::PrefaultStrategy::ZERO};
+    /// @brief if true RouDi locks the chunk memory and the management memory in RAM, applications which are started
+    /// with IOX_LOCK_IN_MEMORY=on lock their mappings of the segment as well
+    bool m_lockInMemory{false};
+    /// @brief the number of chunks which can be added at runtime by extending the segment with additional mempools,
+    /// the management memory of these chunks is reserved when the segment is created
+    uint32_t m_maxNumberOfExtensionChunks{0U};
 
     /// @brief Default constructor to set the configuration for memory pools
     MePooConfig() noexcept = default;
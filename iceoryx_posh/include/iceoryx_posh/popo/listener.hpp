@@ -23,6 +23,7 @@
 #include "iceoryx_hoofs/internal/concurrent/loffli.hpp"
 #include "iceoryx_hoofs/internal/concurrent/smart_lock.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/listener_worker_pool.hpp"
 #include "iceoryx_posh/popo/enum_trigger_type.hpp"
 #include "iceoryx_posh/popo/notification_attorney.hpp"
 #include "iceoryx_posh/popo/notification_callback.hpp"
@@ -79,6 +80,19 @@ enum class ListenerError
     EMPTY_INVALIDATION_CALLBACK
 };
 
+/// @brief This struct is used to configure the Listener
+struct ListenerOptions
+{
+    /// @brief The number of threads which execute the callbacks. With zero the callbacks are executed by the thread
+    ///        which waits for the events. With worker threads different events are handled in parallel, one slow
+    ///        callback does not delay the others. The callback of one event never runs concurrently with itself and
+    ///        is called in the order of its notifications.
+    ///        When a callback detaches an event whose callback is currently running on another worker, detachEvent
+    ///        does not wait for it. The event is detached by that worker as soon as its callback has returned.
+    /// @note at most MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER worker threads are supported
+    uint64_t numberOfWorkerThreads{0U};
+};
+
 /// @brief The Listener is a class which reacts to registered events by
 ///        executing a corresponding callback concurrently. This is achieved via
 ///        an encapsulated thread inside this class.
@@ -105,6 +119,7 @@ class ListenerImpl
 {
   public:
     ListenerImpl() noexcept;
+    explicit ListenerImpl(const ListenerOptions& options) noexcept;
     ListenerImpl(const ListenerImpl&) = delete;
     ListenerImpl(ListenerImpl&&) = delete;
     ~ListenerImpl() noexcept;
@@ -161,6 +176,15 @@ class ListenerImpl
     template <typename T>
     void detachEvent(T& eventOrigin) noexcept;
 
+    /// @brief Sets how long the background thread polls for events before it blocks. Useful on isolated cores
+    ///        where the wake up latency of a blocking wait is too high.
+    /// @note This method can be called from any thread concurrently, it takes effect with the next wait
+    /// @param[in] spinBudget zero (default) blocks right away, units::Duration::max() polls and never blocks
+    void setSpinBudget(const units::Duration spinBudget) noexcept;
+
+    /// @brief Returns how long the background thread polls for events before it blocks
+    units::Duration getSpinBudget() const noexcept;
+
     /// @brief Returns the capacity of the Listener
     /// @return capacity of the Listener
     static constexpr uint64_t capacity() noexcept;
@@ -169,8 +193,13 @@ class ListenerImpl
     /// @return size of the Listener
     uint64_t size() const noexcept;
 
+    /// @brief Returns the number of threads which execute the callbacks, zero when the callbacks are executed by the
+    ///        thread which waits for the events
+    uint64_t numberOfWorkerThreads() const noexcept;
+
   protected:
-    ListenerImpl(ConditionVariableData& conditionVariableData) noexcept;
+    ListenerImpl(ConditionVariableData& conditionVariableData,
+                 const ListenerOptions& options = ListenerOptions()) noexcept;
 
   private:
     class Event_t;
@@ -185,6 +214,7 @@ class ListenerImpl
                                                     const cxx::function<void(uint64_t)> invalidationCallback) noexcept;
 
     void removeTrigger(const uint64_t index) noexcept;
+    void executeCallbackOnWorker(const uint64_t index) noexcept;
 
   private:
     enum class NoEnumUsed : EventEnumIdentifier
@@ -210,11 +240,17 @@ class ListenerImpl
 
     std::thread m_thread;
     concurrent::smart_lock<internal::Event_t, std::recursive_mutex> m_events[Capacity];
+    /// @brief set while a worker executes the callback of the event, a worker which detaches the event in the meantime
+    ///        does not wait for the lock of the event since this deadlocks when both callbacks detach each other
+    std::atomic_bool m_isExecutedByWorker[Capacity];
+    /// @brief set when the detach of the event was handed over to the worker which executes its callback
+    std::atomic_bool m_isRemovalDeferred[Capacity];
     std::mutex m_addEventMutex;
 
     std::atomic_bool m_wasDtorCalled{false};
     ConditionVariableData* m_conditionVariableData = nullptr;
     ConditionListener m_conditionListener;
+    cxx::optional<internal::ListenerWorkerPool<Capacity>> m_workerPool;
 };
 
 class Listener : public ListenerImpl<MAX_NUMBER_OF_EVENTS_PER_LISTENER>
@@ -222,9 +258,10 @@ class Listener : public ListenerImpl<MAX_NUMBER_OF_EVENTS_PER_LISTENER>
   public:
     using Parent = ListenerImpl<MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
     Listener() noexcept;
+    explicit Listener(const ListenerOptions& options) noexcept;
 
   protected:
-    Listener(ConditionVariableData& conditionVariableData) noexcept;
+    Listener(ConditionVariableData& conditionVariableData, const ListenerOptions& options = ListenerOptions()) noexcept;
 };
 
 } // namespace popo
@@ -43,6 +43,16 @@ struct PublisherOptions
     /// @brief The option whether the publisher should block when the subscriber queue is full
     ConsumerTooSlowPolicy subscriberTooSlowPolicy{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
 
+    /// @brief The number of subscribers from which on a sample is delivered in parallel by the delivery threads of
+    /// the process, the publish call still returns after all subscribers received the sample. Zero disables the
+    /// parallel delivery.
+    uint64_t parallelDeliveryThreshold{0U};
+
+    /// @brief The option whether the chunks are obtained via a small cache of the publisher which is refilled in
+    /// batches, this reduces the contention on the mempools when many publishers allocate concurrently. Up to
+    /// mepoo::ChunkCache::CAPACITY chunks are held back by the cache and are not available to other publishers.
+    bool useChunkCache{false};
+
     /// @brief serialization of the PublisherOptions
     cxx::Serialization serialize() const noexcept;
     /// @brief deserialization of the PublisherOptions
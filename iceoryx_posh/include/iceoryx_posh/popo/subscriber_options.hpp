@@ -51,6 +51,19 @@ struct SubscriberOptions
     ///        i.e. require historyCapacity > 0 to be eligible to be connected
     bool requiresPublisherHistorySupport{false};
 
+    /// @brief The subscriber keeps only the latest sample in a single slot instead of a queue, every new sample
+    ///        replaces the one which was not yet taken. queueCapacity and queueFullPolicy are ignored and replaced
+    ///        samples are not reported as lost. Suited for topics where only the newest state is of interest.
+    bool latestSampleOnly{false};
+
+    /// @brief Only every n-th sample which is offered to the subscriber is delivered, the others are dropped by the
+    ///        publisher before they reach the queue and do not wake up the subscriber. 0 and 1 deliver every sample.
+    uint64_t decimation{1U};
+
+    /// @brief The max number of samples per second which are delivered to the subscriber, samples which arrive
+    ///        earlier are dropped by the publisher like with decimation. 0 means no limit.
+    uint64_t maxSampleRate{0U};
+
     /// @brief serialization of the SubscriberOptions
     cxx::Serialization serialize() const noexcept;
     /// @brief deserialization of the SubscriberOptions
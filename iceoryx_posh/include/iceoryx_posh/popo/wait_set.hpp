@@ -45,6 +45,7 @@ enum class WaitSetError : uint8_t
 {
     WAIT_SET_FULL,
     ALREADY_ATTACHED,
+    FILE_DESCRIPTOR_UNAVAILABLE,
 };
 
 
@@ -203,6 +204,22 @@ class WaitSet
     /// @return NotificationInfoVector of NotificationInfos that have been triggered
     NotificationInfoVector wait() noexcept;
 
+    /// @brief Sets how long wait() and timedWait() poll for triggers before they block. Useful for control loops on
+    ///        isolated cores where the wake up latency of a blocking wait is too high.
+    /// @param[in] spinBudget zero (default) blocks right away, units::Duration::max() polls and never blocks
+    void setSpinBudget(const units::Duration spinBudget) noexcept;
+
+    /// @brief Returns how long wait() and timedWait() poll for triggers before they block
+    units::Duration getSpinBudget() const noexcept;
+
+    /// @brief Returns a file descriptor which is readable as long as triggers are pending, this way the WaitSet can be
+    ///        integrated into select, poll or epoll based event loops. When the file descriptor is readable
+    ///        timedWait(units::Duration::zero()) returns the triggered triggers without blocking. It stays readable as
+    ///        long as attached states are satisfied.
+    /// @note the file descriptor is valid as long as the WaitSet exists and must not be closed by the user
+    /// @return the file descriptor or WaitSetError::FILE_DESCRIPTOR_UNAVAILABLE when it could not be created
+    cxx::expected<int32_t, WaitSetError> getFileDescriptor() noexcept;
+
     /// @brief Returns the amount of stored Trigger inside of the WaitSet
     uint64_t size() const noexcept;
 
@@ -20,6 +20,7 @@
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/mepoo/allocation_size_histogram.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 
 namespace iox
@@ -42,6 +43,10 @@ struct MemPoolInfo
     uint32_t m_numChunks{0};
     uint32_t m_chunkSize{0};
     uint32_t m_chunkPayloadSize{0};
+    /// @brief the number of chunks which were taken from a larger mempool since this one was exhausted
+    uint64_t m_numberOfFallbacks{0};
+    /// @brief the number of allocations which failed since neither this mempool nor a larger one had a free chunk
+    uint64_t m_numberOfFailedAllocations{0};
 };
 
 /// @brief container for MemPoolInfo structs of all available mempools.
@@ -59,6 +64,28 @@ struct MemPoolIntrospectionInfo
 /// @brief container for MemPoolInfo structs of all available mempools.
 using MemPoolIntrospectionInfoContainer = cxx::vector<MemPoolIntrospectionInfo, MAX_SHM_SEGMENTS + 1>;
 
+/// @brief the allocation size histograms are much larger than the other mempool statistics, therefore they have their
+/// own topic which is only sent while it is subscribed
+const capro::ServiceDescription
+    IntrospectionMemPoolAllocationSizeService(INTROSPECTION_SERVICE_ID, "RouDi_ID", "MemPoolAllocationSize");
+
+/// @brief the required chunk sizes of the allocations for which a mempool was the best fit, in the order of the
+/// mempools in MemPoolIntrospectionInfo::m_mempoolInfo; the waste of a mempool can be estimated with
+/// maxAverageUsageInPercent
+using AllocationSizeHistogramContainer = cxx::vector<mepoo::AllocationSizeHistogram, MAX_NUMBER_OF_MEMPOOLS>;
+
+/// @brief the topic for the allocation sizes of the mempools of a segment, m_id is the one of the
+/// MemPoolIntrospectionInfo of the segment
+struct MemPoolAllocationSizeIntrospectionInfo
+{
+    uint32_t m_id;
+    AllocationSizeHistogramContainer m_allocationSizeHistograms;
+};
+
+/// @brief container for the allocation sizes of all segments
+using MemPoolAllocationSizeIntrospectionInfoContainer =
+    cxx::vector<MemPoolAllocationSizeIntrospectionInfo, MAX_SHM_SEGMENTS + 1>;
+
 /// @brief publisher/subscriber port information consisting of a process name,a capro service description string
 /// and a node name
 const capro::ServiceDescription IntrospectionPortService(INTROSPECTION_SERVICE_ID, "RouDi_ID", "Port");
@@ -48,6 +48,8 @@ enum class MemoryProviderError
     MEMORY_ALLOCATION_FAILED,
     /// memory creation failed at mapping memory
     MEMORY_MAPPING_FAILED,
+    /// memory creation failed at locking memory in RAM
+    MEMORY_LOCKING_FAILED,
     /// an action was performed which requires memory
     MEMORY_NOT_AVAILABLE,
     /// generic error if memory destruction failed
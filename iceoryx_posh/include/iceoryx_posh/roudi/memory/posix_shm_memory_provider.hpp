@@ -39,9 +39,11 @@ class PosixShmMemoryProvider : public MemoryProvider
     /// @param [in] shmName is the name of the posix share memory
     /// @param [in] accessMode defines the read and write access to the memory
     /// @param [in] openMode defines the creation/open mode of the shared memory.
+    /// @param [in] lockInMemory if true the shared memory is locked in RAM after it was created
     PosixShmMemoryProvider(const ShmName_t& shmName,
                            const posix::AccessMode accessMode,
-                           const posix::OpenMode openMode) noexcept;
+                           const posix::OpenMode openMode,
+                           const bool lockInMemory = false) noexcept;
     ~PosixShmMemoryProvider() noexcept;
 
     PosixShmMemoryProvider(PosixShmMemoryProvider&&) = delete;
@@ -63,6 +65,7 @@ class PosixShmMemoryProvider : public MemoryProvider
     ShmName_t m_shmName;
     posix::AccessMode m_accessMode{posix::AccessMode::READ_ONLY};
     posix::OpenMode m_openMode{posix::OpenMode::OPEN_EXISTING};
+    bool m_lockInMemory{false};
     cxx::optional<posix::SharedMemoryObject> m_shmObject;
 
     static constexpr cxx::perms SHM_MEMORY_PERMISSIONS =
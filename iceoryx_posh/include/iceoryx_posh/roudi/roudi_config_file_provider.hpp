@@ -35,6 +35,14 @@ namespace roudi
 /// MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED - the max number of mempools per segment is exceeded
 /// MEMPOOL_WITHOUT_CHUNK_SIZE - chunk size not specified for the mempool
 /// MEMPOOL_WITHOUT_CHUNK_COUNT - chunk count not specified for the mempool
+/// INVALID_MEMPOOL_FALLBACK_POLICY - the mempool fallback of a segment is none of the supported policies
+/// INVALID_HUGE_PAGE_SIZE - the huge pages of a segment are none of the supported sizes
+/// INVALID_HUGE_PAGE_MOUNT - the huge page mount of a segment is not a valid path to a directory
+/// INVALID_NUMA_POLICY - the NUMA policy of a segment is none of the supported policies
+/// INVALID_NUMA_NODES - the NUMA nodes of a segment do not exist or do not fit to its NUMA policy
+/// INVALID_PREFAULT_STRATEGY - the prefault strategy of a segment is none of the supported strategies
+/// INVALID_LOCK_IN_MEMORY - the lock-in-memory entry of a segment is not a boolean
+/// INVALID_EXTENSION_CHUNKS - the extension-chunks entry of a segment is not a non-negative 32 bit integer
 enum class RouDiConfigFileParseError
 {
     NO_GENERAL_SECTION,
@@ -45,6 +53,14 @@ enum class RouDiConfigFileParseError
     MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED,
     MEMPOOL_WITHOUT_CHUNK_SIZE,
     MEMPOOL_WITHOUT_CHUNK_COUNT,
+    INVALID_MEMPOOL_FALLBACK_POLICY,
+    INVALID_HUGE_PAGE_SIZE,
+    INVALID_HUGE_PAGE_MOUNT,
+    INVALID_NUMA_POLICY,
+    INVALID_NUMA_NODES,
+    INVALID_PREFAULT_STRATEGY,
+    INVALID_LOCK_IN_MEMORY,
+    INVALID_EXTENSION_CHUNKS,
     EXCEPTION_IN_PARSER
 };
 
@@ -56,6 +72,14 @@ constexpr const char* ROUDI_CONFIG_FILE_PARSE_ERROR_STRINGS[] = {"NO_GENERAL_SEC
                                                                  "MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED",
                                                                  "MEMPOOL_WITHOUT_CHUNK_SIZE",
                                                                  "MEMPOOL_WITHOUT_CHUNK_COUNT",
+                                                                 "INVALID_MEMPOOL_FALLBACK_POLICY",
+                                                                 "INVALID_HUGE_PAGE_SIZE",
+                                                                 "INVALID_HUGE_PAGE_MOUNT",
+                                                                 "INVALID_NUMA_POLICY",
+                                                                 "INVALID_NUMA_NODES",
+                                                                 "INVALID_PREFAULT_STRATEGY",
+                                                                 "INVALID_LOCK_IN_MEMORY",
+                                                                 "INVALID_EXTENSION_CHUNKS",
                                                                  "EXCEPTION_IN_PARSER"};
 
 /// @brief Base class for a config file provider.
@@ -0,0 +1,85 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/mepoo/allocation_size_histogram.hpp"
+
+namespace iox
+{
+namespace mepoo
+{
+constexpr uint32_t AllocationSizeHistogram::NUMBER_OF_BUCKETS;
+constexpr uint32_t AllocationSizeHistogram::BUCKETS_PER_OCTAVE;
+
+namespace
+{
+/// @brief 2^(-i/4) for i in [0, 4) as fixed point number with 16 fractional bits
+// NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+constexpr uint64_t FRACTION_OF_OCTAVE[AllocationSizeHistogram::BUCKETS_PER_OCTAVE]{65536U, 55109U, 46341U, 38968U};
+constexpr uint64_t FRACTIONAL_BITS{16U};
+} // namespace
+
+uint32_t AllocationSizeHistogram::upperBound(const uint32_t chunkSize, const uint32_t bucket) noexcept
+{
+    const uint64_t octave = bucket / BUCKETS_PER_OCTAVE;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) the index is less than BUCKETS_PER_OCTAVE
+    const uint64_t fraction = FRACTION_OF_OCTAVE[bucket % BUCKETS_PER_OCTAVE];
+    return static_cast<uint32_t>((static_cast<uint64_t>(chunkSize) * fraction) >> (FRACTIONAL_BITS + octave));
+}
+
+uint32_t AllocationSizeHistogram::bucket(const uint32_t chunkSize, const uint32_t requiredChunkSize) noexcept
+{
+    // the allocations of a mempool usually fit well, therefore the search starts at the largest bucket
+    uint32_t bucket{0U};
+    while (bucket + 1U < NUMBER_OF_BUCKETS && requiredChunkSize <= upperBound(chunkSize, bucket + 1U))
+    {
+        ++bucket;
+    }
+    return bucket;
+}
+
+uint64_t AllocationSizeHistogram::numberOfAllocations() const noexcept
+{
+    uint64_t numberOfAllocations{0U};
+    for (const auto count : m_counts)
+    {
+        numberOfAllocations += count;
+    }
+    return numberOfAllocations;
+}
+
+uint32_t AllocationSizeHistogram::maxAverageUsageInPercent(const uint32_t chunkSize) const noexcept
+{
+    const uint64_t allocations = numberOfAllocations();
+    if (allocations == 0U || chunkSize == 0U)
+    {
+        return 0U;
+    }
+
+    // the sum of the upper bounds fits into a long double without loss of the relevant digits, a uint64_t might
+    // overflow for long running systems
+    long double requiredBytes{0.0L};
+    for (uint32_t bucket = 0U; bucket < NUMBER_OF_BUCKETS; ++bucket)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) the index is less than NUMBER_OF_BUCKETS
+        requiredBytes += static_cast<long double>(m_counts[bucket]) * upperBound(chunkSize, bucket);
+    }
+    constexpr long double PERCENT{100.0L};
+    return static_cast<uint32_t>(PERCENT * requiredBytes
+                                 / (static_cast<long double>(allocations) * static_cast<long double>(chunkSize)));
+}
+
+} // namespace mepoo
+} // namespace iox
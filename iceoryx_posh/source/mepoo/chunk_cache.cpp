@@ -0,0 +1,170 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/chunk_cache.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+
+namespace iox
+{
+namespace mepoo
+{
+constexpr uint32_t ChunkCache::CAPACITY;
+
+ChunkCache::ChunkCache(const bool isRefilledInBatches) noexcept
+    : m_isRefilledInBatches(isRefilledInBatches)
+{
+}
+
+bool ChunkCache::take(MemPool& memPool, MemPool& chunkManagementPool, void*& chunk, void*& chunkManagement) noexcept
+{
+    if (!m_isRefilledInBatches)
+    {
+        flushRecordedAllocations();
+        chunk = memPool.getChunk();
+        if (chunk == nullptr)
+        {
+            return false;
+        }
+        chunkManagement = chunkManagementPool.getChunk();
+        if (chunkManagement == nullptr)
+        {
+            memPool.freeChunk(chunk);
+            chunk = nullptr;
+            return false;
+        }
+        return true;
+    }
+
+    if (m_numberOfChunks != 0U && m_memPool != &memPool)
+    {
+        drain();
+    }
+
+    if (m_numberOfChunks == 0U)
+    {
+        refill(memPool, chunkManagementPool);
+        if (m_numberOfChunks == 0U)
+        {
+            return false;
+        }
+    }
+
+    --m_numberOfChunks;
+    --m_numberOfChunkManagements;
+    chunk = memPool.chunkOfIndex(m_chunkIndices[m_numberOfChunks]);
+    chunkManagement = chunkManagementPool.chunkOfIndex(m_chunkManagementIndices[m_numberOfChunkManagements]);
+    return true;
+}
+
+void ChunkCache::refill(MemPool& memPool, MemPool& chunkManagementPool) noexcept
+{
+    static_assert(CAPACITY <= MemPool::MAX_CHUNKS_PER_BATCH, "The cache must be refilled with a single batch");
+
+    flushRecordedAllocations();
+
+    // the mempools are set first and the free lists write the indices directly into the cache, drain therefore
+    // returns the chunks of a refill which is interrupted by a crash
+    m_memPool = &memPool;
+    m_chunkManagementPool = &chunkManagementPool;
+    m_numberOfChunks = memPool.getChunkIndices(&m_chunkIndices[0], CAPACITY);
+    if (m_numberOfChunks == 0U)
+    {
+        return;
+    }
+    m_numberOfChunkManagements = chunkManagementPool.getChunkIndices(&m_chunkManagementIndices[0], m_numberOfChunks);
+
+    if (m_numberOfChunkManagements < m_numberOfChunks)
+    {
+        // the chunks are removed from the cache before they are returned, a crash in between leaks them instead of
+        // returning them twice
+        const uint32_t numberOfSurplusChunks = m_numberOfChunks - m_numberOfChunkManagements;
+        m_numberOfChunks = m_numberOfChunkManagements;
+        memPool.freeChunkIndices(&m_chunkIndices[m_numberOfChunks], numberOfSurplusChunks);
+    }
+}
+
+void ChunkCache::drain() noexcept
+{
+    flushRecordedAllocations();
+
+    const uint32_t numberOfChunks = m_numberOfChunks;
+    const uint32_t numberOfChunkManagements = m_numberOfChunkManagements;
+    // the cache is emptied before the chunks are returned, a crash in between leaks them instead of returning them
+    // twice
+    m_numberOfChunks = 0U;
+    m_numberOfChunkManagements = 0U;
+
+    if (numberOfChunks != 0U)
+    {
+        m_memPool->freeChunkIndices(&m_chunkIndices[0], numberOfChunks);
+    }
+    if (numberOfChunkManagements != 0U)
+    {
+        m_chunkManagementPool->freeChunkIndices(&m_chunkManagementIndices[0], numberOfChunkManagements);
+    }
+}
+
+void ChunkCache::recordAllocation(MemPool& memPool, const uint32_t requiredChunkSize) noexcept
+{
+    if (m_numberOfRecordedAllocations > 0U
+        && (m_recordedMemPool != &memPool || m_recordedChunkSize != requiredChunkSize))
+    {
+        flushRecordedAllocations();
+    }
+    if (m_numberOfRecordedAllocations == 0U)
+    {
+        m_recordedMemPool = &memPool;
+        m_recordedChunkSize = requiredChunkSize;
+    }
+    ++m_numberOfRecordedAllocations;
+}
+
+void ChunkCache::flushRecordedAllocations() noexcept
+{
+    if (m_numberOfRecordedAllocations == 0U)
+    {
+        return;
+    }
+    m_recordedMemPool->recordAllocation(m_recordedChunkSize, m_numberOfRecordedAllocations);
+    m_numberOfRecordedAllocations = 0U;
+}
+
+uint32_t ChunkCache::size() const noexcept
+{
+    return m_numberOfChunks;
+}
+
+cxx::optional<uint32_t> ChunkCache::resolvedMemPoolIndex(const uint32_t requiredChunkSize,
+                                                          const uint32_t numberOfMemPools) const noexcept
+{
+    if (m_resolvedChunkSize != requiredChunkSize || m_resolvedNumberOfMemPools != numberOfMemPools)
+    {
+        return cxx::nullopt;
+    }
+    return m_resolvedMemPoolIndex;
+}
+
+void ChunkCache::setResolvedMemPoolIndex(const uint32_t requiredChunkSize,
+                                         const uint32_t numberOfMemPools,
+                                         const uint32_t memPoolIndex) noexcept
+{
+    m_resolvedChunkSize = requiredChunkSize;
+    m_resolvedNumberOfMemPools = numberOfMemPools;
+    m_resolvedMemPoolIndex = memPoolIndex;
+}
+
+} // namespace mepoo
+} // namespace iox
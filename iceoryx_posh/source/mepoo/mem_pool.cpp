@@ -22,6 +22,8 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 
 #include <algorithm>
+#include <cstddef>
+#include <type_traits>
 
 namespace iox
 {
@@ -30,15 +32,18 @@ namespace mepoo
 MemPoolInfo::MemPoolInfo(const uint32_t usedChunks,
                          const uint32_t minFreeChunks,
                          const uint32_t numChunks,
-                         const uint32_t chunkSize) noexcept
+                         const uint32_t chunkSize,
+                         const uint64_t numberOfFallbacks) noexcept
     : m_usedChunks(usedChunks)
     , m_minFreeChunks(minFreeChunks)
     , m_numChunks(numChunks)
     , m_chunkSize(chunkSize)
+    , m_numberOfFallbacks(numberOfFallbacks)
 {
 }
 
 constexpr uint64_t MemPool::CHUNK_MEMORY_ALIGNMENT;
+constexpr uint32_t MemPool::MAX_CHUNKS_PER_BATCH;
 
 MemPool::MemPool(const cxx::greater_or_equal<uint32_t, CHUNK_MEMORY_ALIGNMENT> chunkSize,
                  const cxx::greater_or_equal<uint32_t, 1> numberOfChunks,
@@ -48,6 +53,19 @@ MemPool::MemPool(const cxx::greater_or_equal<uint32_t, CHUNK_MEMORY_ALIGNMENT> c
     , m_numberOfChunks(numberOfChunks)
     , m_minFree(numberOfChunks)
 {
+    static_assert(std::is_standard_layout<MemPool>::value,
+                  "the cache line separation of MemPool can only be checked with a standard layout");
+    static_assert(concurrent::isSeparatedByCacheLine(offsetof(MemPool, m_numberOfChunks) + sizeof(m_numberOfChunks),
+                                                     offsetof(MemPool, m_usedChunks)),
+                  "the setup members must not share a cache line with the statistics");
+    static_assert(concurrent::isSeparatedByCacheLine(offsetof(MemPool, m_allocationSizeCounts)
+                                                         + sizeof(m_allocationSizeCounts),
+                                                     offsetof(MemPool, m_freeIndices)),
+                  "the statistics must not share a cache line with the free list");
+    static_assert(concurrent::isSeparatedByCacheLine(offsetof(MemPool, m_freeIndices) + sizeof(m_freeIndices),
+                                                     sizeof(MemPool)),
+                  "the free list must not share a cache line with the next mempool");
+
     if (isMultipleOfAlignment(chunkSize))
     {
         m_rawMemory = static_cast<uint8_t*>(chunkMemoryAllocator.allocate(
@@ -93,7 +111,7 @@ void* MemPool::getChunk() noexcept
     return m_rawMemory.get() + l_index * m_chunkSize;
 }
 
-void MemPool::freeChunk(const void* chunk) noexcept
+uint32_t MemPool::indexOfChunk(const void* chunk) const noexcept
 {
     cxx::Expects(m_rawMemory.get() <= chunk
                  && chunk <= m_rawMemory.get() + (static_cast<uint64_t>(m_chunkSize) * (m_numberOfChunks - 1U)));
@@ -101,7 +119,12 @@ void MemPool::freeChunk(const void* chunk) noexcept
     auto offset = static_cast<const uint8_t*>(chunk) - m_rawMemory.get();
     cxx::Expects(offset % m_chunkSize == 0);
 
-    uint32_t index = static_cast<uint32_t>(offset / m_chunkSize);
+    return static_cast<uint32_t>(offset / m_chunkSize);
+}
+
+void MemPool::freeChunk(const void* chunk) noexcept
+{
+    uint32_t index = indexOfChunk(chunk);
 
     if (!m_freeIndices.push(index))
     {
@@ -111,6 +134,65 @@ void MemPool::freeChunk(const void* chunk) noexcept
     m_usedChunks.fetch_sub(1U, std::memory_order_relaxed);
 }
 
+uint32_t MemPool::getChunks(cxx::not_null<void**> chunks, const uint32_t numberOfChunks) noexcept
+{
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    freeList_t::Index_t indices[MAX_CHUNKS_PER_BATCH];
+    const uint32_t numberOfObtainedChunks = getChunkIndices(&indices[0], numberOfChunks);
+
+    for (uint32_t i = 0U; i < numberOfObtainedChunks; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) limited by numberOfChunks
+        static_cast<void**>(chunks)[i] = chunkOfIndex(indices[i]);
+    }
+    return numberOfObtainedChunks;
+}
+
+void MemPool::freeChunks(cxx::not_null<void* const*> chunks, const uint32_t numberOfChunks) noexcept
+{
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    freeList_t::Index_t indices[MAX_CHUNKS_PER_BATCH];
+    for (uint32_t first = 0U; first < numberOfChunks; first += MAX_CHUNKS_PER_BATCH)
+    {
+        const uint32_t batchSize = std::min(numberOfChunks - first, MAX_CHUNKS_PER_BATCH);
+        for (uint32_t i = 0U; i < batchSize; ++i)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) limited by numberOfChunks
+            indices[i] = indexOfChunk(static_cast<void* const*>(chunks)[first + i]);
+        }
+        freeChunkIndices(&indices[0], batchSize);
+    }
+}
+
+uint32_t MemPool::getChunkIndices(cxx::not_null<uint32_t*> chunkIndices, const uint32_t numberOfChunks) noexcept
+{
+    const uint32_t numberOfObtainedChunks =
+        m_freeIndices.pop(chunkIndices, std::min(numberOfChunks, MAX_CHUNKS_PER_BATCH));
+    if (numberOfObtainedChunks == 0U)
+    {
+        return 0U;
+    }
+
+    m_usedChunks.fetch_add(numberOfObtainedChunks, std::memory_order_relaxed);
+    adjustMinFree();
+    return numberOfObtainedChunks;
+}
+
+void MemPool::freeChunkIndices(cxx::not_null<const uint32_t*> chunkIndices, const uint32_t numberOfChunks) noexcept
+{
+    if (!m_freeIndices.push(chunkIndices, numberOfChunks))
+    {
+        errorHandler(PoshError::POSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
+    }
+
+    m_usedChunks.fetch_sub(numberOfChunks, std::memory_order_relaxed);
+}
+
+void* MemPool::chunkOfIndex(const uint32_t chunkIndex) const noexcept
+{
+    return m_rawMemory.get() + static_cast<uint64_t>(chunkIndex) * m_chunkSize;
+}
+
 uint32_t MemPool::getChunkSize() const noexcept
 {
     return m_chunkSize;
@@ -133,10 +215,45 @@ uint32_t MemPool::getMinFree() const noexcept
 
 MemPoolInfo MemPool::getInfo() const noexcept
 {
-    return {m_usedChunks.load(std::memory_order_relaxed),
-            m_minFree.load(std::memory_order_relaxed),
-            m_numberOfChunks,
-            m_chunkSize};
+    MemPoolInfo info{m_usedChunks.load(std::memory_order_relaxed),
+                     m_minFree.load(std::memory_order_relaxed),
+                     m_numberOfChunks,
+                     m_chunkSize,
+                     m_numberOfFallbacks.load(std::memory_order_relaxed)};
+    info.m_numberOfFailedAllocations = m_numberOfFailedAllocations.load(std::memory_order_relaxed);
+    for (uint32_t i = 0U; i < AllocationSizeHistogram::NUMBER_OF_BUCKETS; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) the index is less than NUMBER_OF_BUCKETS
+        info.m_allocationSizeHistogram.m_counts[i] = m_allocationSizeCounts[i].load(std::memory_order_relaxed);
+    }
+    return info;
+}
+
+void MemPool::increaseNumberOfFallbacks() noexcept
+{
+    m_numberOfFallbacks.fetch_add(1U, std::memory_order_relaxed);
+}
+
+uint64_t MemPool::getNumberOfFallbacks() const noexcept
+{
+    return m_numberOfFallbacks.load(std::memory_order_relaxed);
+}
+
+void MemPool::recordAllocation(const uint32_t requiredChunkSize, const uint64_t numberOfAllocations) noexcept
+{
+    const uint32_t bucket = AllocationSizeHistogram::bucket(m_chunkSize, requiredChunkSize);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) the bucket is less than NUMBER_OF_BUCKETS
+    m_allocationSizeCounts[bucket].fetch_add(numberOfAllocations, std::memory_order_relaxed);
+}
+
+void MemPool::increaseNumberOfFailedAllocations() noexcept
+{
+    m_numberOfFailedAllocations.fetch_add(1U, std::memory_order_relaxed);
+}
+
+uint64_t MemPool::getNumberOfFailedAllocations() const noexcept
+{
+    return m_numberOfFailedAllocations.load(std::memory_order_relaxed);
 }
 
 } // namespace mepoo
@@ -27,15 +27,20 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <limits>
 
 namespace iox
 {
 namespace mepoo
 {
+constexpr uint32_t MemoryManager::NUMBER_OF_SIZE_CLASSES;
+
 void MemoryManager::printMemPoolVector(log::LogStream& log) const noexcept
 {
-    for (auto& l_mempool : m_memPoolVector)
+    const uint32_t numberOfMemPools = getNumberOfMemPools();
+    for (uint32_t index = 0U; index < numberOfMemPools; ++index)
     {
+        const auto& l_mempool = memPool(index);
         log << "  MemPool [ ChunkSize = " << l_mempool.getChunkSize()
             << ", ChunkPayloadSize = " << l_mempool.getChunkSize() - sizeof(ChunkHeader)
             << ", ChunkCount = " << l_mempool.getChunkCount() << " ]";
@@ -74,21 +79,111 @@ void MemoryManager::generateChunkManagementPool(posix::Allocator& managementAllo
 {
     m_denyAddMemPool = true;
     uint32_t chunkSize = sizeof(ChunkManagement);
-    m_chunkManagementPool.emplace_back(chunkSize, m_totalNumberOfChunks, managementAllocator, managementAllocator);
+    m_chunkManagementPool.emplace_back(
+        chunkSize, m_totalNumberOfChunks + m_numberOfFreeExtensionChunks, managementAllocator, managementAllocator);
+
+    // a chunk size of size class c is larger than 2^(c-1), the mempools in front of the first mempool with larger
+    // chunks can therefore never serve it
+    m_firstMemPoolOfSizeClass.clear();
+    uint32_t memPoolIndex{0U};
+    for (uint32_t sizeClass = 0U; sizeClass < NUMBER_OF_SIZE_CLASSES; ++sizeClass)
+    {
+        const uint64_t lowerBound = (sizeClass == 0U) ? 0U : (1ULL << (sizeClass - 1U));
+        while (memPoolIndex < m_memPoolVector.size() && m_memPoolVector[memPoolIndex].getChunkSize() <= lowerBound)
+        {
+            ++memPoolIndex;
+        }
+        m_firstMemPoolOfSizeClass.emplace_back(memPoolIndex);
+    }
+}
+
+uint32_t MemoryManager::sizeClass(const uint32_t chunkSize) noexcept
+{
+    if (chunkSize <= 1U)
+    {
+        return 0U;
+    }
+
+    // binary search for the highest set bit of chunkSize - 1, which is ceil(log2(chunkSize)) - 1
+    uint32_t value = chunkSize - 1U;
+    uint32_t highestBit{0U};
+    for (uint32_t shift = 16U; shift > 0U; shift /= 2U)
+    {
+        if (value >= (1U << shift))
+        {
+            value >>= shift;
+            highestBit += shift;
+        }
+    }
+    return highestBit + 1U;
+}
+
+uint32_t MemoryManager::memPoolIndexForChunkSize(const uint32_t requiredChunkSize,
+                                                 const uint32_t numberOfMemPools) const noexcept
+{
+    const auto numberOfConfiguredMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    if (m_firstMemPoolOfSizeClass.empty())
+    {
+        return numberOfMemPools;
+    }
+
+    // only the mempools within the size class need to be compared
+    uint32_t memPoolIndex = m_firstMemPoolOfSizeClass[sizeClass(requiredChunkSize)];
+    while (memPoolIndex < numberOfConfiguredMemPools
+           && m_memPoolVector[memPoolIndex].getChunkSize() < requiredChunkSize)
+    {
+        ++memPoolIndex;
+    }
+    if (memPoolIndex == numberOfConfiguredMemPools)
+    {
+        memPoolIndex = numberOfMemPools;
+    }
+
+    // the mempools which were added at runtime are not ordered, they are only taken when they fit better
+    for (uint32_t index = numberOfConfiguredMemPools; index < numberOfMemPools; ++index)
+    {
+        const uint32_t chunkSize = memPool(index).getChunkSize();
+        if (chunkSize >= requiredChunkSize
+            && (memPoolIndex == numberOfMemPools || chunkSize < memPool(memPoolIndex).getChunkSize()))
+        {
+            memPoolIndex = index;
+        }
+    }
+    return memPoolIndex;
+}
+
+MemPool& MemoryManager::memPool(const uint32_t index) noexcept
+{
+    // AXIVION Next Construct AutosarC++19_03-A5.2.3 : const cast to avoid code duplication
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    return const_cast<MemPool&>(const_cast<const MemoryManager*>(this)->memPool(index));
+}
+
+const MemPool& MemoryManager::memPool(const uint32_t index) const noexcept
+{
+    const auto numberOfConfiguredMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    if (index < numberOfConfiguredMemPools)
+    {
+        return m_memPoolVector[index];
+    }
+    // the size of m_extensionMemPools is changed by RouDi while the applications allocate, the valid mempools are
+    // therefore accessed without reading it
+    return *(m_extensionMemPools.begin() + (index - numberOfConfiguredMemPools));
 }
 
 uint32_t MemoryManager::getNumberOfMemPools() const noexcept
 {
-    return static_cast<uint32_t>(m_memPoolVector.size());
+    return static_cast<uint32_t>(m_memPoolVector.size())
+           + m_numberOfExtensionMemPools.load(std::memory_order_acquire);
 }
 
 MemPoolInfo MemoryManager::getMemPoolInfo(const uint32_t index) const noexcept
 {
-    if (index >= m_memPoolVector.size())
+    if (index >= getNumberOfMemPools())
     {
-        return {0, 0, 0, 0};
+        return {0, 0, 0, 0, 0};
     }
-    return m_memPoolVector[index].getInfo();
+    return memPool(index).getInfo();
 }
 
 uint32_t MemoryManager::sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t size) noexcept
@@ -115,7 +210,8 @@ uint64_t MemoryManager::requiredChunkMemorySize(const MePooConfig& mePooConfig)
 uint64_t MemoryManager::requiredManagementMemorySize(const MePooConfig& mePooConfig) noexcept
 {
     uint64_t memorySize{0U};
-    uint64_t sumOfAllChunks{0U};
+    // the chunk management of the chunks which are added at runtime is reserved upfront
+    uint64_t sumOfAllChunks{mePooConfig.m_maxNumberOfExtensionChunks};
     for (const auto& mempool : mePooConfig.m_mempoolConfig)
     {
         sumOfAllChunks += mempool.m_chunkCount;
@@ -126,10 +222,25 @@ uint64_t MemoryManager::requiredManagementMemorySize(const MePooConfig& mePooCon
     memorySize += cxx::align(sumOfAllChunks * sizeof(ChunkManagement), MemPool::CHUNK_MEMORY_ALIGNMENT);
     memorySize +=
         cxx::align(MemPool::freeList_t::requiredIndexMemorySize(sumOfAllChunks), MemPool::CHUNK_MEMORY_ALIGNMENT);
+    memorySize += requiredExtensionManagementMemorySize(mePooConfig.m_maxNumberOfExtensionChunks);
 
     return memorySize;
 }
 
+uint64_t MemoryManager::requiredExtensionManagementMemorySize(const uint64_t numberOfExtensionChunks) noexcept
+{
+    if (numberOfExtensionChunks == 0U)
+    {
+        return 0U;
+    }
+
+    // the chunks can be split into up to MAX_NUMBER_OF_MEMPOOLS mempools, every one of them has a free list with an
+    // additional index which starts at an aligned address
+    return cxx::align(MemPool::freeList_t::requiredIndexMemorySize(numberOfExtensionChunks + MAX_NUMBER_OF_MEMPOOLS),
+                      MemPool::CHUNK_MEMORY_ALIGNMENT)
+           + static_cast<uint64_t>(MAX_NUMBER_OF_MEMPOOLS) * MemPool::CHUNK_MEMORY_ALIGNMENT;
+}
+
 uint64_t MemoryManager::requiredFullMemorySize(const MePooConfig& mePooConfig) noexcept
 {
     return requiredManagementMemorySize(mePooConfig) + requiredChunkMemorySize(mePooConfig);
@@ -139,35 +250,206 @@ void MemoryManager::configureMemoryManager(const MePooConfig& mePooConfig,
                                            posix::Allocator& managementAllocator,
                                            posix::Allocator& chunkMemoryAllocator) noexcept
 {
+    m_fallbackPolicy = mePooConfig.m_fallbackPolicy;
     for (auto entry : mePooConfig.m_mempoolConfig)
     {
         addMemPool(managementAllocator, chunkMemoryAllocator, entry.m_size, entry.m_chunkCount);
     }
 
+    m_numberOfFreeExtensionChunks = mePooConfig.m_maxNumberOfExtensionChunks;
     generateChunkManagementPool(managementAllocator);
+
+    if (m_numberOfFreeExtensionChunks > 0U)
+    {
+        const uint64_t extensionManagementMemorySize =
+            requiredExtensionManagementMemorySize(m_numberOfFreeExtensionChunks);
+        m_extensionManagementAllocator.emplace(
+            managementAllocator.allocate(extensionManagementMemorySize, MemPool::CHUNK_MEMORY_ALIGNMENT),
+            extensionManagementMemorySize);
+    }
+}
+
+cxx::expected<MemoryManager::ExtensionError>
+MemoryManager::verifyExtensionMemPools(const MePooConfig& extensionConfig) const noexcept
+{
+    if (extensionConfig.m_mempoolConfig.empty())
+    {
+        return cxx::error<ExtensionError>(ExtensionError::INVALID_MEMPOOL_CONFIG);
+    }
+
+    uint64_t numberOfChunks{0U};
+    for (const auto& entry : extensionConfig.m_mempoolConfig)
+    {
+        if (entry.m_chunkCount == 0U || entry.m_size < MemPool::CHUNK_MEMORY_ALIGNMENT
+            || entry.m_size % MemPool::CHUNK_MEMORY_ALIGNMENT != 0U
+            || entry.m_size > std::numeric_limits<uint32_t>::max() - sizeof(ChunkHeader))
+        {
+            return cxx::error<ExtensionError>(ExtensionError::INVALID_MEMPOOL_CONFIG);
+        }
+        numberOfChunks += entry.m_chunkCount;
+    }
+
+    if (getNumberOfMemPools() + extensionConfig.m_mempoolConfig.size() > MAX_NUMBER_OF_MEMPOOLS)
+    {
+        return cxx::error<ExtensionError>(ExtensionError::MEMPOOL_LIMIT_EXCEEDED);
+    }
+    if (numberOfChunks > m_numberOfFreeExtensionChunks)
+    {
+        return cxx::error<ExtensionError>(ExtensionError::CHUNK_LIMIT_EXCEEDED);
+    }
+    return cxx::success<>();
+}
+
+void MemoryManager::addExtensionMemPools(const MePooConfig& extensionConfig,
+                                         posix::Allocator& chunkMemoryAllocator) noexcept
+{
+    auto verification = verifyExtensionMemPools(extensionConfig);
+    if (verification.has_error())
+    {
+        LogFatal() << "The mempools cannot be added at runtime since " << asStringLiteral(verification.get_error());
+        errorHandler(iox::PoshError::MEPOO__MEMPOOL_INVALID_EXTENSION);
+        return;
+    }
+
+    for (const auto& entry : extensionConfig.m_mempoolConfig)
+    {
+        m_extensionMemPools.emplace_back(sizeWithChunkHeaderStruct(entry.m_size),
+                                         entry.m_chunkCount,
+                                         m_extensionManagementAllocator.value(),
+                                         chunkMemoryAllocator);
+        m_numberOfFreeExtensionChunks -= entry.m_chunkCount;
+        // the applications access the mempool only after it was constructed
+        m_numberOfExtensionMemPools.store(static_cast<uint32_t>(m_extensionMemPools.size()),
+                                          std::memory_order_release);
+    }
+}
+
+void* MemoryManager::getChunkFromFallbackMemPools(MemPool& exhaustedMemPool,
+                                                  const uint32_t numberOfMemPools,
+                                                  MemPool*& fallbackMemPool) noexcept
+{
+    const uint32_t chunkSize = exhaustedMemPool.getChunkSize();
+
+    // mempools with the same chunk size, e.g. the ones which were added at runtime, are used with every policy
+    uint32_t largestChunkSize{chunkSize};
+    if (m_fallbackPolicy == MemPoolFallbackPolicy::ANY_LARGER)
+    {
+        largestChunkSize = std::numeric_limits<uint32_t>::max();
+    }
+    else if (m_fallbackPolicy == MemPoolFallbackPolicy::NEXT_LARGER)
+    {
+        uint32_t nextLargerChunkSize{chunkSize};
+        for (uint32_t index = 0U; index < numberOfMemPools; ++index)
+        {
+            const uint32_t candidateChunkSize = memPool(index).getChunkSize();
+            if (candidateChunkSize > chunkSize
+                && (nextLargerChunkSize == chunkSize || candidateChunkSize < nextLargerChunkSize))
+            {
+                nextLargerChunkSize = candidateChunkSize;
+            }
+        }
+        largestChunkSize = nextLargerChunkSize;
+    }
+
+    // the candidates are ordered by their chunk size, mempools with the same chunk size keep their order
+    cxx::vector<MemPool*, MAX_NUMBER_OF_MEMPOOLS> candidates;
+    for (uint32_t index = 0U; index < numberOfMemPools; ++index)
+    {
+        MemPool* candidate = &memPool(index);
+        const uint32_t candidateChunkSize = candidate->getChunkSize();
+        if (candidate == &exhaustedMemPool || candidateChunkSize < chunkSize || candidateChunkSize > largestChunkSize)
+        {
+            continue;
+        }
+        candidates.emplace_back(candidate);
+        for (uint64_t position = candidates.size() - 1U;
+             position > 0U && candidates[position - 1U]->getChunkSize() > candidateChunkSize;
+             --position)
+        {
+            std::swap(candidates[position - 1U], candidates[position]);
+        }
+    }
+
+    for (auto candidate : candidates)
+    {
+        void* chunk = candidate->getChunk();
+        if (chunk != nullptr)
+        {
+            exhaustedMemPool.increaseNumberOfFallbacks();
+            fallbackMemPool = candidate;
+            return chunk;
+        }
+    }
+    return nullptr;
 }
 
 cxx::expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
+{
+    return getChunkImpl(chunkSettings, nullptr);
+}
+
+cxx::expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkSettings& chunkSettings,
+                                                                         ChunkCache& chunkCache) noexcept
+{
+    return getChunkImpl(chunkSettings, &chunkCache);
+}
+
+cxx::expected<SharedChunk, MemoryManager::Error>
+MemoryManager::getChunkImpl(const ChunkSettings& chunkSettings, ChunkCache* const chunkCache) noexcept
 {
     void* chunk{nullptr};
+    void* chunkManagementMemory{nullptr};
     MemPool* memPoolPointer{nullptr};
     const auto requiredChunkSize = chunkSettings.requiredChunkSize();
 
     uint32_t aquiredChunkSize = 0U;
 
-    for (auto& memPool : m_memPoolVector)
+    // the mempools which are added at runtime become visible to this allocation at once
+    const uint32_t numberOfMemPools = getNumberOfMemPools();
+    cxx::optional<uint32_t> resolvedMemPoolIndex =
+        (chunkCache == nullptr) ? cxx::nullopt
+                                : chunkCache->resolvedMemPoolIndex(requiredChunkSize, numberOfMemPools);
+    const uint32_t memPoolIndex = resolvedMemPoolIndex.has_value()
+                                      ? resolvedMemPoolIndex.value()
+                                      : memPoolIndexForChunkSize(requiredChunkSize, numberOfMemPools);
+
+    if (memPoolIndex < numberOfMemPools)
     {
-        uint32_t chunkSizeOfMemPool = memPool.getChunkSize();
-        if (chunkSizeOfMemPool >= requiredChunkSize)
+        auto& bestFittingMemPool = memPool(memPoolIndex);
+        if (chunkCache == nullptr)
         {
-            chunk = memPool.getChunk();
-            memPoolPointer = &memPool;
-            aquiredChunkSize = chunkSizeOfMemPool;
-            break;
+            bestFittingMemPool.recordAllocation(requiredChunkSize);
+            chunk = bestFittingMemPool.getChunk();
         }
+        else
+        {
+            chunkCache->recordAllocation(bestFittingMemPool, requiredChunkSize);
+            chunkCache->setResolvedMemPoolIndex(requiredChunkSize, numberOfMemPools, memPoolIndex);
+            if (!chunkCache->take(bestFittingMemPool, m_chunkManagementPool.front(), chunk, chunkManagementMemory))
+            {
+                chunk = nullptr;
+            }
+        }
+        memPoolPointer = &bestFittingMemPool;
+
+        if (chunk == nullptr)
+        {
+            // the chunks of other mempools are taken directly, a ChunkCache only holds chunks of the best fit
+            MemPool* fallbackMemPool{nullptr};
+            chunk = getChunkFromFallbackMemPools(bestFittingMemPool, numberOfMemPools, fallbackMemPool);
+            if (chunk != nullptr)
+            {
+                memPoolPointer = fallbackMemPool;
+            }
+            else
+            {
+                bestFittingMemPool.increaseNumberOfFailedAllocations();
+            }
+        }
+        aquiredChunkSize = memPoolPointer->getChunkSize();
     }
 
-    if (m_memPoolVector.size() == 0)
+    if (numberOfMemPools == 0U)
     {
         LogFatal() << "There are no mempools available!";
 
@@ -199,8 +481,12 @@ cxx::expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const C
     }
     else
     {
+        if (chunkManagementMemory == nullptr)
+        {
+            chunkManagementMemory = m_chunkManagementPool.front().getChunk();
+        }
         auto chunkHeader = new (chunk) ChunkHeader(aquiredChunkSize, chunkSettings);
-        auto chunkManagement = new (m_chunkManagementPool.front().getChunk())
+        auto chunkManagement = new (chunkManagementMemory)
             ChunkManagement(chunkHeader, memPoolPointer, &m_chunkManagementPool.front());
         return cxx::success<SharedChunk>(SharedChunk(chunkManagement));
     }
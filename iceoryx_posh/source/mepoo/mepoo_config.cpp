@@ -24,6 +24,11 @@ namespace iox
 {
 namespace mepoo
 {
+constexpr uint64_t MePooConfig::HUGE_PAGE_SIZE_2M;
+constexpr uint64_t MePooConfig::HUGE_PAGE_SIZE_1G;
+// NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+constexpr const char MePooConfig::DEFAULT_HUGE_PAGE_MOUNT[];
+
 const MePooConfig::MePooConfigContainerType* MePooConfig::getMemPoolConfig() const noexcept
 {
     return &m_mempoolConfig;
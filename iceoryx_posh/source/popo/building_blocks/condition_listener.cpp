@@ -16,24 +16,52 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_hoofs/cxx/deadline_timer.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 
+#include <algorithm>
+#include <limits>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 namespace iox
 {
 namespace popo
 {
-ConditionListener::ConditionListener(ConditionVariableData& condVarData) noexcept
-    : m_condVarDataPtr(&condVarData)
+namespace
+{
+uint64_t countTrailingZeros(const uint64_t value) noexcept
 {
+#if defined(_MSC_VER)
+    unsigned long index{0U};
+    _BitScanForward64(&index, value);
+    return static_cast<uint64_t>(index);
+#else
+    return static_cast<uint64_t>(__builtin_ctzll(value));
+#endif
 }
 
-void ConditionListener::resetSemaphore() noexcept
+/// @brief hints the cpu that we are in a spin loop
+void cpuRelax() noexcept
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield");
+#endif
+}
+
+// only the overload for ConditionVariableData::Semaphore_t is used, inline prevents unused function warnings
+inline void drainSemaphore(posix::UnnamedSemaphore& semaphore) noexcept
 {
     // Count the semaphore down to zero
     bool hasFatalError = false;
     while (!hasFatalError
-           && getMembers()
-                  ->m_semaphore->tryWait()
+           && semaphore.tryWait()
                   .or_else([&](posix::SemaphoreError) {
                       errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_RESET, ErrorLevel::FATAL);
                       hasFatalError = true;
@@ -43,6 +71,58 @@ void ConditionListener::resetSemaphore() noexcept
     }
 }
 
+inline void drainSemaphore(concurrent::FutexSemaphore& semaphore) noexcept
+{
+    semaphore.reset();
+}
+} // namespace
+
+ConditionListener::ConditionListener(ConditionVariableData& condVarData) noexcept
+    : m_condVarDataPtr(&condVarData)
+{
+}
+
+ConditionListener::~ConditionListener() noexcept
+{
+    if (m_notificationSocket.has_value())
+    {
+        getMembers()->m_notificationSocketId.store(NotificationSocket::INVALID_ID, std::memory_order_release);
+    }
+}
+
+cxx::expected<int32_t, NotificationSocketError> ConditionListener::getFileDescriptor() noexcept
+{
+    if (!m_notificationSocket.has_value())
+    {
+        auto result = NotificationSocketBuilder().create(m_notificationSocket);
+        if (result.has_error())
+        {
+            return cxx::error<NotificationSocketError>(result.get_error());
+        }
+        getMembers()->m_notificationSocketId.store(m_notificationSocket->getId(), std::memory_order_seq_cst);
+        // notifications which arrived before the id was published did not signal the socket
+        if (hasPendingNotifications())
+        {
+            NotificationSocket::signal(m_notificationSocket->getId());
+        }
+    }
+
+    return cxx::success<int32_t>(m_notificationSocket->getFileDescriptor());
+}
+
+void ConditionListener::signalFileDescriptor() noexcept
+{
+    if (m_notificationSocket.has_value())
+    {
+        NotificationSocket::signal(m_notificationSocket->getId());
+    }
+}
+
+void ConditionListener::resetSemaphore() noexcept
+{
+    drainSemaphore(*getMembers()->m_semaphore);
+}
+
 void ConditionListener::destroy() noexcept
 {
     m_toBeDestroyed.store(true, std::memory_order_relaxed);
@@ -56,61 +136,140 @@ bool ConditionListener::wasNotified() const noexcept
     return getMembers()->m_wasNotified.load(std::memory_order_relaxed);
 }
 
+void ConditionListener::setSpinBudget(const units::Duration spinBudget) noexcept
+{
+    m_spinBudgetInNanoseconds.store(spinBudget.toNanoseconds(), std::memory_order_relaxed);
+}
+
+units::Duration ConditionListener::getSpinBudget() const noexcept
+{
+    // toNanoseconds saturates, the maximum therefore stands for the pure polling mode
+    const uint64_t spinBudgetInNanoseconds = m_spinBudgetInNanoseconds.load(std::memory_order_relaxed);
+    return (spinBudgetInNanoseconds == std::numeric_limits<uint64_t>::max())
+               ? units::Duration::max()
+               : units::Duration::fromNanoseconds(spinBudgetInNanoseconds);
+}
+
 ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 {
-    return waitImpl([this]() -> bool {
-        if (this->getMembers()->m_semaphore->wait().has_error())
-        {
-            errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT, ErrorLevel::FATAL);
-            return false;
-        }
-        return true;
-    });
+    return waitImpl(
+        [this]() -> bool {
+            if (this->getMembers()->m_semaphore->wait().has_error())
+            {
+                errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT, ErrorLevel::FATAL);
+                return false;
+            }
+            return true;
+        },
+        getSpinBudget());
 }
 
 ConditionListener::NotificationVector_t ConditionListener::timedWait(const units::Duration& timeToWait) noexcept
 {
-    return waitImpl([this, timeToWait]() -> bool {
-        if (this->getMembers()->m_semaphore->timedWait(timeToWait).has_error())
-        {
-            errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT, ErrorLevel::FATAL);
-        }
-        return false;
-    });
+    // the time spent polling is part of the time to wait
+    cxx::DeadlineTimer deadline(timeToWait);
+    return waitImpl(
+        [this, &deadline]() -> bool {
+            if (this->getMembers()->m_semaphore->timedWait(deadline.remainingTime()).has_error())
+            {
+                errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT, ErrorLevel::FATAL);
+            }
+            return false;
+        },
+        std::min(getSpinBudget(), timeToWait));
 }
 
-ConditionListener::NotificationVector_t ConditionListener::waitImpl(const cxx::function_ref<bool()>& waitCall) noexcept
+ConditionListener::NotificationVector_t ConditionListener::waitImpl(const cxx::function_ref<bool()>& waitCall,
+                                                                    const units::Duration pollTime) noexcept
 {
-    using Type_t = iox::cxx::BestFittingType_t<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
     NotificationVector_t activeNotifications;
 
     resetSemaphore();
+    // notifications which are set after the drain signal the socket again since they were not pending
+    if (m_notificationSocket.has_value())
+    {
+        m_notificationSocket->drain();
+    }
     bool doReturnAfterNotificationCollection = false;
+    bool doPoll = (pollTime != units::Duration::zero());
     while (!m_toBeDestroyed.load(std::memory_order_relaxed))
     {
-        for (Type_t i = 0U; i < MAX_NUMBER_OF_NOTIFIERS; i++)
+        collectActiveNotifications(activeNotifications);
+        if (!activeNotifications.empty() || doReturnAfterNotificationCollection)
+        {
+            return activeNotifications;
+        }
+
+        if (doPoll)
         {
-            if (getMembers()->m_activeNotifications[i].load(std::memory_order_relaxed))
+            doPoll = false;
+            if (pollForNotifications(pollTime))
             {
-                resetUnchecked(i);
-                activeNotifications.emplace_back(i);
+                continue;
             }
         }
-        if (!activeNotifications.empty() || doReturnAfterNotificationCollection)
+
+        // a notifier skips the semaphore post when its notification is still pending and we are not sleeping,
+        // therefore we have to look once more for pending notifications after announcing that we go to sleep
+        getMembers()->m_isListenerSleeping.store(true, std::memory_order_seq_cst);
+        if (!hasPendingNotifications())
         {
-            return activeNotifications;
+            doReturnAfterNotificationCollection = !waitCall();
         }
-
-        doReturnAfterNotificationCollection = !waitCall();
+        getMembers()->m_isListenerSleeping.store(false, std::memory_order_relaxed);
     }
 
     return activeNotifications;
 }
 
-void ConditionListener::resetUnchecked(const uint64_t index) noexcept
+bool ConditionListener::pollForNotifications(const units::Duration pollTime) const noexcept
 {
-    getMembers()->m_activeNotifications[index].store(false, std::memory_order_relaxed);
-    getMembers()->m_wasNotified.store(false, std::memory_order_relaxed);
+    // with a poll time of Duration::max() the deadline saturates and never expires
+    cxx::DeadlineTimer deadline(pollTime);
+    do
+    {
+        if (hasPendingNotifications())
+        {
+            return true;
+        }
+        cpuRelax();
+    } while (!m_toBeDestroyed.load(std::memory_order_relaxed) && !deadline.hasExpired());
+
+    return false;
+}
+
+void ConditionListener::collectActiveNotifications(NotificationVector_t& activeNotifications) noexcept
+{
+    using Type_t = iox::cxx::BestFittingType_t<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
+
+    for (uint64_t wordIndex = 0U; wordIndex < ConditionVariableData::NUMBER_OF_NOTIFICATION_WORDS; ++wordIndex)
+    {
+        auto& word = getMembers()->m_activeNotifications[wordIndex];
+        // the load avoids the read-modify-write on words without active notifications
+        if (word.load(std::memory_order_relaxed) == 0U)
+        {
+            continue;
+        }
+
+        getMembers()->m_wasNotified.store(false, std::memory_order_relaxed);
+        for (uint64_t bits = word.exchange(0U, std::memory_order_acquire); bits != 0U; bits &= bits - 1U)
+        {
+            activeNotifications.emplace_back(static_cast<Type_t>(
+                wordIndex * ConditionVariableData::NOTIFICATION_WORD_SIZE + countTrailingZeros(bits)));
+        }
+    }
+}
+
+bool ConditionListener::hasPendingNotifications() const noexcept
+{
+    for (const auto& word : getMembers()->m_activeNotifications)
+    {
+        if (word.load(std::memory_order_seq_cst) != 0U)
+        {
+            return true;
+        }
+    }
+    return false;
 }
 
 const ConditionVariableData* ConditionListener::getMembers() const noexcept
@@ -17,6 +17,7 @@
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/notification_socket.hpp"
 
 namespace iox
 {
@@ -36,8 +37,32 @@ ConditionNotifier::ConditionNotifier(ConditionVariableData& condVarDataRef, cons
 
 void ConditionNotifier::notify() noexcept
 {
-    getMembers()->m_activeNotifications[m_notificationIndex].store(true, std::memory_order_release);
+    const uint64_t notificationBitMask = ConditionVariableData::notificationBitMask(m_notificationIndex);
+    const bool wasAlreadyPending =
+        (getMembers()
+             ->m_activeNotifications[ConditionVariableData::notificationWordIndex(m_notificationIndex)]
+             .fetch_or(notificationBitMask, std::memory_order_seq_cst)
+         & notificationBitMask)
+        != 0U;
     getMembers()->m_wasNotified.store(true, std::memory_order_relaxed);
+
+    // a pending notification was already signaled and the file descriptor stays readable until the listener
+    // collects it
+    if (!wasAlreadyPending)
+    {
+        const uint64_t notificationSocketId = getMembers()->m_notificationSocketId.load(std::memory_order_seq_cst);
+        if (notificationSocketId != NotificationSocket::INVALID_ID)
+        {
+            NotificationSocket::signal(notificationSocketId);
+        }
+    }
+
+    // coalesce with the pending notification, the listener is awake and collects it before it sleeps again
+    if (wasAlreadyPending && !getMembers()->m_isListenerSleeping.load(std::memory_order_seq_cst))
+    {
+        return;
+    }
+
     getMembers()->m_semaphore->post().or_else(
         [](auto) { errorHandler(PoshError::POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY, ErrorLevel::FATAL); });
 }
@@ -17,10 +17,55 @@
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 
+#include <cstddef>
+
 namespace iox
 {
 namespace popo
 {
+namespace
+{
+// only the overload for ConditionVariableData::Semaphore_t is used, inline prevents unused function warnings
+inline cxx::expected<posix::SemaphoreError> createSemaphore(cxx::optional<posix::UnnamedSemaphore>& semaphore) noexcept
+{
+    return posix::UnnamedSemaphoreBuilder().initialValue(0U).isInterProcessCapable(true).create(semaphore);
+}
+
+inline cxx::expected<posix::SemaphoreError>
+createSemaphore(cxx::optional<concurrent::FutexSemaphore>& semaphore) noexcept
+{
+    return concurrent::FutexSemaphoreBuilder().initialValue(0U).create(semaphore);
+}
+
+// the posix semaphore does not expose its waiters, the kernel takes care of them
+inline void resetSemaphoreWaiters(posix::UnnamedSemaphore&) noexcept
+{
+}
+
+inline void resetSemaphoreWaiters(concurrent::FutexSemaphore& semaphore) noexcept
+{
+    semaphore.resetWaiters();
+}
+} // namespace
+
+static_assert(std::is_standard_layout<ConditionVariableData>::value,
+              "the cache line separation of ConditionVariableData can only be checked with a standard layout");
+static_assert(concurrent::isSeparatedByCacheLine(offsetof(ConditionVariableData, m_isListenerSleeping)
+                                                     + sizeof(ConditionVariableData::m_isListenerSleeping),
+                                                 offsetof(ConditionVariableData, m_runtimeName)),
+              "the members written by a sleeping listener must not share a cache line with the setup members");
+static_assert(concurrent::isSeparatedByCacheLine(offsetof(ConditionVariableData, m_notificationSocketId)
+                                                     + sizeof(ConditionVariableData::m_notificationSocketId),
+                                                 offsetof(ConditionVariableData, m_activeNotifications)),
+              "the setup members must not share a cache line with the notifications");
+static_assert(concurrent::isSeparatedByCacheLine(offsetof(ConditionVariableData, m_wasNotified)
+                                                     + sizeof(ConditionVariableData::m_wasNotified),
+                                                 sizeof(ConditionVariableData)),
+              "the notifications must not share a cache line with the data behind the ConditionVariableData");
+
+constexpr uint64_t ConditionVariableData::NOTIFICATION_WORD_SIZE;
+constexpr uint64_t ConditionVariableData::NUMBER_OF_NOTIFICATION_WORDS;
+
 ConditionVariableData::ConditionVariableData() noexcept
     : ConditionVariableData("")
 {
@@ -29,14 +74,19 @@ ConditionVariableData::ConditionVariableData() noexcept
 ConditionVariableData::ConditionVariableData(const RuntimeName_t& runtimeName) noexcept
     : m_runtimeName(runtimeName)
 {
-    posix::UnnamedSemaphoreBuilder().initialValue(0U).isInterProcessCapable(true).create(m_semaphore).or_else([](auto) {
+    createSemaphore(m_semaphore).or_else([](auto) {
         errorHandler(PoshError::POPO__CONDITION_VARIABLE_DATA_FAILED_TO_CREATE_SEMAPHORE, ErrorLevel::FATAL);
     });
 
-    for (auto& id : m_activeNotifications)
+    for (auto& word : m_activeNotifications)
     {
-        id.store(false, std::memory_order_relaxed);
+        word.store(0U, std::memory_order_relaxed);
     }
 }
+
+void ConditionVariableData::resetWaiters() noexcept
+{
+    resetSemaphoreWaiters(*m_semaphore);
+}
 } // namespace popo
 } // namespace iox
@@ -0,0 +1,152 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/delivery_thread_pool.hpp"
+#include "iceoryx_posh/error_handling/error_handling.hpp"
+
+#include <algorithm>
+
+namespace iox
+{
+namespace popo
+{
+constexpr uint64_t DeliveryThreadPool::TASK_BLOCK_SIZE;
+constexpr uint64_t DeliveryThreadPool::RUN_CLOSED;
+
+DeliveryThreadPool::DeliveryThreadPool(const uint64_t numberOfThreads) noexcept
+    : m_numberOfThreads(std::min(numberOfThreads, static_cast<uint64_t>(MAX_NUMBER_OF_DELIVERY_THREADS)))
+{
+    posix::UnnamedSemaphoreBuilder().initialValue(0U).isInterProcessCapable(false).create(m_wakeUp).or_else([](auto) {
+        errorHandler(PoshError::POPO__DELIVERY_THREAD_POOL_FAILED_TO_CREATE_SEMAPHORE, ErrorLevel::FATAL);
+    });
+
+    for (uint64_t i = 0U; i < m_numberOfThreads; ++i)
+    {
+        m_threads[i] = std::thread(&DeliveryThreadPool::threadLoop, this);
+    }
+}
+
+DeliveryThreadPool::~DeliveryThreadPool() noexcept
+{
+    m_keepRunning.store(false, std::memory_order_relaxed);
+    for (uint64_t i = 0U; i < m_numberOfThreads; ++i)
+    {
+        if (m_wakeUp->post().has_error())
+        {
+            errorHandler(PoshError::POPO__DELIVERY_THREAD_POOL_SEMAPHORE_CORRUPTED, ErrorLevel::FATAL);
+        }
+    }
+
+    for (uint64_t i = 0U; i < m_numberOfThreads; ++i)
+    {
+        m_threads[i].join();
+    }
+}
+
+DeliveryThreadPool& DeliveryThreadPool::instance() noexcept
+{
+    // the publishing thread takes part in the delivery, therefore one core is left for it
+    static DeliveryThreadPool pool(std::max<uint64_t>(std::thread::hardware_concurrency(), 1U) - 1U);
+    return pool;
+}
+
+void DeliveryThreadPool::run(const uint64_t numberOfTasks, const Task_t& task) noexcept
+{
+    std::unique_lock<std::mutex> lock(m_runMutex, std::try_to_lock);
+    if (!lock.owns_lock() || m_numberOfThreads == 0U || numberOfTasks <= TASK_BLOCK_SIZE)
+    {
+        for (uint64_t i = 0U; i < numberOfTasks; ++i)
+        {
+            task(i);
+        }
+        return;
+    }
+
+    m_task = &task;
+    m_numberOfTasks = numberOfTasks;
+    m_nextTask.store(0U, std::memory_order_relaxed);
+    // threads which have seen the closed run of the previous call are still counted and leave on their own
+    m_participants.fetch_and(~RUN_CLOSED, std::memory_order_release);
+
+    const uint64_t numberOfBlocks = (numberOfTasks + TASK_BLOCK_SIZE - 1U) / TASK_BLOCK_SIZE;
+    const uint64_t numberOfThreadsToWakeUp = std::min(m_numberOfThreads, numberOfBlocks - 1U);
+    for (uint64_t i = 0U; i < numberOfThreadsToWakeUp; ++i)
+    {
+        if (m_wakeUp->post().has_error())
+        {
+            errorHandler(PoshError::POPO__DELIVERY_THREAD_POOL_SEMAPHORE_CORRUPTED, ErrorLevel::FATAL);
+        }
+    }
+
+    executeTasks();
+
+    // the task is only valid during this call, therefore we wait until every participating thread is finished
+    m_participants.fetch_or(RUN_CLOSED, std::memory_order_acq_rel);
+    while (m_participants.load(std::memory_order_acquire) != RUN_CLOSED)
+    {
+        std::this_thread::yield();
+    }
+    m_task = nullptr;
+}
+
+uint64_t DeliveryThreadPool::numberOfThreads() const noexcept
+{
+    return m_numberOfThreads;
+}
+
+void DeliveryThreadPool::threadLoop() noexcept
+{
+    while (true)
+    {
+        if (m_wakeUp->wait().has_error())
+        {
+            errorHandler(PoshError::POPO__DELIVERY_THREAD_POOL_SEMAPHORE_CORRUPTED, ErrorLevel::FATAL);
+            return;
+        }
+
+        if (!m_keepRunning.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        // a thread which wakes up after the run was finished must not touch the task anymore
+        if ((m_participants.fetch_add(1U, std::memory_order_acq_rel) & RUN_CLOSED) == 0U)
+        {
+            executeTasks();
+        }
+        m_participants.fetch_sub(1U, std::memory_order_release);
+    }
+}
+
+void DeliveryThreadPool::executeTasks() noexcept
+{
+    while (true)
+    {
+        const uint64_t firstTask = m_nextTask.fetch_add(TASK_BLOCK_SIZE, std::memory_order_relaxed);
+        if (firstTask >= m_numberOfTasks)
+        {
+            return;
+        }
+
+        const uint64_t lastTask = std::min(firstTask + TASK_BLOCK_SIZE, m_numberOfTasks);
+        for (uint64_t i = firstTask; i < lastTask; ++i)
+        {
+            (*m_task)(i);
+        }
+    }
+}
+} // namespace popo
+} // namespace iox
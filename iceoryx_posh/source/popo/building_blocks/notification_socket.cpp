@@ -0,0 +1,234 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/notification_socket.hpp"
+#include "iceoryx_hoofs/cxx/scope_guard.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
+#include "iceoryx_platform/platform_settings.hpp"
+#include "iceoryx_platform/socket.hpp"
+#include "iceoryx_platform/stat.hpp"
+#include "iceoryx_platform/un.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+
+namespace iox
+{
+namespace popo
+{
+namespace
+{
+constexpr int32_t ERROR_CODE{-1};
+constexpr uint64_t PID_SHIFT{32U};
+constexpr uint64_t COUNTER_MASK{(1ULL << PID_SHIFT) - 1U};
+
+/// @brief the socket path is derived from the id, this way every process can signal a socket by only knowing its id
+bool createSocketAddress(const NotificationSocket::Id_t id, sockaddr_un& address) noexcept
+{
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_LOCAL;
+    auto length = snprintf(&address.sun_path[0],
+                           sizeof(address.sun_path),
+                           "%siox_notification_%llu_%llu",
+                           platform::IOX_UDS_SOCKET_PATH_PREFIX,
+                           static_cast<unsigned long long>(id >> PID_SHIFT),
+                           static_cast<unsigned long long>(id & COUNTER_MASK));
+    return length > 0 && static_cast<uint64_t>(length) < sizeof(address.sun_path);
+}
+
+/// @brief neither the sender nor the receiver must ever block, a non-blocking socket works on every platform while
+///        MSG_DONTWAIT is not available everywhere
+cxx::expected<int32_t, NotificationSocketError> createNonBlockingSocket() noexcept
+{
+    auto socketCall = posix::posixCall(iox_socket)(AF_LOCAL, SOCK_DGRAM, 0).failureReturnValue(ERROR_CODE).evaluate();
+    if (socketCall.has_error())
+    {
+        return cxx::error<NotificationSocketError>(NotificationSocketError::UNABLE_TO_CREATE_SOCKET);
+    }
+    const int32_t fileDescriptor = socketCall->value;
+
+    auto nonBlockingCall =
+        posix::posixCall(iox_setsocketnonblocking)(fileDescriptor).failureReturnValue(ERROR_CODE).evaluate();
+    if (nonBlockingCall.has_error())
+    {
+        iox_closesocket(fileDescriptor);
+        return cxx::error<NotificationSocketError>(NotificationSocketError::UNABLE_TO_CREATE_SOCKET);
+    }
+
+    return cxx::success<int32_t>(fileDescriptor);
+}
+} // namespace
+
+constexpr NotificationSocket::Id_t NotificationSocket::INVALID_ID;
+
+NotificationSocket::NotificationSocket(const int32_t fileDescriptor, const Id_t id) noexcept
+    : m_fileDescriptor(fileDescriptor)
+    , m_id(id)
+{
+}
+
+NotificationSocket::~NotificationSocket() noexcept
+{
+    posix::posixCall(iox_closesocket)(m_fileDescriptor).failureReturnValue(ERROR_CODE).evaluate().or_else([](auto&) {
+        LogError() << "Unable to close the file descriptor of the notification socket.";
+    });
+
+    sockaddr_un address;
+    if (createSocketAddress(m_id, address))
+    {
+        posix::posixCall(unlink)(&address.sun_path[0])
+            .failureReturnValue(ERROR_CODE)
+            .ignoreErrnos(ENOENT)
+            .evaluate()
+            .or_else([](auto&) { LogError() << "Unable to remove the path of the notification socket."; });
+    }
+}
+
+int32_t NotificationSocket::getFileDescriptor() const noexcept
+{
+    return m_fileDescriptor;
+}
+
+NotificationSocket::Id_t NotificationSocket::getId() const noexcept
+{
+    return m_id;
+}
+
+void NotificationSocket::drain() noexcept
+{
+    // the content is irrelevant, a single byte buffer is sufficient since the rest of a datagram is discarded
+    char buffer{0};
+    while (true)
+    {
+        auto recvCall = posix::posixCall(iox_recvfrom)(m_fileDescriptor, &buffer, 1U, 0, nullptr, nullptr)
+                            .failureReturnValue(ERROR_CODE)
+                            .ignoreErrnos(EAGAIN, EWOULDBLOCK, EINTR)
+                            .evaluate();
+        if (recvCall.has_error() || recvCall->value <= 0)
+        {
+            return;
+        }
+    }
+}
+
+void NotificationSocket::signal(const Id_t id) noexcept
+{
+    NotificationSender::instance().signal(id);
+}
+
+NotificationSender::NotificationSender() noexcept
+{
+    createNonBlockingSocket()
+        .and_then([this](auto fileDescriptor) { m_fileDescriptor = fileDescriptor; })
+        .or_else([](auto) { LogError() << "Unable to create the socket to send notifications to file descriptors."; });
+}
+
+NotificationSender::~NotificationSender() noexcept
+{
+    if (m_fileDescriptor == ERROR_CODE)
+    {
+        return;
+    }
+
+    posix::posixCall(iox_closesocket)(m_fileDescriptor).failureReturnValue(ERROR_CODE).evaluate().or_else([](auto&) {
+        LogError() << "Unable to close the socket to send notifications to file descriptors.";
+    });
+    m_fileDescriptor = ERROR_CODE;
+}
+
+NotificationSender& NotificationSender::instance() noexcept
+{
+    static NotificationSender sender;
+    return sender;
+}
+
+void NotificationSender::signal(const NotificationSocket::Id_t id) noexcept
+{
+    sockaddr_un address;
+    if (m_fileDescriptor == ERROR_CODE || id == NotificationSocket::INVALID_ID || !createSocketAddress(id, address))
+    {
+        return;
+    }
+
+    // a full socket buffer means the file descriptor is already readable and a socket which does not exist anymore
+    // has no one to notify, both cases can be ignored
+    char signalByte{1};
+    posix::posixCall(iox_sendto)(m_fileDescriptor,
+                                 &signalByte,
+                                 sizeof(signalByte),
+                                 0,
+                                 // NOLINTJUSTIFICATION enforced by POSIX API
+                                 // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                                 reinterpret_cast<struct sockaddr*>(&address),
+                                 sizeof(address))
+        .failureReturnValue(ERROR_CODE)
+        .ignoreErrnos(EAGAIN, EWOULDBLOCK, ECONNREFUSED, ENOENT)
+        .evaluate()
+        .or_else([](auto&) { LogError() << "Unable to signal the notification socket."; });
+}
+
+cxx::expected<NotificationSocketError>
+NotificationSocketBuilder::create(cxx::optional<NotificationSocket>& socket) const noexcept
+{
+    static std::atomic<uint64_t> socketCounter{1U};
+    const NotificationSocket::Id_t id = (static_cast<uint64_t>(getpid()) << PID_SHIFT)
+                                        | (socketCounter.fetch_add(1U, std::memory_order_relaxed) & COUNTER_MASK);
+
+    sockaddr_un address;
+    if (!createSocketAddress(id, address))
+    {
+        LogError() << "The path of the notification socket exceeds the maximum socket path length.";
+        return cxx::error<NotificationSocketError>(NotificationSocketError::UNABLE_TO_BIND_SOCKET);
+    }
+
+    // only the user and the group members are allowed to signal the socket
+    // NOLINTJUSTIFICATION type is defined by POSIX, no logical fault
+    // NOLINTNEXTLINE(hicpp-signed-bitwise)
+    mode_t umaskSaved = umask(S_IXUSR | S_IXGRP | S_IRWXO);
+    cxx::ScopeGuard umaskGuard([&] { umask(umaskSaved); });
+
+    auto socketCall = createNonBlockingSocket();
+    if (socketCall.has_error())
+    {
+        LogError() << "Unable to create the notification socket.";
+        return cxx::error<NotificationSocketError>(socketCall.get_error());
+    }
+    const int32_t fileDescriptor = socketCall.value();
+
+    // a leftover of a crashed process with the same pid would prevent the bind
+    unlink(&address.sun_path[0]);
+
+    auto bindCall =
+        // NOLINTJUSTIFICATION enforced by POSIX API
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        posix::posixCall(iox_bind)(fileDescriptor, reinterpret_cast<struct sockaddr*>(&address), sizeof(address))
+            .failureReturnValue(ERROR_CODE)
+            .evaluate();
+    if (bindCall.has_error())
+    {
+        LogError() << "Unable to bind the notification socket to \"" << &address.sun_path[0] << "\".";
+        iox_closesocket(fileDescriptor);
+        return cxx::error<NotificationSocketError>(NotificationSocketError::UNABLE_TO_BIND_SOCKET);
+    }
+
+    socket.emplace(fileDescriptor, id);
+    return cxx::success<>();
+}
+} // namespace popo
+} // namespace iox
@@ -150,14 +150,20 @@ ClientPortRouDi::handleCaProMessageForStateConnectRequested(const capro::CaproMe
     switch (caProMessage.m_type)
     {
     case capro::CaproMessageType::ACK:
+    {
         cxx::Expects(caProMessage.m_chunkQueueData != nullptr && "Invalid request queue passed to client");
-        cxx::Expects(!m_chunkSender
-                          .tryAddQueue(static_cast<ServerChunkQueueData_t*>(caProMessage.m_chunkQueueData),
-                                       caProMessage.m_historyCapacity)
-                          .has_error());
+        const auto result = m_chunkSender.tryAddQueue(
+            static_cast<ServerChunkQueueData_t*>(caProMessage.m_chunkQueueData), caProMessage.m_historyCapacity);
+        cxx::Expects(!result.has_error() || result.get_error() == ChunkDistributorError::SENDER_STILL_REGISTERED);
+        if (result.has_error())
+        {
+            // the client process died while sending a request and is cleaned up soon, it would not send anymore
+            LogWarn() << "The client is still registered as sender, its requests are not delivered to the server!";
+        }
 
         getMembers()->m_connectionState.store(ConnectionState::CONNECTED, std::memory_order_relaxed);
         return cxx::nullopt;
+    }
     case capro::CaproMessageType::NACK:
         getMembers()->m_connectionState.store(ConnectionState::WAIT_FOR_OFFER, std::memory_order_relaxed);
         return cxx::nullopt;
@@ -205,12 +211,14 @@ ClientPortRouDi::handleCaProMessageForStateConnected(const capro::CaproMessage&
     {
     case capro::CaproMessageType::STOP_OFFER:
         getMembers()->m_connectionState.store(ConnectionState::WAIT_FOR_OFFER, std::memory_order_relaxed);
-        m_chunkSender.removeAllQueues();
+        // a removal which is postponed since the client process is still registered as sender is finished with the
+        // next change of the queues or by tryReleaseQueue before the server is destroyed
+        IOX_DISCARD_RESULT(m_chunkSender.removeAllQueues());
         return cxx::nullopt;
     case capro::CaproMessageType::DISCONNECT:
     {
         getMembers()->m_connectionState.store(ConnectionState::DISCONNECT_REQUESTED, std::memory_order_relaxed);
-        m_chunkSender.removeAllQueues();
+        IOX_DISCARD_RESULT(m_chunkSender.removeAllQueues());
 
         capro::CaproMessage caproMessage(capro::CaproMessageType::DISCONNECT,
                                          BasePort::getMembers()->m_serviceDescription);
@@ -246,6 +254,17 @@ ClientPortRouDi::handleCaProMessageForStateDisconnectRequested(const capro::Capr
     return cxx::nullopt;
 }
 
+void ClientPortRouDi::releaseSenderRegistrations() noexcept
+{
+    m_chunkSender.releaseSenderRegistrations();
+}
+
+bool ClientPortRouDi::tryReleaseQueue(ServerChunkQueueData_t* const queue) noexcept
+{
+    const auto result = m_chunkSender.tryRemoveQueue(queue);
+    return !result.has_error() || result.get_error() == ChunkDistributorError::QUEUE_NOT_IN_CONTAINER;
+}
+
 void ClientPortRouDi::releaseAllChunks() noexcept
 {
     m_chunkSender.releaseAll();
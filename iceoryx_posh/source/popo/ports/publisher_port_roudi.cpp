@@ -63,11 +63,14 @@ cxx::optional<capro::CaproMessage> PublisherPortRouDi::tryGetCaProMessage() noex
     }
     else if ((!offeringRequested) && isOffered)
     {
+        // remove all the subscribers (represented by their chunk queues), while the publishing process is still
+        // registered as sender the subscribers could be accessed and the stop offer is retried with the next call
+        if (m_chunkSender.removeAllQueues().has_error())
+        {
+            return cxx::nullopt_t();
+        }
         getMembers()->m_offered.store(false, std::memory_order_relaxed);
 
-        // remove all the subscribers (represented by their chunk queues)
-        m_chunkSender.removeAllQueues();
-
         capro::CaproMessage caproMessage(capro::CaproMessageType::STOP_OFFER, this->getCaProServiceDescription());
         caproMessage.m_serviceType = capro::CaproServiceType::PUBLISHER;
 
@@ -116,6 +119,17 @@ PublisherPortRouDi::dispatchCaProMessageAndGetPossibleResponse(const capro::Capr
     return cxx::make_optional<capro::CaproMessage>(responseMessage);
 }
 
+void PublisherPortRouDi::releaseSenderRegistrations() noexcept
+{
+    m_chunkSender.releaseSenderRegistrations();
+}
+
+bool PublisherPortRouDi::tryReleaseQueue(PublisherPortData::ChunkQueueData_t* const queue) noexcept
+{
+    const auto result = m_chunkSender.tryRemoveQueue(queue);
+    return !result.has_error() || result.get_error() == ChunkDistributorError::QUEUE_NOT_IN_CONTAINER;
+}
+
 void PublisherPortRouDi::releaseAllChunks() noexcept
 {
     m_chunkSender.releaseAll();
@@ -71,6 +71,24 @@ void PublisherPortUser::sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcep
     }
 }
 
+void PublisherPortUser::sendChunks(const ChunkHeaderBatch_t& chunkHeaders) noexcept
+{
+    const auto offerRequested = getMembers()->m_offeringRequested.load(std::memory_order_relaxed);
+
+    if (offerRequested)
+    {
+        m_chunkSender.sendMany(chunkHeaders);
+    }
+    else
+    {
+        // see sendChunk why the chunks are only put in the history when the port is not offered
+        for (auto chunkHeader : chunkHeaders)
+        {
+            m_chunkSender.pushToHistory(chunkHeader);
+        }
+    }
+}
+
 cxx::optional<const mepoo::ChunkHeader*> PublisherPortUser::tryGetPreviousChunk() const noexcept
 {
     return m_chunkSender.tryGetPreviousChunk();
@@ -104,8 +104,12 @@ ServerPortRouDi::handleCaProMessageForStateOffered(const capro::CaproMessage& ca
     switch (caProMessage.m_type)
     {
     case capro::CaproMessageType::STOP_OFFER:
+        // while the server process is still registered as sender the stop offer is retried with the next call
+        if (m_chunkSender.removeAllQueues().has_error())
+        {
+            return cxx::nullopt;
+        }
         getMembers()->m_offered.store(false, std::memory_order_relaxed);
-        m_chunkSender.removeAllQueues();
         return caProMessage;
     case capro::CaproMessageType::OFFER:
         return responseMessage;
@@ -163,6 +167,17 @@ ServerPortRouDi::handleCaProMessageForStateNotOffered(const capro::CaproMessage&
     return cxx::nullopt;
 }
 
+void ServerPortRouDi::releaseSenderRegistrations() noexcept
+{
+    m_chunkSender.releaseSenderRegistrations();
+}
+
+bool ServerPortRouDi::tryReleaseQueue(ClientChunkQueueData_t* const queue) noexcept
+{
+    const auto result = m_chunkSender.tryRemoveQueue(queue);
+    return !result.has_error() || result.get_error() == ChunkDistributorError::QUEUE_NOT_IN_CONTAINER;
+}
+
 void ServerPortRouDi::releaseAllChunks() noexcept
 {
     m_chunkSender.releaseAll();
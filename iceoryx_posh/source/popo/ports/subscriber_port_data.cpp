@@ -28,11 +28,17 @@ SubscriberPortData::SubscriberPortData(const capro::ServiceDescription& serviceD
                                        const SubscriberOptions& subscriberOptions,
                                        const mepoo::MemoryInfo& memoryInfo) noexcept
     : BasePortData(serviceDescription, runtimeName, subscriberOptions.nodeName)
-    , m_chunkReceiverData(queueType, subscriberOptions.queueFullPolicy, memoryInfo)
+    , m_chunkReceiverData(queueType, subscriberOptions.queueFullPolicy, memoryInfo, subscriberOptions.latestSampleOnly)
     , m_options{subscriberOptions}
     , m_subscribeRequested(subscriberOptions.subscribeOnCreate)
 {
     m_chunkReceiverData.m_queue.setCapacity(subscriberOptions.queueCapacity);
+    m_chunkReceiverData.m_decimation = subscriberOptions.decimation;
+    if (subscriberOptions.maxSampleRate != 0U)
+    {
+        m_chunkReceiverData.m_minimumPushIntervalNs =
+            units::Duration::fromSeconds(1U).toNanoseconds() / subscriberOptions.maxSampleRate;
+    }
 }
 
 } // namespace popo
@@ -69,6 +69,12 @@ cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> SubscriberPortUser:
     return m_chunkReceiver.tryGet();
 }
 
+cxx::expected<ChunkReceiveResult> SubscriberPortUser::tryGetChunks(ChunkHeaderBatch_t& chunkHeaders,
+                                                                   const uint64_t maxNumberOfChunks) noexcept
+{
+    return m_chunkReceiver.tryGetMany(chunkHeaders, maxNumberOfChunks);
+}
+
 void SubscriberPortUser::releaseChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
     m_chunkReceiver.release(chunkHeader);
@@ -28,7 +28,10 @@ cxx::Serialization SubscriberOptions::serialize() const noexcept
                                       nodeName,
                                       subscribeOnCreate,
                                       static_cast<std::underlying_type_t<QueueFullPolicy>>(queueFullPolicy),
-                                      requiresPublisherHistorySupport);
+                                      requiresPublisherHistorySupport,
+                                      latestSampleOnly,
+                                      decimation,
+                                      maxSampleRate);
 }
 
 cxx::expected<SubscriberOptions, cxx::Serialization::Error>
@@ -44,7 +47,10 @@ SubscriberOptions::deserialize(const cxx::Serialization& serialized) noexcept
                                                         subscriberOptions.nodeName,
                                                         subscriberOptions.subscribeOnCreate,
                                                         queueFullPolicy,
-                                                        subscriberOptions.requiresPublisherHistorySupport);
+                                                        subscriberOptions.requiresPublisherHistorySupport,
+                                                        subscriberOptions.latestSampleOnly,
+                                                        subscriberOptions.decimation,
+                                                        subscriberOptions.maxSampleRate);
 
     if (!deserializationSuccessful
         || queueFullPolicy > static_cast<QueueFullPolicyUT>(QueueFullPolicy::DISCARD_OLDEST_DATA))
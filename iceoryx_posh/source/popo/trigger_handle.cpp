@@ -96,7 +96,11 @@ bool TriggerHandle::wasTriggered() const noexcept
     std::lock_guard<std::recursive_mutex> lock(m_mutex);
     if (m_conditionVariableDataPtr != nullptr)
     {
-        return m_conditionVariableDataPtr->m_activeNotifications[m_uniqueTriggerId].load(std::memory_order_relaxed);
+        return (m_conditionVariableDataPtr
+                    ->m_activeNotifications[ConditionVariableData::notificationWordIndex(m_uniqueTriggerId)]
+                    .load(std::memory_order_relaxed)
+                & ConditionVariableData::notificationBitMask(m_uniqueTriggerId))
+               != 0U;
     }
     return false;
 }
@@ -20,14 +20,27 @@
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 
+#include <algorithm>
+
 namespace iox
 {
 namespace roudi
 {
+/// @brief the management memory of all segments shares one shared memory, it is locked when any segment is locked
+static bool isAnySegmentLockedInMemory(const RouDiConfig_t& roudiConfig) noexcept
+{
+    return std::any_of(roudiConfig.m_sharedMemorySegments.begin(),
+                       roudiConfig.m_sharedMemorySegments.end(),
+                       [](const auto& segment) { return segment.m_mempoolConfig.m_lockInMemory; });
+}
+
 DefaultRouDiMemory::DefaultRouDiMemory(const RouDiConfig_t& roudiConfig) noexcept
     : m_introspectionMemPoolBlock(introspectionMemPoolConfig())
     , m_segmentManagerBlock(roudiConfig)
-    , m_managementShm(SHM_NAME, posix::AccessMode::READ_WRITE, posix::OpenMode::PURGE_AND_CREATE)
+    , m_managementShm(SHM_NAME,
+                      posix::AccessMode::READ_WRITE,
+                      posix::OpenMode::PURGE_AND_CREATE,
+                      isAnySegmentLockedInMemory(roudiConfig))
 {
     m_managementShm.addMemoryBlock(&m_introspectionMemPoolBlock).or_else([](auto) {
         errorHandler(PoshError::ROUDI__DEFAULT_ROUDI_MEMORY_FAILED_TO_ADD_INTROSPECTION_MEMORY_BLOCK,
@@ -58,6 +71,12 @@ mepoo::MePooConfig DefaultRouDiMemory::introspectionMemPoolConfig() const noexce
     mempoolConfig.m_mempoolConfig.push_back(
         {cxx::align(static_cast<uint32_t>(sizeof(roudi::SubscriberPortChangingIntrospectionFieldTopic)), ALIGNMENT),
          CHUNK_COUNT});
+    // the allocation sizes are large and only sent while subscribed; one chunk in the history, one in the queue and
+    // one held by the subscriber while the next one is written
+    constexpr uint32_t ALLOCATION_SIZE_CHUNK_COUNT{4U};
+    mempoolConfig.m_mempoolConfig.push_back(
+        {cxx::align(static_cast<uint32_t>(sizeof(roudi::MemPoolAllocationSizeIntrospectionInfoContainer)), ALIGNMENT),
+         ALLOCATION_SIZE_CHUNK_COUNT});
 
     mempoolConfig.optimize();
     return mempoolConfig;
@@ -182,6 +182,8 @@ const char* MemoryProvider::getErrorString(const MemoryProviderError error) noex
         return "MEMORY_ALLOCATION_FAILED";
     case MemoryProviderError::MEMORY_MAPPING_FAILED:
         return "MEMORY_MAPPING_FAILED";
+    case MemoryProviderError::MEMORY_LOCKING_FAILED:
+        return "MEMORY_LOCKING_FAILED";
     case MemoryProviderError::MEMORY_NOT_AVAILABLE:
         return "MEMORY_NOT_AVAILABLE";
     case MemoryProviderError::MEMORY_DESTRUCTION_FAILED:
@@ -32,10 +32,12 @@ constexpr cxx::perms PosixShmMemoryProvider::SHM_MEMORY_PERMISSIONS;
 
 PosixShmMemoryProvider::PosixShmMemoryProvider(const ShmName_t& shmName,
                                                const posix::AccessMode accessMode,
-                                               const posix::OpenMode openMode) noexcept
+                                               const posix::OpenMode openMode,
+                                               const bool lockInMemory) noexcept
     : m_shmName(shmName)
     , m_accessMode(accessMode)
     , m_openMode(openMode)
+    , m_lockInMemory(lockInMemory)
 {
 }
 
@@ -76,6 +78,11 @@ cxx::expected<void*, MemoryProviderError> PosixShmMemoryProvider::createMemory(c
         return cxx::error<MemoryProviderError>(MemoryProviderError::MEMORY_CREATION_FAILED);
     }
 
+    if (m_lockInMemory && m_shmObject->lockInMemory().has_error())
+    {
+        return cxx::error<MemoryProviderError>(MemoryProviderError::MEMORY_LOCKING_FAILED);
+    }
+
     return cxx::success<void*>(baseAddress);
 }
 
@@ -219,6 +219,8 @@ void PortManager::destroyClientPort(popo::ClientPortData* const clientPortData)
     popo::ClientPortRouDi clientPortRoudi(*clientPortData);
     popo::ClientPortUser clientPortUser(*clientPortData);
 
+    // a sender which died while delivering would block the removal of the queues
+    clientPortRoudi.releaseSenderRegistrations();
     clientPortUser.disconnect();
 
     // process DISCONNECT for this client in RouDi and distribute it
@@ -229,6 +231,13 @@ void PortManager::destroyClientPort(popo::ClientPortData* const clientPortData)
         this->sendToAllMatchingServerPorts(caproMessage, clientPortRoudi);
     });
 
+    // the client port is destroyed with one of the next discovery runs when a server still accesses its queue
+    if (!tryReleaseQueueAtAllServerPorts(clientPortData))
+    {
+        clientPortUser.destroy();
+        return;
+    }
+
     clientPortRoudi.releaseAllChunks();
 
     /// @todo iox-#1128 remove from to port introspection
@@ -305,6 +314,8 @@ void PortManager::destroyServerPort(popo::ServerPortData* const serverPortData)
     popo::ServerPortRouDi serverPortRoudi{*serverPortData};
     popo::ServerPortUser serverPortUser{*serverPortData};
 
+    // a sender which died while delivering would block the removal of the queues
+    serverPortRoudi.releaseSenderRegistrations();
     serverPortUser.stopOffer();
 
     // process STOP_OFFER for this server in RouDi and distribute it
@@ -318,6 +329,13 @@ void PortManager::destroyServerPort(popo::ServerPortData* const serverPortData)
         this->sendToAllMatchingInterfacePorts(caproMessage);
     });
 
+    // the server port is destroyed with one of the next discovery runs when a client still accesses its queue
+    if (!tryReleaseQueueAtAllClientPorts(serverPortData))
+    {
+        serverPortUser.destroy();
+        return;
+    }
+
     serverPortRoudi.releaseAllChunks();
 
     /// @todo iox-#1128 remove from port introspection
@@ -678,6 +696,58 @@ void PortManager::sendToAllMatchingInterfacePorts(const capro::CaproMessage& mes
     }
 }
 
+bool PortManager::tryReleaseQueueAtAllPublisherPorts(
+    SubscriberPortType::MemberType_t* const subscriberPortData) noexcept
+{
+    bool isQueueReleased = true;
+    for (auto publisherPortData : m_portPool->getPublisherPortDataList())
+    {
+        PublisherPortRouDiType publisherPort(publisherPortData);
+        if (!publisherPort.tryReleaseQueue(&subscriberPortData->m_chunkReceiverData))
+        {
+            LogWarn() << "Postponing the destruction of the subscriber port from runtime '"
+                      << subscriberPortData->m_runtimeName << "' since the publisher from runtime '"
+                      << publisherPort.getRuntimeName() << "' is still registered as sender!";
+            isQueueReleased = false;
+        }
+    }
+    return isQueueReleased;
+}
+
+bool PortManager::tryReleaseQueueAtAllServerPorts(popo::ClientPortData* const clientPortData) noexcept
+{
+    bool isQueueReleased = true;
+    for (auto serverPortData : m_portPool->getServerPortDataList())
+    {
+        popo::ServerPortRouDi serverPort(*serverPortData);
+        if (!serverPort.tryReleaseQueue(&clientPortData->m_chunkReceiverData))
+        {
+            LogWarn() << "Postponing the destruction of the client port from runtime '"
+                      << clientPortData->m_runtimeName << "' since the server from runtime '"
+                      << serverPort.getRuntimeName() << "' is still registered as sender!";
+            isQueueReleased = false;
+        }
+    }
+    return isQueueReleased;
+}
+
+bool PortManager::tryReleaseQueueAtAllClientPorts(popo::ServerPortData* const serverPortData) noexcept
+{
+    bool isQueueReleased = true;
+    for (auto clientPortData : m_portPool->getClientPortDataList())
+    {
+        popo::ClientPortRouDi clientPort(*clientPortData);
+        if (!clientPort.tryReleaseQueue(&serverPortData->m_chunkReceiverData))
+        {
+            LogWarn() << "Postponing the destruction of the server port from runtime '"
+                      << serverPortData->m_runtimeName << "' since the client from runtime '"
+                      << clientPort.getRuntimeName() << "' is still registered as sender!";
+            isQueueReleased = false;
+        }
+    }
+    return isQueueReleased;
+}
+
 void PortManager::unblockProcessShutdown(const RuntimeName_t& runtimeName) noexcept
 {
     for (auto port : m_portPool->getPublisherPortDataList())
@@ -725,6 +795,17 @@ void PortManager::deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcep
     {
         m_serviceRegistryPublisherPortData.reset();
     }
+
+    // the notifiers of the other processes keep on signaling the condition variables until the ports of the process
+    // are gone, a listener which died while waiting must not cost them a wake up syscall in the meantime
+    for (auto conditionVariableData : m_portPool->getConditionVariableDataList())
+    {
+        if (runtimeName == conditionVariableData->m_runtimeName)
+        {
+            conditionVariableData->resetWaiters();
+        }
+    }
+
     for (auto port : m_portPool->getPublisherPortDataList())
     {
         PublisherPortRouDiType sender(port);
@@ -796,6 +877,8 @@ void PortManager::destroyPublisherPort(PublisherPortRouDiType::MemberType_t* con
     PublisherPortRouDiType publisherPortRoudi{publisherPortData};
     PublisherPortUserType publisherPortUser{publisherPortData};
 
+    // a sender which died while delivering would block the removal of the queues
+    publisherPortRoudi.releaseSenderRegistrations();
     publisherPortUser.stopOffer();
 
     // process STOP_OFFER for this publisher in RouDi and distribute it
@@ -834,6 +917,13 @@ void PortManager::destroySubscriberPort(SubscriberPortType::MemberType_t* const
         this->sendToAllMatchingPublisherPorts(caproMessage, subscriberPortRoudi);
     });
 
+    // the subscriber port is destroyed with one of the next discovery runs when a publisher still accesses its queue
+    if (!tryReleaseQueueAtAllPublisherPorts(subscriberPortData))
+    {
+        subscriberPortUser.destroy();
+        return;
+    }
+
     subscriberPortRoudi.releaseAllChunks();
 
     m_portIntrospection.removeSubscriber(subscriberPortUser);
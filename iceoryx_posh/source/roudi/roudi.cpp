@@ -58,6 +58,10 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
     m_processIntrospection.registerPublisherPort(
         PublisherPortUserType(m_prcMgr->addIntrospectionPublisherPort(IntrospectionProcessService)));
     m_prcMgr->initIntrospection(&m_processIntrospection);
+    // every access to m_prcMgr holds its lock until the end of the full expression, therefore the second mempool
+    // introspection port cannot be acquired in the initializer list next to the first one
+    m_mempoolIntrospection.registerAllocationSizePublisherPort(
+        PublisherPortUserType(m_prcMgr->addIntrospectionPublisherPort(IntrospectionMemPoolAllocationSizeService)));
     m_processIntrospection.run();
     m_mempoolIntrospection.run();
 
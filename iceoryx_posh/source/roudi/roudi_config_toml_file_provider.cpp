@@ -17,6 +17,7 @@
 
 #include "iceoryx_posh/roudi/roudi_config_toml_file_provider.hpp"
 #include "iceoryx_dust/cxx/file_reader.hpp"
+#include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/cxx/string.hpp"
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
@@ -27,6 +28,7 @@
 #include <cpptoml.h>
 #include <limits> // workaround for missing include in cpptoml.h
 #include <string>
+#include <vector>
 
 namespace iox
 {
@@ -116,6 +118,145 @@ TomlRouDiConfigFileProvider::parse() noexcept
         auto writer = segment->get_as<std::string>("writer").value_or(groupOfCurrentProcess);
         auto reader = segment->get_as<std::string>("reader").value_or(groupOfCurrentProcess);
         iox::mepoo::MePooConfig mempoolConfig;
+        auto fallbackPolicy = segment->get_as<std::string>("mempool-fallback").value_or("strict");
+        if (fallbackPolicy == "strict")
+        {
+            mempoolConfig.m_fallbackPolicy = iox::mepoo::MemPoolFallbackPolicy::STRICT;
+        }
+        else if (fallbackPolicy == "next-larger")
+        {
+            mempoolConfig.m_fallbackPolicy = iox::mepoo::MemPoolFallbackPolicy::NEXT_LARGER;
+        }
+        else if (fallbackPolicy == "any-larger")
+        {
+            mempoolConfig.m_fallbackPolicy = iox::mepoo::MemPoolFallbackPolicy::ANY_LARGER;
+        }
+        else
+        {
+            LogWarn() << "Invalid mempool-fallback '" << fallbackPolicy
+                      << "', it must be 'strict', 'next-larger' or 'any-larger'";
+            return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                iox::roudi::RouDiConfigFileParseError::INVALID_MEMPOOL_FALLBACK_POLICY);
+        }
+        auto hugePages = segment->get_as<std::string>("huge-pages").value_or("none");
+        if (hugePages == "none")
+        {
+            mempoolConfig.m_hugePageSize = 0U;
+        }
+        else if (hugePages == "2M")
+        {
+            mempoolConfig.m_hugePageSize = iox::mepoo::MePooConfig::HUGE_PAGE_SIZE_2M;
+        }
+        else if (hugePages == "1G")
+        {
+            mempoolConfig.m_hugePageSize = iox::mepoo::MePooConfig::HUGE_PAGE_SIZE_1G;
+        }
+        else
+        {
+            LogWarn() << "Invalid huge-pages '" << hugePages << "', it must be 'none', '2M' or '1G'";
+            return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                iox::roudi::RouDiConfigFileParseError::INVALID_HUGE_PAGE_SIZE);
+        }
+        auto hugePageMount = segment->get_as<std::string>("huge-page-mount");
+        if (hugePageMount)
+        {
+            const std::string& path = *hugePageMount;
+            iox::mepoo::MePooConfig::HugePageMount_t mount{iox::cxx::TruncateToCapacity, path.c_str(), path.size()};
+            if (path.size() > mount.capacity() || !iox::cxx::isValidPathToDirectory(mount))
+            {
+                LogWarn() << "Invalid huge-page-mount '" << path << "', it must be a path to a directory";
+                return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                    iox::roudi::RouDiConfigFileParseError::INVALID_HUGE_PAGE_MOUNT);
+            }
+            mempoolConfig.m_hugePageMount = mount;
+        }
+        auto numaPolicy = segment->get_as<std::string>("numa-policy").value_or("default");
+        if (numaPolicy == "default")
+        {
+            mempoolConfig.m_numaPolicy.mode = iox::posix::NumaPolicy::Mode::DEFAULT;
+        }
+        else if (numaPolicy == "bind")
+        {
+            mempoolConfig.m_numaPolicy.mode = iox::posix::NumaPolicy::Mode::BIND;
+        }
+        else if (numaPolicy == "preferred")
+        {
+            mempoolConfig.m_numaPolicy.mode = iox::posix::NumaPolicy::Mode::PREFERRED;
+        }
+        else if (numaPolicy == "interleave")
+        {
+            mempoolConfig.m_numaPolicy.mode = iox::posix::NumaPolicy::Mode::INTERLEAVE;
+        }
+        else
+        {
+            LogWarn() << "Invalid numa-policy '" << numaPolicy
+                      << "', it must be 'default', 'bind', 'preferred' or 'interleave'";
+            return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                iox::roudi::RouDiConfigFileParseError::INVALID_NUMA_POLICY);
+        }
+        auto numaNodes = segment->get_array_of<int64_t>("numa-nodes").value_or(std::vector<int64_t>());
+        for (const auto node : numaNodes)
+        {
+            if (node < 0 || static_cast<uint64_t>(node) >= iox::posix::NumaPolicy::MAX_NUMBER_OF_NODES)
+            {
+                LogWarn() << "Invalid numa-nodes entry " << node << ", it must be in the range [0, "
+                          << iox::posix::NumaPolicy::MAX_NUMBER_OF_NODES << ")";
+                return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                    iox::roudi::RouDiConfigFileParseError::INVALID_NUMA_NODES);
+            }
+            mempoolConfig.m_numaPolicy.nodeMask |= 1ULL << static_cast<uint64_t>(node);
+        }
+        const bool isNodeRequired = mempoolConfig.m_numaPolicy.mode != iox::posix::NumaPolicy::Mode::DEFAULT;
+        const bool isSingleNodeRequired = mempoolConfig.m_numaPolicy.mode == iox::posix::NumaPolicy::Mode::PREFERRED;
+        if ((isNodeRequired && numaNodes.empty()) || (!isNodeRequired && !numaNodes.empty())
+            || (isSingleNodeRequired && numaNodes.size() > 1U))
+        {
+            LogWarn() << "Invalid numa-nodes for numa-policy '" << numaPolicy
+                      << "', 'default' takes no node, 'preferred' exactly one and 'bind' and 'interleave' at least one";
+            return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                iox::roudi::RouDiConfigFileParseError::INVALID_NUMA_NODES);
+        }
+        auto prefaultStrategy = segment->get_as<std::string>("prefault").value_or("zero");
+        if (prefaultStrategy == "zero")
+        {
+            mempoolConfig.m_prefaultStrategy = iox::posix::PrefaultStrategy::ZERO;
+        }
+        else if (prefaultStrategy == "parallel-zero")
+        {
+            mempoolConfig.m_prefaultStrategy = iox::posix::PrefaultStrategy::PARALLEL_ZERO;
+        }
+        else if (prefaultStrategy == "populate")
+        {
+            mempoolConfig.m_prefaultStrategy = iox::posix::PrefaultStrategy::POPULATE;
+        }
+        else if (prefaultStrategy == "lazy")
+        {
+            mempoolConfig.m_prefaultStrategy = iox::posix::PrefaultStrategy::LAZY;
+        }
+        else
+        {
+            LogWarn() << "Invalid prefault '" << prefaultStrategy
+                      << "', it must be 'zero', 'parallel-zero', 'populate' or 'lazy'";
+            return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                iox::roudi::RouDiConfigFileParseError::INVALID_PREFAULT_STRATEGY);
+        }
+        auto lockInMemory = segment->get_as<bool>("lock-in-memory");
+        if (segment->contains("lock-in-memory") && !lockInMemory)
+        {
+            LogWarn() << "Invalid lock-in-memory, it must be true or false";
+            return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                iox::roudi::RouDiConfigFileParseError::INVALID_LOCK_IN_MEMORY);
+        }
+        mempoolConfig.m_lockInMemory = lockInMemory.value_or(false);
+        auto extensionChunks = segment->get_as<uint32_t>("extension-chunks");
+        if (segment->contains("extension-chunks") && !extensionChunks)
+        {
+            LogWarn() << "Invalid extension-chunks, it must be a number of chunks in the range [0, "
+                      << std::numeric_limits<uint32_t>::max() << "]";
+            return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                iox::roudi::RouDiConfigFileParseError::INVALID_EXTENSION_CHUNKS);
+        }
+        mempoolConfig.m_maxNumberOfExtensionChunks = extensionChunks.value_or(0U);
         auto mempools = segment->get_table_array("mempool");
         if (!mempools)
         {
@@ -22,11 +22,113 @@
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 #include "iceoryx_posh/internal/mepoo/segment_manager.hpp"
 
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+
 namespace iox
 {
 namespace runtime
 {
-constexpr cxx::perms SharedMemoryUser::SHM_SEGMENT_PERMISSIONS;
+namespace
+{
+using SegmentMapping_t = mepoo::SegmentManager<>::SegmentMapping;
+using DataShmObjects_t = cxx::vector<posix::SharedMemoryObject, MAX_SHM_SEGMENTS>;
+
+constexpr cxx::perms SHM_SEGMENT_PERMISSIONS =
+    cxx::perms::owner_read | cxx::perms::owner_write | cxx::perms::group_read | cxx::perms::group_write;
+
+/// @brief the payload data segments which RouDi added after the start of the application, they are mapped when the
+/// first pointer into them is resolved
+struct DataSegmentExtensions
+{
+    std::mutex mutex;
+    mepoo::SegmentManager<>* segmentManager{nullptr};
+    DataShmObjects_t shmObjects;
+};
+
+DataSegmentExtensions& dataSegmentExtensions() noexcept
+{
+    static DataSegmentExtensions extensions;
+    return extensions;
+}
+
+/// @brief the locked pages count against the RLIMIT_MEMLOCK of every application, therefore an application only
+/// locks its mappings of the segments with lock-in-memory when it is started with IOX_LOCK_IN_MEMORY=on
+bool isLockInMemoryEnabled() noexcept
+{
+    static const bool isEnabled = [] {
+        // AXIVION Next Construct AutosarC++19_03-M18.0.3 : Use of getenv is allowed in MISRA amendment#6312
+        // JUSTIFICATION getenv is required to configure the application without changing its code
+        // NOLINTNEXTLINE(concurrency-mt-unsafe)
+        const auto* lockInMemory = std::getenv("IOX_LOCK_IN_MEMORY");
+        return lockInMemory != nullptr && strcmp(lockInMemory, "on") == 0;
+    }();
+    return isEnabled;
+}
+
+void openDataSegment(const SegmentMapping_t& segment, DataShmObjects_t& dataShmObjects) noexcept
+{
+    auto accessMode = segment.m_isWritable ? posix::AccessMode::READ_WRITE : posix::AccessMode::READ_ONLY;
+    posix::SharedMemoryObjectBuilder()
+        .name(segment.m_sharedMemoryName)
+        .memorySizeInBytes(segment.m_size)
+        .accessMode(accessMode)
+        .openMode(posix::OpenMode::OPEN_EXISTING)
+        .permissions(SHM_SEGMENT_PERMISSIONS)
+        .directory(segment.m_hugePageMount)
+        .create()
+        .and_then([&segment, &dataShmObjects](auto& sharedMemoryObject) {
+            if (static_cast<uint32_t>(dataShmObjects.size()) >= MAX_SHM_SEGMENTS)
+            {
+                errorHandler(PoshError::POSH__SHM_APP_SEGMENT_COUNT_OVERFLOW);
+            }
+
+            rp::BaseRelativePointer::registerPtr(rp::BaseRelativePointer::id_t{segment.m_segmentId},
+                                                 sharedMemoryObject.getBaseAddress(),
+                                                 sharedMemoryObject.getSizeInBytes());
+
+            LogDebug() << "Application registered payload data segment "
+                       << iox::log::hex(sharedMemoryObject.getBaseAddress()) << " with size "
+                       << sharedMemoryObject.getSizeInBytes() << " to id " << segment.m_segmentId;
+
+            if (segment.m_isLockedInMemory && isLockInMemoryEnabled())
+            {
+                // RouDi already keeps the pages resident, locking the mapping additionally avoids the page faults
+                // on the first access of this process, therefore a failure is not fatal
+                sharedMemoryObject.lockInMemory().or_else([&segment](auto&) {
+                    LogWarn() << "Unable to lock the payload data segment with id " << segment.m_segmentId
+                              << " in memory, the first access of each page might cause a page fault";
+                });
+            }
+
+            dataShmObjects.emplace_back(std::move(sharedMemoryObject));
+        })
+        .or_else([](auto&) { errorHandler(PoshError::POSH__SHM_APP_SEGMENT_MAPP_ERR); });
+}
+
+/// @brief is called by the relative pointers for segments which are not registered in this process
+void mapDataSegmentExtension(const rp::BaseRelativePointer::id_underlying_t id) noexcept
+{
+    auto& extensions = dataSegmentExtensions();
+    std::lock_guard<std::mutex> lock(extensions.mutex);
+    // another thread might have mapped the segment in the meantime
+    if (extensions.segmentManager == nullptr || rp::BaseRelativePointer::getRepository().getBasePtr(id) != nullptr)
+    {
+        return;
+    }
+
+    auto segmentMapping = extensions.segmentManager->getSegmentMappings(posix::PosixUser::getUserOfCurrentProcess());
+    for (const auto& segment : segmentMapping)
+    {
+        if (segment.m_segmentId == id)
+        {
+            openDataSegment(segment, extensions.shmObjects);
+            return;
+        }
+    }
+}
+} // namespace
 
 SharedMemoryUser::SharedMemoryUser(const size_t topicSize,
                                    const uint64_t segmentId,
@@ -54,6 +156,26 @@ SharedMemoryUser::SharedMemoryUser(const size_t topicSize,
         .or_else([](auto&) { errorHandler(PoshError::POSH__SHM_APP_MAPP_ERR); });
 }
 
+SharedMemoryUser::SharedMemoryUser(SharedMemoryUser&& rhs) noexcept
+    : m_shmObject(std::move(rhs.m_shmObject))
+    , m_dataShmObjects(std::move(rhs.m_dataShmObjects))
+    , m_mapsDataSegmentExtensions(rhs.m_mapsDataSegmentExtensions)
+{
+    rhs.m_mapsDataSegmentExtensions = false;
+}
+
+SharedMemoryUser::~SharedMemoryUser() noexcept
+{
+    if (m_mapsDataSegmentExtensions)
+    {
+        rp::BaseRelativePointer::setUnregisteredSegmentHandler(nullptr);
+        auto& extensions = dataSegmentExtensions();
+        std::lock_guard<std::mutex> lock(extensions.mutex);
+        extensions.segmentManager = nullptr;
+        extensions.shmObjects.clear();
+    }
+}
+
 void SharedMemoryUser::openDataSegments(const uint64_t segmentId,
                                         const rp::BaseRelativePointer::offset_t segmentManagerAddressOffset) noexcept
 {
@@ -63,31 +185,17 @@ void SharedMemoryUser::openDataSegments(const uint64_t segmentId,
     auto segmentMapping = segmentManager->getSegmentMappings(posix::PosixUser::getUserOfCurrentProcess());
     for (const auto& segment : segmentMapping)
     {
-        auto accessMode = segment.m_isWritable ? posix::AccessMode::READ_WRITE : posix::AccessMode::READ_ONLY;
-        posix::SharedMemoryObjectBuilder()
-            .name(segment.m_sharedMemoryName)
-            .memorySizeInBytes(segment.m_size)
-            .accessMode(accessMode)
-            .openMode(posix::OpenMode::OPEN_EXISTING)
-            .permissions(SHM_SEGMENT_PERMISSIONS)
-            .create()
-            .and_then([this, &segment](auto& sharedMemoryObject) {
-                if (static_cast<uint32_t>(m_dataShmObjects.size()) >= MAX_SHM_SEGMENTS)
-                {
-                    errorHandler(PoshError::POSH__SHM_APP_SEGMENT_COUNT_OVERFLOW);
-                }
-
-                rp::BaseRelativePointer::registerPtr(rp::BaseRelativePointer::id_t{segment.m_segmentId},
-                                                     sharedMemoryObject.getBaseAddress(),
-                                                     sharedMemoryObject.getSizeInBytes());
-
-                LogDebug() << "Application registered payload data segment "
-                           << iox::log::hex(sharedMemoryObject.getBaseAddress()) << " with size "
-                           << sharedMemoryObject.getSizeInBytes() << " to id " << segment.m_segmentId;
-
-                m_dataShmObjects.emplace_back(std::move(sharedMemoryObject));
-            })
-            .or_else([](auto&) { errorHandler(PoshError::POSH__SHM_APP_SEGMENT_MAPP_ERR); });
+        openDataSegment(segment, m_dataShmObjects);
+    }
+
+    // RouDi can extend the payload data segments at any time, only one SharedMemoryUser per process maps them
+    auto& extensions = dataSegmentExtensions();
+    std::lock_guard<std::mutex> lock(extensions.mutex);
+    if (extensions.segmentManager == nullptr)
+    {
+        extensions.segmentManager = segmentManager;
+        m_mapsDataSegmentExtensions = true;
+        rp::BaseRelativePointer::setUnregisteredSegmentHandler(&mapDataSegmentExtension);
     }
 }
 } // namespace runtime
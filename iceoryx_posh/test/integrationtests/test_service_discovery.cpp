@@ -191,7 +191,7 @@ TEST_F(ServiceDiscoveryBase_test, FindServiceWithWildcardsReturnsOnlyIntrospecti
     ::testing::Test::RecordProperty("TEST_ID", "d944f32c-edef-44f5-a6eb-c19ee73c98eb");
     findService(iox::capro::Wildcard, iox::capro::Wildcard, iox::capro::Wildcard, MessagingPattern::PUB_SUB);
 
-    constexpr uint32_t NUM_INTERNAL_SERVICES = 6U;
+    constexpr uint32_t NUM_INTERNAL_SERVICES = 7U;
     EXPECT_EQ(serviceContainer.size(), NUM_INTERNAL_SERVICES);
     for (auto& service : serviceContainer)
     {
@@ -450,6 +450,7 @@ class ReferenceDiscovery
         if (pattern == MessagingPattern::PUB_SUB)
         {
             services.emplace(iox::roudi::IntrospectionMempoolService);
+            services.emplace(iox::roudi::IntrospectionMemPoolAllocationSizeService);
             services.emplace(iox::roudi::IntrospectionPortService);
             services.emplace(iox::roudi::IntrospectionPortThroughputService);
             services.emplace(iox::roudi::IntrospectionSubscriberPortChangingDataService);
@@ -32,6 +32,7 @@ class MockPublisherPortUser
 {
   public:
     using MemberType_t = iox::popo::PublisherPortData;
+    using ChunkHeaderBatch_t = iox::popo::PublisherPortUser::ChunkHeaderBatch_t;
     MockPublisherPortUser() = default;
     MockPublisherPortUser(std::nullptr_t)
     {
@@ -58,6 +59,7 @@ class MockPublisherPortUser
                      const uint32_t, const uint32_t, const uint32_t, const uint32_t));
     MOCK_METHOD1(releaseChunk, void(iox::mepoo::ChunkHeader* const));
     MOCK_METHOD1(sendChunk, void(iox::mepoo::ChunkHeader* const));
+    MOCK_METHOD1(sendChunks, void(const ChunkHeaderBatch_t&));
     MOCK_METHOD0(tryGetPreviousChunk, iox::cxx::optional<iox::mepoo::ChunkHeader*>());
     MOCK_METHOD0(offer, void());
     MOCK_METHOD0(stopOffer, void());
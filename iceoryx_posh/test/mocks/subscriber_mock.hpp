@@ -37,6 +37,7 @@ class MockSubscriberPortUser
 {
   public:
     using MemberType_t = iox::popo::SubscriberPortData;
+    using ChunkHeaderBatch_t = iox::popo::SubscriberPortUser::ChunkHeaderBatch_t;
     MockSubscriberPortUser() = default;
     MockSubscriberPortUser(std::nullptr_t)
     {
@@ -52,6 +53,8 @@ class MockSubscriberPortUser
     MOCK_METHOD0(unsubscribe, void());
     MOCK_CONST_METHOD0(getSubscriptionState, iox::SubscribeState());
     MOCK_METHOD0(tryGetChunk, iox::cxx::expected<const iox::mepoo::ChunkHeader*, iox::popo::ChunkReceiveResult>());
+    MOCK_METHOD2(tryGetChunks,
+                 iox::cxx::expected<iox::popo::ChunkReceiveResult>(ChunkHeaderBatch_t&, const uint64_t));
     MOCK_METHOD1(releaseChunk, void(const void* const));
     MOCK_METHOD0(releaseQueuedChunks, void());
     MOCK_CONST_METHOD0(hasNewChunks, bool());
@@ -69,6 +72,7 @@ class MockBaseSubscriber
   public:
     using SelfType = MockBaseSubscriber<T, Port>;
     using PortType = Port;
+    using ChunkHeaderBatch_t = iox::popo::SubscriberPortUser::ChunkHeaderBatch_t;
 
     MockBaseSubscriber(const iox::capro::ServiceDescription&, const iox::popo::SubscriberOptions&){};
     MOCK_CONST_METHOD0(getUid, iox::popo::uid_t());
@@ -79,6 +83,8 @@ class MockBaseSubscriber
     MOCK_CONST_METHOD0(hasData, bool());
     MOCK_METHOD0(hasMissedData, bool());
     MOCK_METHOD0(takeChunk, iox::cxx::expected<const iox::mepoo::ChunkHeader*, iox::popo::ChunkReceiveResult>());
+    MOCK_METHOD2(takeChunks,
+                 iox::cxx::expected<iox::popo::ChunkReceiveResult>(ChunkHeaderBatch_t&, const uint64_t));
     MOCK_METHOD0(releaseQueuedData, void());
     MOCK_METHOD1(invalidateTrigger, bool(const uint64_t));
     MOCK_METHOD1(disableEvent, void(const iox::popo::SubscriberEvent));
@@ -0,0 +1,89 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/mepoo/allocation_size_histogram.hpp"
+#include "test.hpp"
+
+#include <limits>
+
+namespace
+{
+using namespace ::testing;
+using iox::mepoo::AllocationSizeHistogram;
+
+constexpr uint32_t CHUNK_SIZE{1024U};
+
+TEST(AllocationSizeHistogram_test, UpperBoundHalvesWithEveryOctave)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "579deada-a168-48e9-b6a3-6a238799de66");
+    EXPECT_THAT(AllocationSizeHistogram::upperBound(CHUNK_SIZE, 0U), Eq(CHUNK_SIZE));
+    EXPECT_THAT(AllocationSizeHistogram::upperBound(CHUNK_SIZE, 1U), Eq(861U));
+    EXPECT_THAT(AllocationSizeHistogram::upperBound(CHUNK_SIZE, 2U), Eq(724U));
+    EXPECT_THAT(AllocationSizeHistogram::upperBound(CHUNK_SIZE, 3U), Eq(608U));
+    EXPECT_THAT(AllocationSizeHistogram::upperBound(CHUNK_SIZE, 4U), Eq(CHUNK_SIZE / 2U));
+    EXPECT_THAT(AllocationSizeHistogram::upperBound(CHUNK_SIZE, 8U), Eq(CHUNK_SIZE / 4U));
+    EXPECT_THAT(AllocationSizeHistogram::upperBound(CHUNK_SIZE, 12U), Eq(CHUNK_SIZE / 8U));
+}
+
+TEST(AllocationSizeHistogram_test, UpperBoundDoesNotOverflowWithTheLargestChunkSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "22214aa8-0323-44e3-b72e-115c5246bbb4");
+    constexpr uint32_t LARGEST_CHUNK_SIZE{std::numeric_limits<uint32_t>::max()};
+    EXPECT_THAT(AllocationSizeHistogram::upperBound(LARGEST_CHUNK_SIZE, 0U), Eq(LARGEST_CHUNK_SIZE));
+    EXPECT_THAT(AllocationSizeHistogram::upperBound(LARGEST_CHUNK_SIZE, 4U), Eq(LARGEST_CHUNK_SIZE / 2U));
+}
+
+TEST(AllocationSizeHistogram_test, RequiredChunkSizesAreCountedInTheBucketWithTheNextLargerUpperBound)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4c61e8b9-b9ed-4435-8a6b-34b81655142e");
+    EXPECT_THAT(AllocationSizeHistogram::bucket(CHUNK_SIZE, CHUNK_SIZE), Eq(0U));
+    EXPECT_THAT(AllocationSizeHistogram::bucket(CHUNK_SIZE, 862U), Eq(0U));
+    EXPECT_THAT(AllocationSizeHistogram::bucket(CHUNK_SIZE, 861U), Eq(1U));
+    EXPECT_THAT(AllocationSizeHistogram::bucket(CHUNK_SIZE, CHUNK_SIZE / 2U + 1U), Eq(3U));
+    EXPECT_THAT(AllocationSizeHistogram::bucket(CHUNK_SIZE, CHUNK_SIZE / 2U), Eq(4U));
+}
+
+TEST(AllocationSizeHistogram_test, RequiredChunkSizesBelowTheSmallestUpperBoundAreCountedInTheLastBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "96d21041-30d3-4d2c-b6f4-aa67011ae8ca");
+    constexpr uint32_t LAST_BUCKET{AllocationSizeHistogram::NUMBER_OF_BUCKETS - 1U};
+    const uint32_t smallestUpperBound = AllocationSizeHistogram::upperBound(CHUNK_SIZE, LAST_BUCKET);
+    EXPECT_THAT(AllocationSizeHistogram::bucket(CHUNK_SIZE, smallestUpperBound), Eq(LAST_BUCKET));
+    EXPECT_THAT(AllocationSizeHistogram::bucket(CHUNK_SIZE, 1U), Eq(LAST_BUCKET));
+}
+
+TEST(AllocationSizeHistogram_test, MaxAverageUsageIsZeroWithoutAllocations)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b66475dc-11c5-4738-a8f3-b843ad58be95");
+    AllocationSizeHistogram sut;
+    EXPECT_THAT(sut.numberOfAllocations(), Eq(0U));
+    EXPECT_THAT(sut.maxAverageUsageInPercent(CHUNK_SIZE), Eq(0U));
+}
+
+TEST(AllocationSizeHistogram_test, MaxAverageUsageIsTheAverageOfTheUpperBoundsOfTheCountedAllocations)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "463fdcbc-6cce-4742-80bf-089d7f7c1ca3");
+    AllocationSizeHistogram sut;
+    sut.m_counts[0U] = 1U;
+    sut.m_counts[4U] = 1U;
+    sut.m_counts[8U] = 2U;
+
+    EXPECT_THAT(sut.numberOfAllocations(), Eq(4U));
+    // (1 + 1/2 + 2 * 1/4) / 4
+    EXPECT_THAT(sut.maxAverageUsageInPercent(CHUNK_SIZE), Eq(50U));
+}
+
+} // namespace
@@ -475,6 +475,426 @@ TEST_F(MemoryManager_test, addMemPoolWithChunkCountZeroShouldFail)
     EXPECT_DEATH({ sut->configureMemoryManager(mempoolconf, *allocator, *allocator); }, ".*");
 }
 
+TEST_F(MemoryManager_test, GetChunkWithChunkCacheRefillsTheCacheWithOneBatch)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1fab8215-3cb7-4350-8ba2-0edd87a3e9ed");
+    constexpr uint32_t CHUNK_COUNT{100U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::ChunkCache chunkCache;
+
+    auto chunk = sut->getChunk(chunkSettings_32, chunkCache);
+
+    ASSERT_FALSE(chunk.has_error());
+    EXPECT_THAT(chunk.value().getChunkHeader()->userPayloadSize(), Eq(CHUNK_SIZE_32));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(iox::mepoo::ChunkCache::CAPACITY));
+    EXPECT_THAT(chunkCache.size(), Eq(iox::mepoo::ChunkCache::CAPACITY - 1U));
+
+    chunkCache.drain();
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(1U));
+}
+
+TEST_F(MemoryManager_test, GetChunkWithChunkCacheForAnotherMemPoolDrainsTheCache)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "43a04d3e-b616-46bf-a8ed-d8cfd47ab0cf");
+    constexpr uint32_t CHUNK_COUNT{100U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::ChunkCache chunkCache;
+
+    auto smallChunk = sut->getChunk(chunkSettings_32, chunkCache);
+    auto largeChunk = sut->getChunk(chunkSettings_128, chunkCache);
+
+    ASSERT_FALSE(smallChunk.has_error());
+    ASSERT_FALSE(largeChunk.has_error());
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(1U));
+    EXPECT_THAT(sut->getMemPoolInfo(1U).m_usedChunks, Eq(iox::mepoo::ChunkCache::CAPACITY));
+}
+
+TEST_F(MemoryManager_test, ChunksFromChunkCacheAreReturnedToTheMemPoolsWhenReleased)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "db2b81b0-7e57-4638-b73d-e4221886c715");
+    constexpr uint32_t CHUNK_COUNT{100U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::ChunkCache chunkCache;
+
+    {
+        ChunkStore chunkStore;
+        for (uint32_t i = 0U; i < CHUNK_COUNT; ++i)
+        {
+            auto chunk = sut->getChunk(chunkSettings_32, chunkCache);
+            ASSERT_FALSE(chunk.has_error());
+            chunkStore.push_back(chunk.value());
+        }
+        EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(CHUNK_COUNT));
+    }
+    chunkCache.drain();
+
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_32);
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(CHUNK_COUNT));
+}
+
+TEST_F(MemoryManager_test, GetChunkWithChunkCacheWhenNoFreeChunksInMemPoolReturnsError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6a1f5f56-72d2-4f4e-a1ca-4a3d6dfe8a0f");
+    constexpr uint32_t CHUNK_COUNT{3U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::ChunkCache chunkCache;
+
+    ChunkStore chunkStore;
+    for (uint32_t i = 0U; i < CHUNK_COUNT; ++i)
+    {
+        auto chunk = sut->getChunk(chunkSettings_32, chunkCache);
+        ASSERT_FALSE(chunk.has_error());
+        chunkStore.push_back(chunk.value());
+    }
+
+    iox::cxx::optional<iox::PoshError> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&detectedError](const iox::PoshError error, const iox::ErrorLevel errorLevel) {
+            detectedError.emplace(error);
+            EXPECT_EQ(errorLevel, iox::ErrorLevel::MODERATE);
+        });
+
+    constexpr auto EXPECTED_ERROR{iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS};
+    sut->getChunk(chunkSettings_32, chunkCache)
+        .and_then(
+            [&](auto&) { GTEST_FAIL() << "getChunk should fail with '" << EXPECTED_ERROR << "' but did not fail"; })
+        .or_else([&](const auto& error) { EXPECT_EQ(error, EXPECTED_ERROR); });
+
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_EQ(detectedError.value(), iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS);
+}
+
+TEST_F(MemoryManager_test, GetChunkUsesTheSmallestFittingMemPoolForEveryUserPayloadSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a46bd30a-c04a-49fc-a23d-be0f27604852");
+    constexpr uint32_t CHUNK_COUNT{1U};
+    constexpr uint32_t MAX_USER_PAYLOAD_SIZE{4096U};
+    for (const uint32_t userPayloadSize : {8U, 32U, 40U, 64U, 96U, 128U, 256U, 1000U, 1024U, MAX_USER_PAYLOAD_SIZE})
+    {
+        mempoolconf.addMemPool({userPayloadSize, CHUNK_COUNT});
+    }
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    for (uint32_t userPayloadSize = 0U; userPayloadSize <= MAX_USER_PAYLOAD_SIZE; ++userPayloadSize)
+    {
+        auto chunkSettings = ChunkSettings::create(userPayloadSize, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+        ASSERT_FALSE(chunkSettings.has_error());
+
+        uint32_t expectedChunkSize{0U};
+        for (uint32_t i = 0U; i < sut->getNumberOfMemPools(); ++i)
+        {
+            if (sut->getMemPoolInfo(i).m_chunkSize >= chunkSettings.value().requiredChunkSize())
+            {
+                expectedChunkSize = sut->getMemPoolInfo(i).m_chunkSize;
+                break;
+            }
+        }
+
+        auto chunk = sut->getChunk(chunkSettings.value());
+        ASSERT_FALSE(chunk.has_error());
+        EXPECT_THAT(chunk.value().getChunkHeader()->chunkSize(), Eq(expectedChunkSize));
+    }
+}
+
+TEST_F(MemoryManager_test, GetChunkWithChunkCacheRemembersTheMemPoolOfTheLastChunkSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6052e05d-5384-4e91-99a6-24ae3446d4cb");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    constexpr bool IS_REFILLED_IN_BATCHES{false};
+    iox::mepoo::ChunkCache chunkCache{IS_REFILLED_IN_BATCHES};
+
+    auto chunk = sut->getChunk(chunkSettings_128, chunkCache);
+
+    ASSERT_FALSE(chunk.has_error());
+    EXPECT_THAT(chunkCache.size(), Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1U).m_usedChunks, Eq(1U));
+    const uint32_t numberOfMemPools = sut->getNumberOfMemPools();
+    auto resolvedMemPoolIndex =
+        chunkCache.resolvedMemPoolIndex(chunkSettings_128.requiredChunkSize(), numberOfMemPools);
+    ASSERT_TRUE(resolvedMemPoolIndex.has_value());
+    EXPECT_THAT(resolvedMemPoolIndex.value(), Eq(1U));
+    EXPECT_FALSE(chunkCache.resolvedMemPoolIndex(chunkSettings_32.requiredChunkSize(), numberOfMemPools).has_value());
+}
+
+TEST_F(MemoryManager_test, GetChunkWithNextLargerFallbackTakesTheChunkFromTheNextMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6e60868c-78e2-4cf4-97c7-8c287fe2a2de");
+    constexpr uint32_t CHUNK_COUNT{2U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    mempoolconf.m_fallbackPolicy = iox::mepoo::MemPoolFallbackPolicy::NEXT_LARGER;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(2U * CHUNK_COUNT, chunkSettings_32);
+
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(1U).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_numberOfFallbacks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(chunkStore.back().getChunkHeader()->userPayloadSize(), Eq(CHUNK_SIZE_32));
+
+    iox::cxx::optional<iox::PoshError> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&detectedError](const iox::PoshError error, const iox::ErrorLevel) { detectedError.emplace(error); });
+
+    EXPECT_TRUE(sut->getChunk(chunkSettings_32).has_error());
+    EXPECT_THAT(sut->getMemPoolInfo(2U).m_usedChunks, Eq(0U));
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_EQ(detectedError.value(), iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS);
+}
+
+TEST_F(MemoryManager_test, GetChunkWithAnyLargerFallbackTakesTheChunkFromTheSmallestLargerMemPoolWithFreeChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5d93e87f-a647-4d03-ab39-de105b6b29b9");
+    constexpr uint32_t CHUNK_COUNT{2U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    mempoolconf.m_fallbackPolicy = iox::mepoo::MemPoolFallbackPolicy::ANY_LARGER;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore64 = getChunksFromSut(CHUNK_COUNT, chunkSettings_64);
+    auto chunkStore32 = getChunksFromSut(2U * CHUNK_COUNT, chunkSettings_32);
+
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(1U).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(2U).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_numberOfFallbacks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(1U).m_numberOfFallbacks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, GetChunkWithStrictFallbackDoesNotUseLargerMemPools)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7b03051e-4baa-490c-b4de-0e1407abc071");
+    constexpr uint32_t CHUNK_COUNT{2U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_32);
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [](const iox::PoshError, const iox::ErrorLevel) {});
+
+    EXPECT_TRUE(sut->getChunk(chunkSettings_32).has_error());
+    EXPECT_THAT(sut->getMemPoolInfo(1U).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_numberOfFallbacks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, GetChunkCountsTheRequiredChunkSizeInTheHistogramOfTheBestFittingMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3facfd13-49c8-4ed1-bb73-b37aa47dd538");
+    constexpr uint32_t CHUNK_COUNT{4U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_256, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore32 = getChunksFromSut(3U, chunkSettings_32);
+    auto chunkStore128 = getChunksFromSut(2U, chunkSettings_128);
+
+    const auto smallMemPoolInfo = sut->getMemPoolInfo(0U);
+    EXPECT_THAT(smallMemPoolInfo.m_allocationSizeHistogram.numberOfAllocations(), Eq(3U));
+    EXPECT_THAT(smallMemPoolInfo.m_allocationSizeHistogram.m_counts[0U], Eq(3U));
+    EXPECT_THAT(smallMemPoolInfo.m_allocationSizeHistogram.maxAverageUsageInPercent(smallMemPoolInfo.m_chunkSize),
+                Eq(100U));
+
+    const auto largeMemPoolInfo = sut->getMemPoolInfo(1U);
+    const auto bucket = iox::mepoo::AllocationSizeHistogram::bucket(largeMemPoolInfo.m_chunkSize,
+                                                                    chunkSettings_128.requiredChunkSize());
+    EXPECT_THAT(bucket, Gt(0U));
+    EXPECT_THAT(largeMemPoolInfo.m_allocationSizeHistogram.numberOfAllocations(), Eq(2U));
+    EXPECT_THAT(largeMemPoolInfo.m_allocationSizeHistogram.m_counts[bucket], Eq(2U));
+    EXPECT_THAT(largeMemPoolInfo.m_allocationSizeHistogram.maxAverageUsageInPercent(largeMemPoolInfo.m_chunkSize),
+                Lt(100U));
+}
+
+TEST_F(MemoryManager_test, GetChunkWithChunkCacheCountsTheAllocationsInTheHistogramOnlyWithTheNextRefillOrDrain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f4ec1b4e-41b2-4f88-b136-a552cb6e031b");
+    constexpr uint32_t CHUNK_COUNT{100U};
+    constexpr uint64_t NUMBER_OF_ALLOCATIONS{3U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::ChunkCache chunkCache;
+
+    ChunkStore chunkStore;
+    for (uint64_t i = 0U; i < NUMBER_OF_ALLOCATIONS; ++i)
+    {
+        auto chunk = sut->getChunk(chunkSettings_32, chunkCache);
+        ASSERT_FALSE(chunk.has_error());
+        chunkStore.push_back(chunk.value());
+    }
+
+    // only the first allocation needed a refill, the others were served by the cache without touching the mempool
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_allocationSizeHistogram.numberOfAllocations(), Eq(1U));
+
+    chunkCache.drain();
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_allocationSizeHistogram.numberOfAllocations(), Eq(NUMBER_OF_ALLOCATIONS));
+}
+
+TEST_F(MemoryManager_test, GetChunkCountsTheFailedAllocationAtTheBestFittingMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8a5cc153-dbbd-4e18-82c3-035cca60195c");
+    constexpr uint32_t CHUNK_COUNT{2U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_32);
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [](const iox::PoshError, const iox::ErrorLevel) {});
+
+    EXPECT_TRUE(sut->getChunk(chunkSettings_32).has_error());
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_numberOfFailedAllocations, Eq(1U));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_allocationSizeHistogram.numberOfAllocations(), Eq(CHUNK_COUNT + 1U));
+    EXPECT_THAT(sut->getMemPoolInfo(1U).m_numberOfFailedAllocations, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, GetChunkDoesNotCountAnAllocationWhichIsServedByAFallbackAsFailed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f97dc156-c72b-4e1e-94be-01a5511313ee");
+    constexpr uint32_t CHUNK_COUNT{2U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.m_fallbackPolicy = iox::mepoo::MemPoolFallbackPolicy::NEXT_LARGER;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(2U * CHUNK_COUNT, chunkSettings_32);
+
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_numberOfFailedAllocations, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_allocationSizeHistogram.numberOfAllocations(), Eq(2U * CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(1U).m_allocationSizeHistogram.numberOfAllocations(), Eq(0U));
+}
+
+TEST_F(MemoryManager_test, ExtensionMemPoolWithTheSameChunkSizeServesChunksWhenTheConfiguredMemPoolIsExhausted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "05a40771-519a-4528-91fc-670c15f33afa");
+    constexpr uint32_t CHUNK_COUNT{2U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.m_maxNumberOfExtensionChunks = CHUNK_COUNT;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::MePooConfig extensionConfig;
+    extensionConfig.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+
+    sut->addExtensionMemPools(extensionConfig, *allocator);
+    auto chunkStore = getChunksFromSut(2U * CHUNK_COUNT, chunkSettings_32);
+
+    ASSERT_THAT(sut->getNumberOfMemPools(), Eq(2U));
+    EXPECT_THAT(sut->getMemPoolInfo(1U).m_chunkSize, Eq(sut->getMemPoolInfo(0U).m_chunkSize));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(1U).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_numberOfFallbacks, Eq(CHUNK_COUNT));
+}
+
+TEST_F(MemoryManager_test, ExtensionMemPoolIsUsedWhenItFitsTheChunkSizeBetterThanTheConfiguredMemPools)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "83d7d48c-d7f2-499d-800c-072d2d9cdc31");
+    constexpr uint32_t CHUNK_COUNT{2U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_256, CHUNK_COUNT});
+    mempoolconf.m_maxNumberOfExtensionChunks = CHUNK_COUNT;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::MePooConfig extensionConfig;
+    extensionConfig.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+
+    sut->addExtensionMemPools(extensionConfig, *allocator);
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_64);
+
+    EXPECT_THAT(sut->getMemPoolInfo(1U).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(2U).m_usedChunks, Eq(CHUNK_COUNT));
+}
+
+TEST_F(MemoryManager_test, GetChunkWithChunkCacheResolvesTheMemPoolAgainAfterMemPoolsWereAdded)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b80afe6c-2d17-425e-bea6-9a0617ac5535");
+    constexpr uint32_t CHUNK_COUNT{2U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_256, CHUNK_COUNT});
+    mempoolconf.m_maxNumberOfExtensionChunks = CHUNK_COUNT;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    constexpr bool IS_REFILLED_IN_BATCHES{false};
+    iox::mepoo::ChunkCache chunkCache{IS_REFILLED_IN_BATCHES};
+    iox::mepoo::MePooConfig extensionConfig;
+    extensionConfig.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+
+    auto chunkBeforeExtension = sut->getChunk(chunkSettings_64, chunkCache);
+    sut->addExtensionMemPools(extensionConfig, *allocator);
+    auto chunkAfterExtension = sut->getChunk(chunkSettings_64, chunkCache);
+
+    ASSERT_FALSE(chunkBeforeExtension.has_error());
+    ASSERT_FALSE(chunkAfterExtension.has_error());
+    EXPECT_THAT(sut->getMemPoolInfo(1U).m_usedChunks, Eq(1U));
+    EXPECT_THAT(sut->getMemPoolInfo(2U).m_usedChunks, Eq(1U));
+}
+
+TEST_F(MemoryManager_test, VerifyExtensionMemPoolsFailsWhenTheReservedChunksAreExceeded)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "53fca159-5389-43d2-ac7e-f37ee8e3724c");
+    constexpr uint32_t CHUNK_COUNT{2U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.m_maxNumberOfExtensionChunks = CHUNK_COUNT;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::MePooConfig fittingConfig;
+    fittingConfig.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT - 1U});
+    iox::mepoo::MePooConfig exceedingConfig;
+    exceedingConfig.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+
+    EXPECT_FALSE(sut->verifyExtensionMemPools(fittingConfig).has_error());
+    sut->addExtensionMemPools(fittingConfig, *allocator);
+    auto result = sut->verifyExtensionMemPools(exceedingConfig);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(iox::mepoo::MemoryManager::ExtensionError::CHUNK_LIMIT_EXCEEDED));
+}
+
+TEST_F(MemoryManager_test, VerifyExtensionMemPoolsFailsWhenThereWouldBeTooManyMemPools)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a9504e56-9a15-4cdd-9eed-05a81c892c26");
+    constexpr uint32_t CHUNK_COUNT{1U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.m_maxNumberOfExtensionChunks = iox::MAX_NUMBER_OF_MEMPOOLS;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::MePooConfig extensionConfig;
+    for (uint32_t i = 0U; i < iox::MAX_NUMBER_OF_MEMPOOLS; ++i)
+    {
+        extensionConfig.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    }
+
+    auto result = sut->verifyExtensionMemPools(extensionConfig);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(iox::mepoo::MemoryManager::ExtensionError::MEMPOOL_LIMIT_EXCEEDED));
+}
+
+TEST_F(MemoryManager_test, AddingInvalidExtensionMemPoolsCallsErrorHandler)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ed6cbf4f-76ce-42d0-bb2a-b30f1a5263b6");
+    constexpr uint32_t CHUNK_COUNT{2U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.m_maxNumberOfExtensionChunks = CHUNK_COUNT;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::MePooConfig misalignedConfig;
+    misalignedConfig.addMemPool({CHUNK_SIZE_32 + 1U, CHUNK_COUNT});
+    iox::cxx::optional<iox::PoshError> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&detectedError](const iox::PoshError error, const iox::ErrorLevel) { detectedError.emplace(error); });
+
+    EXPECT_TRUE(sut->verifyExtensionMemPools(iox::mepoo::MePooConfig()).has_error());
+    sut->addExtensionMemPools(misalignedConfig, *allocator);
+
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_EQ(detectedError.value(), iox::PoshError::MEPOO__MEMPOOL_INVALID_EXTENSION);
+    EXPECT_THAT(sut->getNumberOfMemPools(), Eq(1U));
+}
+
 TEST(MemoryManagerEnumString_test, asStringLiteralConvertsEnumValuesToStrings)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5f6c3942-0af5-4c48-b44c-7268191dbac5");
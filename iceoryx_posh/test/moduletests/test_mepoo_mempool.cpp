@@ -19,6 +19,9 @@
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "test.hpp"
 
+#include <algorithm>
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -209,6 +212,96 @@ TEST_F(MemPool_test, GetMinFreeMethodReturnsTheNumberOfFreeChunks)
     }
 }
 
+TEST_F(MemPool_test, GetChunksMethodObtainsDistinctChunksAndUpdatesTheStatistics)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "abff8d60-62b7-4782-9283-657d84290a74");
+    constexpr uint32_t NUMBER_OF_REQUESTED_CHUNKS{10U};
+    std::vector<void*> chunks(NUMBER_OF_REQUESTED_CHUNKS, nullptr);
+
+    EXPECT_THAT(sut.getChunks(chunks.data(), NUMBER_OF_REQUESTED_CHUNKS), Eq(NUMBER_OF_REQUESTED_CHUNKS));
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_REQUESTED_CHUNKS));
+    EXPECT_THAT(sut.getMinFree(), Eq(NUMBER_OF_CHUNKS - NUMBER_OF_REQUESTED_CHUNKS));
+    std::sort(chunks.begin(), chunks.end());
+    EXPECT_THAT(std::adjacent_find(chunks.begin(), chunks.end()), Eq(chunks.end()));
+    EXPECT_THAT(std::find(chunks.begin(), chunks.end(), nullptr), Eq(chunks.end()));
+}
+
+TEST_F(MemPool_test, GetChunksMethodIsLimitedByTheBatchSizeAndTheFreeChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1e7d653e-5b69-4a57-a5be-e361252a8a89");
+    std::vector<void*> chunks(NUMBER_OF_CHUNKS, nullptr);
+
+    EXPECT_THAT(sut.getChunks(chunks.data(), NUMBER_OF_CHUNKS), Eq(MemPool::MAX_CHUNKS_PER_BATCH));
+
+    uint32_t numberOfObtainedChunks{MemPool::MAX_CHUNKS_PER_BATCH};
+    while (numberOfObtainedChunks < NUMBER_OF_CHUNKS)
+    {
+        numberOfObtainedChunks += sut.getChunks(&chunks[numberOfObtainedChunks],
+                                                NUMBER_OF_CHUNKS - numberOfObtainedChunks);
+    }
+
+    EXPECT_THAT(sut.getChunks(chunks.data(), 1U), Eq(0U));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TEST_F(MemPool_test, FreeChunksMethodReturnsAllChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6d2d6779-14e9-4284-978f-19ccb035c0d1");
+    std::vector<void*> chunks;
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.push_back(sut.getChunk());
+    }
+
+    sut.freeChunks(chunks.data(), NUMBER_OF_CHUNKS);
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0U));
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        EXPECT_THAT(sut.getChunk(), Ne(nullptr));
+    }
+}
+
+TEST_F(MemPool_test, FreeChunksMethodWhenSameChunkIsTriedToFreeTwiceReturnsError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a8677682-6eb1-4390-ae87-4d94a52e7904");
+    std::vector<void*> chunks{sut.getChunk(), sut.getChunk()};
+    chunks.push_back(chunks.front());
+    iox::cxx::optional<iox::PoshError> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&detectedError](const iox::PoshError error, const iox::ErrorLevel errorLevel) {
+            detectedError.emplace(error);
+            EXPECT_THAT(errorLevel, Eq(iox::ErrorLevel::FATAL));
+        });
+
+    sut.freeChunks(chunks.data(), static_cast<uint32_t>(chunks.size()));
+
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_THAT(detectedError.value(), Eq(iox::PoshError::POSH__MEMPOOL_POSSIBLE_DOUBLE_FREE));
+}
+
+TEST_F(MemPool_test, GetChunkIndicesMethodObtainsChunksWhichAreReturnedWithFreeChunkIndices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c7e0b5a2-61f4-4d93-8b2e-f4a19d3c07e6");
+    constexpr uint32_t NUMBER_OF_REQUESTED_CHUNKS{10U};
+    std::vector<uint32_t> chunkIndices(NUMBER_OF_REQUESTED_CHUNKS, 0U);
+
+    EXPECT_THAT(sut.getChunkIndices(chunkIndices.data(), NUMBER_OF_REQUESTED_CHUNKS), Eq(NUMBER_OF_REQUESTED_CHUNKS));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_REQUESTED_CHUNKS));
+
+    std::vector<void*> chunks;
+    for (const auto chunkIndex : chunkIndices)
+    {
+        chunks.push_back(sut.chunkOfIndex(chunkIndex));
+    }
+    std::sort(chunks.begin(), chunks.end());
+    EXPECT_THAT(std::adjacent_find(chunks.begin(), chunks.end()), Eq(chunks.end()));
+
+    sut.freeChunkIndices(chunkIndices.data(), NUMBER_OF_REQUESTED_CHUNKS);
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0U));
+}
+
 TEST_F(MemPool_test, dieWhenMempoolChunkSizeIsSmallerThan32Bytes)
 {
     ::testing::Test::RecordProperty("TEST_ID", "7704246e-42b5-46fd-8827-ebac200390e1");
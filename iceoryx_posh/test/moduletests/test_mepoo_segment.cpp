@@ -100,7 +100,14 @@ class MePooSegment_test : public Test
             return m_baseAddressHint;
         }
 
+        iox::cxx::expected<SharedMemoryObjectError> lockInMemory()
+        {
+            isLockedInMemory = true;
+            return iox::cxx::success<void>();
+        }
+
         uint64_t m_memorySizeInBytes{0};
+        bool isLockedInMemory{false};
         void* m_baseAddressHint{nullptr};
         static constexpr int MEM_SIZE = 100000;
         char memory[MEM_SIZE];
@@ -123,9 +130,21 @@ class MePooSegment_test : public Test
 
         IOX_BUILDER_PARAMETER(iox::cxx::perms, permissions, iox::cxx::perms::none)
 
+        IOX_BUILDER_PARAMETER(SharedMemory::Directory_t, directory, "")
+
+        IOX_BUILDER_PARAMETER(iox::posix::NumaPolicy, numaPolicy, iox::posix::NumaPolicy())
+
+        IOX_BUILDER_PARAMETER(iox::posix::PrefaultStrategy, prefaultStrategy, iox::posix::PrefaultStrategy::ZERO)
+
       public:
         iox::cxx::expected<SharedMemoryObject_MOCK, SharedMemoryObjectError> create() noexcept
         {
+            lastNumaPolicy = m_numaPolicy;
+            lastPrefaultStrategy = m_prefaultStrategy;
+            if (!m_directory.empty() && !areHugePagesAvailable)
+            {
+                return iox::cxx::error<SharedMemoryObjectError>(SharedMemoryObjectError::SHARED_MEMORY_CREATION_FAILED);
+            }
             return iox::cxx::success<SharedMemoryObject_MOCK>(
                 SharedMemoryObject_MOCK(m_name,
                                         m_memorySizeInBytes,
@@ -134,6 +153,10 @@ class MePooSegment_test : public Test
                                         (m_baseAddressHint) ? *m_baseAddressHint : nullptr,
                                         m_permissions));
         }
+
+        static bool areHugePagesAvailable;
+        static iox::posix::NumaPolicy lastNumaPolicy;
+        static iox::posix::PrefaultStrategy lastPrefaultStrategy;
     };
 
 
@@ -156,6 +179,10 @@ class MePooSegment_test : public Test
         mepooConfig, m_managementAllocator, PosixGroup{"iox_roudi_test1"}, PosixGroup{"iox_roudi_test2"}};
 };
 MePooSegment_test::SharedMemoryObject_MOCK::createFct MePooSegment_test::SharedMemoryObject_MOCK::createVerificator;
+bool MePooSegment_test::SharedMemoryObject_MOCKBuilder::areHugePagesAvailable{true};
+iox::posix::NumaPolicy MePooSegment_test::SharedMemoryObject_MOCKBuilder::lastNumaPolicy;
+iox::posix::PrefaultStrategy MePooSegment_test::SharedMemoryObject_MOCKBuilder::lastPrefaultStrategy{
+    iox::posix::PrefaultStrategy::ZERO};
 
 TEST_F(MePooSegment_test, SharedMemoryFileHandleRightsAfterConstructor)
 {
@@ -232,4 +259,118 @@ TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(GetMemoryManager))
         .or_else([](auto& error) { GTEST_FAIL() << "getChunk failed with: " << error; });
 }
 
+TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(SegmentWithHugePagesIsAMultipleOfTheHugePageSize))
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e5b850aa-21f5-45a0-b063-e12b0b6e13f7");
+    mepooConfig.m_hugePageSize = MePooConfig::HUGE_PAGE_SIZE_2M;
+    mepooConfig.m_hugePageMount = "/mnt/huge";
+
+    MePooSegment<SharedMemoryObject_MOCK, MemoryManager> sut2{
+        mepooConfig, m_managementAllocator, PosixGroup{"iox_roudi_test1"}, PosixGroup{"iox_roudi_test2"}};
+
+    EXPECT_THAT(sut2.getHugePageMount().c_str(), StrEq("/mnt/huge"));
+    EXPECT_THAT(sut2.getSharedMemoryObject().getSizeInBytes(), Eq(MePooConfig::HUGE_PAGE_SIZE_2M));
+}
+
+TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(SegmentFallsBackToRegularPagesWithoutHugePages))
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fced4805-0571-4f81-b91c-ed6cf32c9733");
+    mepooConfig.m_hugePageSize = MePooConfig::HUGE_PAGE_SIZE_2M;
+    SharedMemoryObject_MOCKBuilder::areHugePagesAvailable = false;
+
+    MePooSegment<SharedMemoryObject_MOCK, MemoryManager> sut2{
+        mepooConfig, m_managementAllocator, PosixGroup{"iox_roudi_test1"}, PosixGroup{"iox_roudi_test2"}};
+    SharedMemoryObject_MOCKBuilder::areHugePagesAvailable = true;
+
+    EXPECT_TRUE(sut2.getHugePageMount().empty());
+    EXPECT_THAT(sut2.getSharedMemoryObject().getSizeInBytes(), Eq(MemoryManager::requiredChunkMemorySize(mepooConfig)));
+}
+
+TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(SegmentIsCreatedWithTheNumaPolicyOfTheConfig))
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b9771d5b-48ca-40e9-ba1f-bb9af6b9da68");
+    mepooConfig.m_numaPolicy = {iox::posix::NumaPolicy::Mode::INTERLEAVE, 0b101U};
+
+    MePooSegment<SharedMemoryObject_MOCK, MemoryManager> sut2{
+        mepooConfig, m_managementAllocator, PosixGroup{"iox_roudi_test1"}, PosixGroup{"iox_roudi_test2"}};
+
+    EXPECT_THAT(SharedMemoryObject_MOCKBuilder::lastNumaPolicy.mode, Eq(iox::posix::NumaPolicy::Mode::INTERLEAVE));
+    EXPECT_THAT(SharedMemoryObject_MOCKBuilder::lastNumaPolicy.nodeMask, Eq(0b101U));
+}
+
+TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(SegmentIsCreatedWithThePrefaultStrategyOfTheConfig))
+{
+    ::testing::Test::RecordProperty("TEST_ID", "44e109aa-22f7-4a6b-84f0-af358d6f72bc");
+    mepooConfig.m_prefaultStrategy = iox::posix::PrefaultStrategy::PARALLEL_ZERO;
+
+    MePooSegment<SharedMemoryObject_MOCK, MemoryManager> sut2{
+        mepooConfig, m_managementAllocator, PosixGroup{"iox_roudi_test1"}, PosixGroup{"iox_roudi_test2"}};
+
+    EXPECT_THAT(SharedMemoryObject_MOCKBuilder::lastPrefaultStrategy,
+                Eq(iox::posix::PrefaultStrategy::PARALLEL_ZERO));
+}
+
+TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(SegmentIsNotLockedInMemoryByDefault))
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0c5b8d1f-7e2a-4b9c-9f3d-6a1e4c8b2d57");
+    MePooSegment<SharedMemoryObject_MOCK, MemoryManager> sut2{
+        mepooConfig, m_managementAllocator, PosixGroup{"iox_roudi_test1"}, PosixGroup{"iox_roudi_test2"}};
+
+    EXPECT_FALSE(sut2.isLockedInMemory());
+    EXPECT_FALSE(sut2.getSharedMemoryObject().isLockedInMemory);
+}
+
+TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(SegmentIsLockedInMemoryWhenConfigured))
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d3a7f2e6-19b4-4c5e-8a0d-57e2b9c16f48");
+    mepooConfig.m_lockInMemory = true;
+
+    MePooSegment<SharedMemoryObject_MOCK, MemoryManager> sut2{
+        mepooConfig, m_managementAllocator, PosixGroup{"iox_roudi_test1"}, PosixGroup{"iox_roudi_test2"}};
+
+    EXPECT_TRUE(sut2.isLockedInMemory());
+    EXPECT_TRUE(sut2.getSharedMemoryObject().isLockedInMemory);
+}
+
+TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(ExtendAddsTheMemPoolsWithAnAdditionalSharedMemoryObject))
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7f2d9a41-c8e3-4b06-a5d7-2e9b1c4f8063");
+    mepooConfig.m_maxNumberOfExtensionChunks = 10U;
+    MePooSegment<SharedMemoryObject_MOCK, MemoryManager> sut2{
+        mepooConfig, m_managementAllocator, PosixGroup{"iox_roudi_test1"}, PosixGroup{"iox_roudi_test2"}};
+    MePooConfig extensionConfig;
+    extensionConfig.addMemPool({256, 10});
+    std::string extensionName;
+    MePooSegment_test::SharedMemoryObject_MOCK::createVerificator = [&](const SharedMemory::Name_t f_name,
+                                                                        const uint64_t,
+                                                                        const iox::posix::AccessMode,
+                                                                        const iox::posix::OpenMode,
+                                                                        const void*,
+                                                                        const iox::cxx::perms) {
+        extensionName = f_name.c_str();
+    };
+
+    auto result = sut2.extend(extensionConfig);
+    MePooSegment_test::SharedMemoryObject_MOCK::createVerificator =
+        MePooSegment_test::SharedMemoryObject_MOCK::createFct();
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(extensionName, Eq(std::string("iox_roudi_test2.ext1")));
+    ASSERT_THAT(sut2.getNumberOfExtensions(), Eq(1U));
+    EXPECT_THAT(sut2.getMemoryManager().getNumberOfMemPools(), Eq(2U));
+}
+
+TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(ExtendWithoutReservedExtensionChunksFails))
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c41e8b07-5a92-4f3d-8e6c-b0d27a9f1e54");
+    MePooConfig extensionConfig;
+    extensionConfig.addMemPool({256, 10});
+
+    auto result = sut.extend(extensionConfig);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(SegmentExtensionError::CHUNK_LIMIT_EXCEEDED));
+    EXPECT_THAT(sut.getNumberOfExtensions(), Eq(0U));
+}
+
 } // namespace
@@ -24,11 +24,14 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "test.hpp"
 
+#include <functional>
 #include <memory>
+#include <vector>
 
 namespace
 {
@@ -126,6 +129,31 @@ constexpr std::chrono::milliseconds ChunkDistributor_test<PolicyType>::BLOCKING_
 template <typename PolicyType>
 constexpr iox::units::Duration ChunkDistributor_test<PolicyType>::DEADLOCK_TIMEOUT;
 
+/// @brief runs a callback before the next chunk is pushed, this way chunks can be sent while the history is replayed
+template <typename ChunkQueueDataType>
+class ChunkQueuePusherWithPushHook : public ChunkQueuePusher<ChunkQueueDataType>
+{
+  public:
+    using Base_t = ChunkQueuePusher<ChunkQueueDataType>;
+    using Base_t::Base_t;
+    using Base_t::push;
+
+    bool push(SharedChunk chunk) noexcept
+    {
+        if (onNextPush)
+        {
+            auto callback = std::move(onNextPush);
+            onNextPush = nullptr;
+            callback();
+        }
+        return Base_t::push(chunk);
+    }
+
+    static std::function<void()> onNextPush;
+};
+template <typename ChunkQueueDataType>
+std::function<void()> ChunkQueuePusherWithPushHook<ChunkQueueDataType>::onNextPush;
+
 /// @todo iox-#898: this is broken on macOS and triggers the watchdog, even with 5 seconds timeout
 #if !defined(__APPLE__)
 TYPED_TEST(ChunkDistributor_test, AddingNullptrQueueDoesNotWork)
@@ -223,7 +251,7 @@ TYPED_TEST(ChunkDistributor_test, RemoveAllQueuesWhenContainingOne)
 
     auto queueData = this->getChunkQueueData();
     ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
-    sut.removeAllQueues();
+    EXPECT_FALSE(sut.removeAllQueues().has_error());
 
     EXPECT_THAT(sut.hasStoredQueues(), Eq(false));
 }
@@ -238,7 +266,7 @@ TYPED_TEST(ChunkDistributor_test, RemoveAllQueuesWhenContainingMultipleQueues)
     ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
     auto queueData2 = this->getChunkQueueData();
     ASSERT_FALSE(sut.tryAddQueue(queueData2.get()).has_error());
-    sut.removeAllQueues();
+    EXPECT_FALSE(sut.removeAllQueues().has_error());
 
     EXPECT_THAT(sut.hasStoredQueues(), Eq(false));
 }
@@ -642,6 +670,47 @@ TYPED_TEST(ChunkDistributor_test, DeliverToQueueWithBlockingOptionBlocksDelivery
 }
 
 
+TYPED_TEST(ChunkDistributor_test, DeliverToQueueStopsWaitingWhenTheBlockingQueueIsRemoved)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d0965794-aa98-4aa6-96cb-2c56262f6ccf");
+    constexpr uint32_t EXPECTED_QUEUE_INDEX{0U};
+    using ChunkQueueData_t = typename TestFixture::ChunkQueueData_t;
+
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    for (uint64_t i = 0; i < ChunkQueueData_t::MAX_CAPACITY; ++i)
+    {
+        auto chunk = this->allocateChunk(i);
+        ASSERT_FALSE(sut.deliverToQueue(queueData->m_uniqueId, EXPECTED_QUEUE_INDEX, chunk).has_error());
+    }
+
+    Barrier isThreadStarted(1U);
+    auto chunk = this->allocateChunk(7373);
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        auto result = sut.deliverToQueue(queueData->m_uniqueId, EXPECTED_QUEUE_INDEX, chunk);
+        ASSERT_TRUE(result.has_error());
+        EXPECT_THAT(result.get_error(), Eq(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER));
+    });
+
+    isThreadStarted.wait();
+
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    // the waiting sender does not block changes of the queues
+    auto anotherQueueData = this->getChunkQueueData();
+    EXPECT_FALSE(sut.tryAddQueue(anotherQueueData.get()).has_error());
+    EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+
+    t1.join();
+    ChunkQueuePopper<ChunkQueueData_t> queue(queueData.get());
+    EXPECT_THAT(queue.size(), Eq(ChunkQueueData_t::MAX_CAPACITY));
+}
+
 TYPED_TEST(ChunkDistributor_test, DeliverHistoryOnAddWithLessThanAvailable)
 {
     ::testing::Test::RecordProperty("TEST_ID", "faff7ece-c84b-4455-bb12-c83792056e98");
@@ -724,6 +793,251 @@ TYPED_TEST(ChunkDistributor_test, DeliverHistoryOnAddWithMoreThanAvailable)
     EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(3u));
 }
 
+TYPED_TEST(ChunkDistributor_test, HistoryKeepsNewestChunksInOrderWhenOldestAreEvicted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "92a47f01-c2b3-453d-a672-29166a616179");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t NUMBER_OF_EVICTED_CHUNKS{5U};
+    const uint64_t numberOfChunks = this->HISTORY_SIZE + NUMBER_OF_EVICTED_CHUNKS;
+    for (uint64_t i = 0U; i < numberOfChunks; ++i)
+    {
+        sut.addToHistoryWithoutDelivery(this->allocateChunk(i));
+    }
+
+    EXPECT_THAT(sut.getHistorySize(), Eq(this->HISTORY_SIZE));
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(this->HISTORY_SIZE));
+
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), this->HISTORY_SIZE).has_error());
+
+    EXPECT_THAT(queue.size(), Eq(this->HISTORY_SIZE));
+    for (uint64_t i = NUMBER_OF_EVICTED_CHUNKS; i < numberOfChunks; ++i)
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i));
+    }
+}
+
+TYPED_TEST(ChunkDistributor_test, QueueAddedWhileSendingGetsHistoryAndNewChunksWithoutGapsInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1e36e49b-269c-4d73-b8cd-4e7745cb944b");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{100U};
+    Barrier isSending(1U);
+    std::thread sender([&] {
+        for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+        {
+            sut.deliverToAllStoredQueues(this->allocateChunk(i));
+            if (i == this->HISTORY_SIZE)
+            {
+                isSending.notify();
+            }
+        }
+    });
+
+    isSending.wait();
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), this->HISTORY_SIZE).has_error());
+    sender.join();
+
+    // every chunk after the first received one must have arrived in order without gaps
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    uint64_t expectedValue = this->getSharedChunkValue(*maybeSharedChunk) + 1U;
+    while ((maybeSharedChunk = queue.tryPop()).has_value())
+    {
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(expectedValue));
+        ++expectedValue;
+    }
+    EXPECT_THAT(expectedValue, Eq(NUMBER_OF_CHUNKS));
+}
+
+TYPED_TEST(ChunkDistributor_test, QueueGetsAllChunksSentWhileTheRequestedHistoryIsReplayed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f8b6d2e-71c4-4a95-8e0d-c5a2b7f91e46");
+    using ChunkQueueData_t = typename TestFixture::ChunkQueueData_t;
+    using Pusher_t = ChunkQueuePusherWithPushHook<ChunkQueueData_t>;
+    using ChunkDistributorData_t =
+        ChunkDistributorData<typename TestFixture::ChunkDistributorConfig, TypeParam, Pusher_t>;
+    auto sutData =
+        std::make_shared<ChunkDistributorData_t>(ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, this->HISTORY_SIZE);
+    ChunkDistributor<ChunkDistributorData_t> sut(sutData.get());
+
+    constexpr uint64_t REQUESTED_HISTORY{2U};
+    constexpr uint64_t NUMBER_OF_CHUNKS_SENT_DURING_REPLAY{5U};
+    constexpr uint64_t NUMBER_OF_CHUNKS{REQUESTED_HISTORY + NUMBER_OF_CHUNKS_SENT_DURING_REPLAY};
+    for (uint64_t i = 0U; i < REQUESTED_HISTORY; ++i)
+    {
+        sut.addToHistoryWithoutDelivery(this->allocateChunk(i));
+    }
+
+    Pusher_t::onNextPush = [&] {
+        for (uint64_t i = REQUESTED_HISTORY; i < NUMBER_OF_CHUNKS; ++i)
+        {
+            sut.deliverToAllStoredQueues(this->allocateChunk(i));
+        }
+    };
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), REQUESTED_HISTORY).has_error());
+    EXPECT_FALSE(Pusher_t::onNextPush);
+
+    ChunkQueuePopper<ChunkQueueData_t> queue(queueData.get());
+    EXPECT_THAT(queue.size(), Eq(NUMBER_OF_CHUNKS));
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i));
+    }
+}
+
+TYPED_TEST(ChunkDistributor_test, DecimatedQueueGetsOnlyEveryNthChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5c0e7a3d-8f61-4b2e-9d47-a1b36c2f0e84");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t DECIMATION{3U};
+    auto decimatedQueueData = this->getChunkQueueData();
+    decimatedQueueData->m_decimation = DECIMATION;
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(decimatedQueueData.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U * DECIMATION};
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        sut.deliverToAllStoredQueues(this->allocateChunk(i));
+    }
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> decimatedQueue(decimatedQueueData.get());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    EXPECT_THAT(decimatedQueue.size(), Eq(NUMBER_OF_CHUNKS / DECIMATION));
+    EXPECT_THAT(queue.size(), Eq(NUMBER_OF_CHUNKS));
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; i += DECIMATION)
+    {
+        auto maybeSharedChunk = decimatedQueue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i));
+    }
+    EXPECT_FALSE(decimatedQueue.hasLostChunks());
+}
+
+TYPED_TEST(ChunkDistributor_test, QueueWhichDroppedTheChunkByDecimationIsNotCountedAsDelivered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c71e4f08-2d95-4b3a-8a6e-0f5b19d3e2a7");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t DECIMATION{3U};
+    auto decimatedQueueData = this->getChunkQueueData();
+    decimatedQueueData->m_decimation = DECIMATION;
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(decimatedQueueData.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(0U)), Eq(2U));
+    for (uint64_t i = 1U; i < DECIMATION; ++i)
+    {
+        EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(i)), Eq(1U));
+    }
+
+    vector<SharedChunk, DECIMATION - 1U> chunksWhichAreAllDropped;
+    for (uint64_t i = 0U; i < DECIMATION - 1U; ++i)
+    {
+        chunksWhichAreAllDropped.emplace_back(this->allocateChunk(i));
+    }
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(DECIMATION)), Eq(2U));
+    EXPECT_THAT(sut.deliverToAllStoredQueues(chunksWhichAreAllDropped), Eq(1U));
+}
+
+TYPED_TEST(ChunkDistributor_test, CleanupReleasesOnlyTheNotifierOfTheDeadProducer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8d2f6b14-3c7e-4a59-b0e1-95f4c2a7d063");
+    auto deadProducerData = this->getChunkDistributorData();
+    auto liveProducerData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t deadProducer(deadProducerData.get());
+    typename TestFixture::ChunkDistributor_t liveProducer(liveProducerData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(deadProducer.tryAddQueue(queueData.get()).has_error());
+    ASSERT_FALSE(liveProducer.tryAddQueue(queueData.get()).has_error());
+
+    // both producers are in the middle of a notification, one of them died there
+    const auto deadNotifierId = static_cast<uint64_t>(deadProducerData->m_notifierId);
+    const auto liveNotifierId = static_cast<uint64_t>(liveProducerData->m_notifierId);
+    queueData->m_activeNotifiers[0U].store(deadNotifierId);
+    queueData->m_activeNotifiers[1U].store(liveNotifierId);
+
+    deadProducer.cleanup();
+
+    EXPECT_THAT(queueData->m_activeNotifiers[0U].load(), Eq(0U));
+    EXPECT_THAT(queueData->m_activeNotifiers[1U].load(), Eq(liveNotifierId));
+}
+
+TYPED_TEST(ChunkDistributor_test, CleanupReleasesOnlyTheWaitingSlotOfTheDeadProducer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "23d985f3-0097-4953-9256-61b0ee2576de");
+    auto deadProducerData = this->getChunkDistributorData();
+    auto liveProducerData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t deadProducer(deadProducerData.get());
+    typename TestFixture::ChunkDistributor_t liveProducer(liveProducerData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(deadProducer.tryAddQueue(queueData.get()).has_error());
+    ASSERT_FALSE(liveProducer.tryAddQueue(queueData.get()).has_error());
+
+    // both producers wait for free space in the queue, one of them died there
+    const auto deadNotifierId = static_cast<uint64_t>(deadProducerData->m_notifierId);
+    const auto liveNotifierId = static_cast<uint64_t>(liveProducerData->m_notifierId);
+    queueData->m_waitingProducers[0U].store(deadNotifierId);
+    queueData->m_waitingProducers[1U].store(liveNotifierId);
+
+    deadProducer.cleanup();
+
+    EXPECT_THAT(queueData->m_waitingProducers[0U].load(), Eq(0U));
+    EXPECT_THAT(queueData->m_waitingProducers[1U].load(), Eq(liveNotifierId));
+}
+
+TYPED_TEST(ChunkDistributor_test, RateLimitedQueueDoesNotGetNorIsNotifiedAboutChunksArrivingTooEarly)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b83f2d16-4c9a-4e05-a7f1-6d2e90c5b317");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    queueData->m_minimumPushIntervalNs = iox::units::Duration::fromHours(1U).toNanoseconds();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    ConditionVariableData conditionVariableData("Horscht");
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setConditionVariable(conditionVariableData, 0U);
+    ConditionListener listener(conditionVariableData);
+
+    constexpr uint64_t FIRST_CHUNK_VALUE{42U};
+    sut.deliverToAllStoredQueues(this->allocateChunk(FIRST_CHUNK_VALUE));
+    EXPECT_THAT(listener.timedWait(iox::units::Duration::zero()).size(), Eq(1U));
+
+    constexpr uint64_t NUMBER_OF_CHUNKS_ARRIVING_TOO_EARLY{10U};
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS_ARRIVING_TOO_EARLY; ++i)
+    {
+        sut.deliverToAllStoredQueues(this->allocateChunk(i));
+    }
+
+    EXPECT_TRUE(listener.timedWait(iox::units::Duration::zero()).empty());
+    EXPECT_THAT(queue.size(), Eq(1U));
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(FIRST_CHUNK_VALUE));
+}
+
 TYPED_TEST(ChunkDistributor_test, DeliverToSingleQueueBlocksWhenOptionsAreSetToBlocking)
 {
     ::testing::Test::RecordProperty("TEST_ID", "c0500dec-bbd8-4958-9545-a14ef68108a1");
@@ -822,4 +1136,300 @@ TYPED_TEST(ChunkDistributor_test, MultipleBlockingQueuesWillBeFilledWhenThereBec
     }
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToAllStoredQueuesDeliversChunksInOrderAndUpdatesHistoryOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fc639181-5cdc-4b88-9e10-8e1274f97187");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData1 = this->getChunkQueueData();
+    auto queueData2 = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData1.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData2.get()).has_error());
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    vector<SharedChunk, NUMBER_OF_CHUNKS> chunks;
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.emplace_back(this->allocateChunk(4711U + i));
+    }
+
+    EXPECT_THAT(sut.deliverToAllStoredQueues(chunks), Eq(2U));
+
+    for (auto& queueData : {queueData1, queueData2})
+    {
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+        for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+        {
+            auto maybeChunk = queue.tryPop();
+            ASSERT_TRUE(maybeChunk.has_value());
+            EXPECT_THAT(this->getSharedChunkValue(*maybeChunk), Eq(4711U + i));
+        }
+        EXPECT_TRUE(queue.empty());
+    }
+    EXPECT_THAT(sut.getHistorySize(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TYPED_TEST(ChunkDistributor_test, ParallelDeliveryToAllStoredQueuesDeliversChunksToEveryQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4d5a3a43-8d3c-4d7e-9a0b-2b7e0fb0c6a1");
+    constexpr uint64_t PARALLEL_DELIVERY_THRESHOLD{1U};
+    auto sutData = std::make_shared<typename TestFixture::ChunkDistributorData_t>(
+        ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, this->HISTORY_SIZE, PARALLEL_DELIVERY_THRESHOLD);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t NUMBER_OF_QUEUES{DeliveryThreadPool::TASK_BLOCK_SIZE * 8U};
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    for (uint64_t i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueData.emplace_back(this->getChunkQueueData());
+        ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    }
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{2U};
+    vector<SharedChunk, NUMBER_OF_CHUNKS> chunks;
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.emplace_back(this->allocateChunk(1337U + i));
+    }
+
+    EXPECT_THAT(sut.deliverToAllStoredQueues(chunks), Eq(NUMBER_OF_QUEUES));
+
+    for (auto& data : queueData)
+    {
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(data.get());
+        for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+        {
+            auto maybeChunk = queue.tryPop();
+            ASSERT_TRUE(maybeChunk.has_value());
+            EXPECT_THAT(this->getSharedChunkValue(*maybeChunk), Eq(1337U + i));
+        }
+        EXPECT_TRUE(queue.empty());
+    }
+    EXPECT_THAT(sut.getHistorySize(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToBlockingQueueDeliversRemainingChunksWhenSpaceBecomesAvailable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "118166b1-6c53-4966-94cb-08c4a0b6cebd");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(2U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{4U};
+    vector<SharedChunk, NUMBER_OF_CHUNKS> chunks;
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.emplace_back(this->allocateChunk(42U + i));
+    }
+
+    Barrier isThreadStarted(1U);
+    std::atomic<uint64_t> numberOfDeliveries{0U};
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        numberOfDeliveries = sut.deliverToAllStoredQueues(chunks);
+    });
+
+    isThreadStarted.wait();
+
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        optional<SharedChunk> maybeChunk;
+        while (!(maybeChunk = queue.tryPop()).has_value())
+        {
+            std::this_thread::yield();
+        }
+        EXPECT_THAT(this->getSharedChunkValue(*maybeChunk), Eq(42U + i));
+    }
+
+    t1.join();
+    EXPECT_THAT(numberOfDeliveries.load(), Eq(1U));
+    EXPECT_TRUE(queue.empty());
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWithoutHistoryDoesNotTakeTheLock)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a33d5ecd-d9b8-4e17-9521-691dc4ca3940");
+    auto sutData = std::make_shared<typename TestFixture::ChunkDistributorData_t>(
+        ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, 0U);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    Barrier isLockAcquired(1U);
+    Barrier isChunkDelivered(1U);
+    std::thread lockingThread([&] {
+        sutData->lock();
+        isLockAcquired.notify();
+        isChunkDelivered.wait();
+        sutData->unlock();
+    });
+
+    isLockAcquired.wait();
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(4242U)), Eq(1U));
+    EXPECT_TRUE(sut.hasStoredQueues());
+    isChunkDelivered.notify();
+
+    lockingThread.join();
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(4242U));
+}
+
+TYPED_TEST(ChunkDistributor_test, RemoveQueueWaitsUntilTheQueueSnapshotIsReleased)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "69b6365a-5815-4379-ba15-277922e0135d");
+    using ChunkDistributor_t = typename TestFixture::ChunkDistributor_t;
+    class ChunkDistributorSnapshotAccess : public ChunkDistributor_t
+    {
+      public:
+        explicit ChunkDistributorSnapshotAccess(typename ChunkDistributor_t::MemberType_t* const data)
+            : ChunkDistributor_t(data)
+        {
+        }
+        using ChunkDistributor_t::acquireQueueSnapshot;
+        using ChunkDistributor_t::releaseQueueSnapshot;
+    };
+
+    auto sutData = this->getChunkDistributorData();
+    ChunkDistributorSnapshotAccess sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    const auto snapshotVersion = sut.acquireQueueSnapshot();
+
+    Barrier isThreadStarted(1U);
+    std::atomic_bool wasQueueRemoved{false};
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+        wasQueueRemoved = true;
+    });
+
+    isThreadStarted.wait();
+
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_THAT(wasQueueRemoved.load(), Eq(false));
+
+    sut.releaseQueueSnapshot(snapshotVersion);
+
+    t1.join(); // join needs to be before the load to ensure the wasQueueRemoved store happens before the read
+    EXPECT_THAT(wasQueueRemoved.load(), Eq(true));
+    EXPECT_FALSE(sut.hasStoredQueues());
+}
+
+TYPED_TEST(ChunkDistributor_test, RemoveQueueDoesNotWaitForTheSnapshotOfADeadSenderAfterItsRegistrationsWereReleased)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f1b3e07a-0c79-4f55-9c1c-9f179e3ff5f5");
+    using ChunkDistributor_t = typename TestFixture::ChunkDistributor_t;
+    class ChunkDistributorSnapshotAccess : public ChunkDistributor_t
+    {
+      public:
+        explicit ChunkDistributorSnapshotAccess(typename ChunkDistributor_t::MemberType_t* const data)
+            : ChunkDistributor_t(data)
+        {
+        }
+        using ChunkDistributor_t::acquireQueueSnapshot;
+    };
+
+    auto sutData = this->getChunkDistributorData();
+    ChunkDistributorSnapshotAccess sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    // the sender dies while it is registered as reader of the snapshot
+    sut.acquireQueueSnapshot();
+    sut.releaseSenderRegistrations();
+
+    EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    EXPECT_FALSE(sut.hasStoredQueues());
+}
+
+TYPED_TEST(ChunkDistributor_test, RemoveQueueIsPostponedWhileTheSenderDoesNotReleaseTheQueueSnapshot)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "627a9dac-f263-4370-a5d1-cccbdc27200f");
+    using ChunkDistributor_t = typename TestFixture::ChunkDistributor_t;
+    class ChunkDistributorSnapshotAccess : public ChunkDistributor_t
+    {
+      public:
+        explicit ChunkDistributorSnapshotAccess(typename ChunkDistributor_t::MemberType_t* const data)
+            : ChunkDistributor_t(data)
+        {
+        }
+        using ChunkDistributor_t::acquireQueueSnapshot;
+        using ChunkDistributor_t::releaseQueueSnapshot;
+    };
+
+    auto sutData = this->getChunkDistributorData();
+    ChunkDistributorSnapshotAccess sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    auto otherQueueData = this->getChunkQueueData();
+
+    const auto snapshotVersion = sut.acquireQueueSnapshot();
+
+    // the removal gives up on the sender, the queue does not get new chunks but must stay alive
+    auto ret = sut.tryRemoveQueue(queueData.get());
+    ASSERT_TRUE(ret.has_error());
+    EXPECT_THAT(ret.get_error(), Eq(iox::popo::ChunkDistributorError::SENDER_STILL_REGISTERED));
+    EXPECT_FALSE(sut.hasStoredQueues());
+
+    // the previous snapshot must not be overwritten by another change as long as the sender uses it
+    ret = sut.tryAddQueue(otherQueueData.get());
+    ASSERT_TRUE(ret.has_error());
+    EXPECT_THAT(ret.get_error(), Eq(iox::popo::ChunkDistributorError::SENDER_STILL_REGISTERED));
+    EXPECT_FALSE(sut.hasStoredQueues());
+
+    sut.releaseQueueSnapshot(snapshotVersion);
+
+    EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    ret = sut.tryRemoveQueue(queueData.get());
+    ASSERT_TRUE(ret.has_error());
+    EXPECT_THAT(ret.get_error(), Eq(iox::popo::ChunkDistributorError::QUEUE_NOT_IN_CONTAINER));
+    EXPECT_FALSE(sut.tryAddQueue(otherQueueData.get()).has_error());
+    EXPECT_TRUE(sut.hasStoredQueues());
+}
+
+TYPED_TEST(ChunkDistributor_test, BlockingDeliveryStopsWhenQueueIsRemoved)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9cb35a50-4fb2-40b1-b82d-c4a07a1df111");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(155U));
+
+    Barrier isThreadStarted(1U);
+    std::atomic<uint64_t> numberOfDeliveries{1U};
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        numberOfDeliveries = sut.deliverToAllStoredQueues(this->allocateChunk(152U));
+    });
+
+    isThreadStarted.wait();
+
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+
+    t1.join();
+    EXPECT_THAT(numberOfDeliveries.load(), Eq(0U));
+    EXPECT_THAT(queue.size(), Eq(1U));
+}
+
 } // namespace
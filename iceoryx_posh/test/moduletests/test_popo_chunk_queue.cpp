@@ -28,6 +28,10 @@
 
 #include "test.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 namespace
 {
 using namespace ::testing;
@@ -113,6 +117,31 @@ TYPED_TEST(ChunkQueue_test, InitialConditionVariableAttached)
     EXPECT_THAT(this->m_popper.isConditionVariableSet(), Eq(false));
 }
 
+TYPED_TEST(ChunkQueue_test, MembersWrittenByDifferentSidesDoNotShareACacheLine)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f9d6b8e-21a4-4c7f-b05e-8e4a17d2c963");
+    using ChunkQueueData_t = typename ChunkQueue_test<TypeParam>::ChunkQueueData_t;
+    using iox::concurrent::isSeparatedByCacheLine;
+
+    // ChunkQueueData has no standard layout due to the locking policy, therefore the layout is not checked with
+    // offsetof in a static_assert
+    auto& data = this->m_chunkData;
+    auto offsetOf = [&](const void* member) {
+        return static_cast<uint64_t>(static_cast<const uint8_t*>(member) - reinterpret_cast<const uint8_t*>(&data));
+    };
+
+    EXPECT_TRUE(isSeparatedByCacheLine(
+        offsetOf(&data.m_isConditionVariablePublished) + sizeof(data.m_isConditionVariablePublished),
+        offsetOf(&data.m_queue)));
+    EXPECT_TRUE(isSeparatedByCacheLine(offsetOf(&data.m_queue) + sizeof(data.m_queue),
+                                       offsetOf(&data.m_queueHasLostChunks)));
+    EXPECT_TRUE(isSeparatedByCacheLine(offsetOf(&data.m_waitingProducers) + sizeof(data.m_waitingProducers),
+                                       offsetOf(&data.m_latestChunk)));
+    EXPECT_TRUE(
+        isSeparatedByCacheLine(offsetOf(&data.m_spaceAvailableSemaphore) + sizeof(data.m_spaceAvailableSemaphore),
+                               sizeof(ChunkQueueData_t)));
+}
+
 TYPED_TEST(ChunkQueue_test, UniqueIdIsMonotonicallyIncreasing)
 {
     ::testing::Test::RecordProperty("TEST_ID", "e984db40-b43c-4a32-8fda-9618a1c1eecd");
@@ -264,6 +293,112 @@ TYPED_TEST(ChunkQueue_test, AttachSecondConditionVariable)
     EXPECT_THAT(condVarWaiter2.timedWait(1_ms).empty(), Eq(false));
 }
 
+TYPED_TEST(ChunkQueue_test, PushAfterDetachingConditionVariableDoesNotNotify)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a7e76bdb-0a61-4eb0-8051-1d890310c1c3");
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+
+    this->m_popper.setConditionVariable(condVar, 0U);
+    this->m_popper.unsetConditionVariable();
+
+    auto chunk = this->allocateChunk();
+    this->m_pusher.push(chunk);
+
+    EXPECT_THAT(this->m_popper.isConditionVariableSet(), Eq(false));
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(true));
+}
+
+TYPED_TEST(ChunkQueue_test, ConditionVariableCanBeAttachedAndDetachedWhilePushing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "62972f34-6517-404b-97cf-4f42821e55c8");
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+    auto chunk = this->allocateChunk();
+
+    std::atomic_bool keepPushing{true};
+    std::thread pusher([&] {
+        while (keepPushing.load())
+        {
+            // the queue overflows, only the notify path is of interest here
+            this->m_pusher.push(chunk);
+        }
+    });
+
+    constexpr uint64_t NUMBER_OF_REATTACHMENTS{1000U};
+    for (uint64_t i = 0U; i < NUMBER_OF_REATTACHMENTS; ++i)
+    {
+        this->m_popper.setConditionVariable(condVar, i % iox::MAX_NUMBER_OF_NOTIFIERS);
+        this->m_popper.unsetConditionVariable();
+    }
+    keepPushing.store(false);
+    pusher.join();
+
+    // drain what was notified while the condition variable was attached
+    condVarWaiter.timedWait(1_ns);
+    this->m_popper.setConditionVariable(condVar, 0U);
+    this->m_pusher.push(chunk);
+    auto notifications = condVarWaiter.timedWait(1_s);
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_THAT(notifications[0U], Eq(0U));
+}
+
+TYPED_TEST(ChunkQueue_test, DetachingConditionVariableWaitsUntilTheNotifierOfADeadProducerIsReleased)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3b8f0e4c-6a2d-4d71-9c55-0f1e7d2a9b48");
+    using ChunkQueueData_t = typename TestFixture::ChunkQueueData_t;
+    ConditionVariableData condVar("Horscht");
+    this->m_popper.setConditionVariable(condVar, 0U);
+
+    // a producer which died while notifying never leaves its slot
+    constexpr uint64_t DEAD_NOTIFIER_ID{42U};
+    this->m_chunkData.m_activeNotifiers[0U].store(DEAD_NOTIFIER_ID);
+
+    std::atomic_bool isDetached{false};
+    std::thread consumer([&] {
+        this->m_popper.unsetConditionVariable();
+        isDetached.store(true);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_FALSE(isDetached.load());
+
+    ChunkQueuePusher<ChunkQueueData_t>(&this->m_chunkData).releaseNotifier(DEAD_NOTIFIER_ID);
+    consumer.join();
+
+    EXPECT_TRUE(isDetached.load());
+    EXPECT_THAT(this->m_popper.isConditionVariableSet(), Eq(false));
+}
+
+TYPED_TEST(ChunkQueue_test, ReleasingTheNotifierOfADeadProducerKeepsTheNotifiersOfTheOtherProducers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c41d92a7-5e83-4f0b-8a6e-2d7b9f13e605");
+    using ChunkQueueData_t = typename TestFixture::ChunkQueueData_t;
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+    constexpr uint64_t DEAD_NOTIFIER_ID{42U};
+    constexpr uint64_t LIVE_NOTIFIER_ID{73U};
+    this->m_chunkData.m_activeNotifiers[0U].store(DEAD_NOTIFIER_ID);
+    this->m_chunkData.m_activeNotifiers[1U].store(LIVE_NOTIFIER_ID);
+
+    ChunkQueuePusher<ChunkQueueData_t>(&this->m_chunkData).releaseNotifier(DEAD_NOTIFIER_ID);
+
+    EXPECT_THAT(this->m_chunkData.m_activeNotifiers[0U].load(), Eq(0U));
+    EXPECT_THAT(this->m_chunkData.m_activeNotifiers[1U].load(), Eq(LIVE_NOTIFIER_ID));
+
+    // the condition variable can be attached as soon as the live producer left the notification
+    this->m_chunkData.m_activeNotifiers[1U].store(0U);
+    this->m_popper.setConditionVariable(condVar, 0U);
+    ChunkQueuePusher<ChunkQueueData_t>(&this->m_chunkData, LIVE_NOTIFIER_ID).push(this->allocateChunk());
+    auto notifications = condVarWaiter.timedWait(1_s);
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_THAT(notifications[0U], Eq(0U));
+    for (auto& slot : this->m_chunkData.m_activeNotifiers)
+    {
+        EXPECT_THAT(slot.load(), Eq(0U));
+    }
+}
+
 /// @note this could be changed to a parameterized ChunkQueueSaturatingFIFO_test when there are more FIFOs available
 using ChunkQueueFiFoTestSubjects = Types<ThreadSafePolicy, SingleThreadedPolicy>;
 
@@ -282,6 +417,19 @@ class ChunkQueueFiFo_test : public Test, public ChunkQueue_testBase
                                  iox::cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer};
     ChunkQueuePopper<ChunkQueueData_t> m_popper{&m_chunkData};
     ChunkQueuePusher<ChunkQueueData_t> m_pusher{&m_chunkData};
+
+    ChunkQueueData_t m_blockingChunkData{QueueFullPolicy::BLOCK_PRODUCER,
+                                         iox::cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer};
+    ChunkQueuePopper<ChunkQueueData_t> m_blockingPopper{&m_blockingChunkData};
+    ChunkQueuePusher<ChunkQueueData_t> m_blockingPusher{&m_blockingChunkData};
+
+    void fillBlockingQueue()
+    {
+        for (auto i = 0U; i < iox::MAX_SUBSCRIBER_QUEUE_CAPACITY; ++i)
+        {
+            EXPECT_TRUE(m_blockingPusher.push(allocateChunk()));
+        }
+    }
 };
 
 TYPED_TEST(ChunkQueueFiFo_test, InitialSize)
@@ -328,6 +476,102 @@ TYPED_TEST(ChunkQueueFiFo_test, PushFull)
     EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
 }
 
+TYPED_TEST(ChunkQueueFiFo_test, PushWithTimeoutToFullBlockingQueueFailsAfterTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3ad4a10b-f9e2-4924-b45b-16182b98a97a");
+    this->fillBlockingQueue();
+
+    constexpr auto TIMEOUT = 10_ms;
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(this->m_blockingPusher.push(this->allocateChunk(), TIMEOUT));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_THAT(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count(),
+                Ge(static_cast<int64_t>(TIMEOUT.toMilliseconds())));
+    for (const auto& slot : this->m_blockingChunkData.m_waitingProducers)
+    {
+        EXPECT_THAT(slot.load(), Eq(0U));
+    }
+}
+
+TYPED_TEST(ChunkQueueFiFo_test, PushWithTimeoutToFullBlockingQueueSucceedsWhenConsumerTakesAChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1f6b2d33-4170-4492-b3ae-bec1556522af");
+    this->fillBlockingQueue();
+
+    std::atomic_bool hasPushed{false};
+    std::thread producer([&] {
+        hasPushed = this->m_blockingPusher.push(this->allocateChunk(), iox::units::Duration::fromSeconds(10U));
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(hasPushed.load());
+    EXPECT_TRUE(this->m_blockingPopper.tryPop().has_value());
+
+    producer.join();
+    EXPECT_TRUE(hasPushed.load());
+    EXPECT_THAT(this->m_blockingPopper.size(), Eq(iox::MAX_SUBSCRIBER_QUEUE_CAPACITY));
+}
+
+TYPED_TEST(ChunkQueueFiFo_test, PushWithTimeoutAfterManyTakenChunksWithAWaitingProducerFailsAfterTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "63f679a5-6f45-4d7b-890a-04814aeb57fd");
+    this->fillBlockingQueue();
+
+    std::atomic_bool hasPushed{false};
+    std::thread producer([&] {
+        hasPushed = this->m_blockingPusher.push(this->allocateChunk(), iox::units::Duration::fromSeconds(10U));
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    // only the first taken chunk has a waiting producer, all other chunks must not leave a post behind
+    while (this->m_blockingPopper.tryPop().has_value())
+    {
+    }
+    producer.join();
+    EXPECT_TRUE(hasPushed.load());
+    while (this->m_blockingPusher.push(this->allocateChunk()))
+    {
+    }
+
+    constexpr auto TIMEOUT = 10_ms;
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(this->m_blockingPusher.push(this->allocateChunk(), TIMEOUT));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_THAT(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count(),
+                Ge(static_cast<int64_t>(TIMEOUT.toMilliseconds())));
+}
+
+TYPED_TEST(ChunkQueueFiFo_test, ReleasingTheWaitingProducerOfADeadProducerKeepsTheOtherWaitingProducers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b25ab3f8-3cc8-4edf-8722-66953901e625");
+    constexpr uint64_t DEAD_NOTIFIER_ID{42U};
+    constexpr uint64_t LIVE_NOTIFIER_ID{73U};
+    this->m_blockingChunkData.m_waitingProducers[0U].store(DEAD_NOTIFIER_ID);
+    this->m_blockingChunkData.m_waitingProducers[1U].store(LIVE_NOTIFIER_ID);
+
+    this->m_blockingPusher.releaseWaitingProducer(DEAD_NOTIFIER_ID);
+
+    EXPECT_THAT(this->m_blockingChunkData.m_waitingProducers[0U].load(), Eq(0U));
+    EXPECT_THAT(this->m_blockingChunkData.m_waitingProducers[1U].load(), Eq(LIVE_NOTIFIER_ID));
+}
+
+TYPED_TEST(ChunkQueueFiFo_test, PushWithTimeoutToNonBlockingQueueDoesNotWait)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c74907bc-1819-4164-95da-ac2341875384");
+    for (auto i = 0U; i < iox::MAX_SUBSCRIBER_QUEUE_CAPACITY; ++i)
+    {
+        EXPECT_TRUE(this->m_pusher.push(this->allocateChunk()));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(this->m_pusher.push(this->allocateChunk(), iox::units::Duration::fromSeconds(10U)));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_THAT(std::chrono::duration_cast<std::chrono::seconds>(elapsed).count(), Lt(10));
+}
+
 /// @note this could be changed to a parameterized ChunkQueueOverflowingFIFO_test when there are more FIFOs available
 using ChunkQueueSoFiSubjects = Types<ThreadSafePolicy, SingleThreadedPolicy>;
 
@@ -416,4 +660,122 @@ TYPED_TEST(ChunkQueueSoFi_test, LostChunkInfoIsResetAfterRead)
     EXPECT_FALSE(this->m_popper.hasLostChunks());
 }
 
+
+using ChunkQueueLatestChunkSubjects = Types<ThreadSafePolicy, SingleThreadedPolicy>;
+
+TYPED_TEST_SUITE(ChunkQueueLatestChunk_test, ChunkQueueLatestChunkSubjects, );
+
+template <typename PolicyType>
+class ChunkQueueLatestChunk_test : public Test, public ChunkQueue_testBase
+{
+  public:
+    void SetUp() override{};
+    void TearDown() override{};
+
+    using ChunkQueueData_t = ChunkQueueData<iox::DefaultChunkQueueConfig, PolicyType>;
+
+    static constexpr bool LATEST_CHUNK_ONLY{true};
+    ChunkQueueData_t m_chunkData{QueueFullPolicy::DISCARD_OLDEST_DATA,
+                                 iox::cxx::VariantQueueTypes::SoFi_MultiProducerSingleConsumer,
+                                 LATEST_CHUNK_ONLY};
+    ChunkQueuePopper<ChunkQueueData_t> m_popper{&m_chunkData};
+    ChunkQueuePusher<ChunkQueueData_t> m_pusher{&m_chunkData};
+};
+template <typename PolicyType>
+constexpr bool ChunkQueueLatestChunk_test<PolicyType>::LATEST_CHUNK_ONLY;
+
+TYPED_TEST(ChunkQueueLatestChunk_test, CapacityIsOneAndCannotBeChanged)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "eb41bc8a-e7ec-425d-9b1f-74fdb0fbe4b6");
+    this->m_popper.setCapacity(this->RESIZED_CAPACITY);
+    EXPECT_THAT(this->m_popper.getCurrentCapacity(), Eq(1U));
+}
+
+TYPED_TEST(ChunkQueueLatestChunk_test, PushReplacesTheUntakenChunkAndReleasesIt)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7f8d900f-6642-460d-a418-48e779e7f7b0");
+    EXPECT_TRUE(this->m_pusher.push(this->allocateChunk()));
+    auto latestChunk = this->allocateChunk();
+    auto latestChunkHeader = latestChunk.getChunkHeader();
+    EXPECT_TRUE(this->m_pusher.push(latestChunk));
+    latestChunk = nullptr;
+
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(1U));
+    EXPECT_THAT(this->m_popper.size(), Eq(1U));
+    EXPECT_FALSE(this->m_popper.hasLostChunks());
+
+    auto maybeChunk = this->m_popper.tryPop();
+    ASSERT_TRUE(maybeChunk.has_value());
+    EXPECT_THAT(maybeChunk->getChunkHeader(), Eq(latestChunkHeader));
+    EXPECT_TRUE(this->m_popper.empty());
+}
+
+TYPED_TEST(ChunkQueueLatestChunk_test, TryPopOnEmptySlotReturnsNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "06cc1f49-f4ab-4f1a-9276-cec38cc0698c");
+    EXPECT_TRUE(this->m_popper.empty());
+    EXPECT_THAT(this->m_popper.size(), Eq(0U));
+    EXPECT_FALSE(this->m_popper.tryPop().has_value());
+}
+
+TYPED_TEST(ChunkQueueLatestChunk_test, TryPopManyTakesAtMostTheLatestChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7324073b-c78e-41a8-9a49-25c241328eb6");
+    EXPECT_TRUE(this->m_pusher.push(this->allocateChunk()));
+    EXPECT_TRUE(this->m_pusher.push(this->allocateChunk()));
+
+    iox::cxx::vector<SharedChunk, 4U> chunks;
+    EXPECT_THAT(this->m_popper.tryPopMany(chunks, chunks.capacity()), Eq(1U));
+    EXPECT_THAT(chunks.size(), Eq(1U));
+    EXPECT_THAT(this->m_popper.tryPopMany(chunks, chunks.capacity()), Eq(0U));
+}
+
+TYPED_TEST(ChunkQueueLatestChunk_test, ClearReleasesTheLatestChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ae509e30-31fd-43df-bf27-090298772ddf");
+    EXPECT_TRUE(this->m_pusher.push(this->allocateChunk()));
+
+    this->m_popper.clear();
+
+    EXPECT_TRUE(this->m_popper.empty());
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
+}
+
+TYPED_TEST(ChunkQueueLatestChunk_test, PushWithTimeoutToBlockingQueueDoesNotWait)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "723c1136-ec46-446f-934a-d0168b8e02dd");
+    typename TestFixture::ChunkQueueData_t chunkData{QueueFullPolicy::BLOCK_PRODUCER,
+                                                     iox::cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer,
+                                                     TestFixture::LATEST_CHUNK_ONLY};
+    ChunkQueuePusher<typename TestFixture::ChunkQueueData_t> pusher{&chunkData};
+
+    EXPECT_TRUE(pusher.push(this->allocateChunk(), iox::units::Duration::fromSeconds(10U)));
+    EXPECT_TRUE(pusher.push(this->allocateChunk(), iox::units::Duration::fromSeconds(10U)));
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t>(&chunkData).clear();
+}
+
+TYPED_TEST(ChunkQueueLatestChunk_test, ConcurrentPushAndPopReleasesEveryChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a13e8011-bd45-492f-b683-6a5033c49818");
+    constexpr uint64_t NUMBER_OF_PUSHES{10000U};
+    std::atomic_bool isPushing{true};
+    std::thread producer([&] {
+        for (uint64_t i = 0U; i < NUMBER_OF_PUSHES; ++i)
+        {
+            EXPECT_TRUE(this->m_pusher.push(this->allocateChunk()));
+        }
+        isPushing.store(false);
+    });
+
+    while (isPushing.load())
+    {
+        IOX_DISCARD_RESULT(this->m_popper.tryPop());
+    }
+    producer.join();
+    IOX_DISCARD_RESULT(this->m_popper.tryPop());
+
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
+}
+
 } // namespace
@@ -184,6 +184,60 @@ TEST_F(ChunkReceiver_test, getTooMuchWithoutRelease)
     EXPECT_THAT(maybeChunkHeader.get_error(), Eq(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL));
 }
 
+TEST_F(ChunkReceiver_test, getManyReturnsAtMostMaxNumberOfChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "780e1e26-0db9-4db4-9a27-a0fce22bd789");
+    constexpr uint64_t NUMBER_OF_CHUNKS{5U};
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        ASSERT_TRUE(sharedChunk);
+        new (sharedChunk.getUserPayload()) DummySample();
+        static_cast<DummySample*>(sharedChunk.getUserPayload())->dummy = i;
+        m_chunkQueuePusher.push(sharedChunk);
+    }
+
+    iox::popo::ChunkReceiver<ChunkReceiverData_t>::ChunkHeaderBatch_t chunkHeaders;
+    ASSERT_FALSE(m_chunkReceiver.tryGetMany(chunkHeaders, 3U).has_error());
+    ASSERT_FALSE(m_chunkReceiver.tryGetMany(chunkHeaders, NUMBER_OF_CHUNKS).has_error());
+
+    ASSERT_THAT(chunkHeaders.size(), Eq(NUMBER_OF_CHUNKS));
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        EXPECT_THAT(static_cast<const DummySample*>(chunkHeaders[i]->userPayload())->dummy, Eq(i));
+        m_chunkReceiver.release(chunkHeaders[i]);
+    }
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+
+    auto result = m_chunkReceiver.tryGetMany(chunkHeaders, NUMBER_OF_CHUNKS);
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE));
+}
+
+TEST_F(ChunkReceiver_test, getManyWhenTooManyChunksAreHeldKeepsChunksInQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7c947835-3981-4f8c-b164-d1f738a94293");
+    for (size_t i = 0; i < iox::MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY; i++)
+    {
+        m_chunkQueuePusher.push(getChunkFromMemoryManager());
+        ASSERT_FALSE(m_chunkReceiver.tryGet().has_error());
+    }
+    m_chunkQueuePusher.push(getChunkFromMemoryManager());
+    m_chunkQueuePusher.push(getChunkFromMemoryManager());
+
+    // only the one additional chunk fits into the used chunk list, the other one must stay in the queue
+    iox::popo::ChunkReceiver<ChunkReceiverData_t>::ChunkHeaderBatch_t chunkHeaders;
+    ASSERT_FALSE(m_chunkReceiver.tryGetMany(chunkHeaders, 2U).has_error());
+    EXPECT_THAT(chunkHeaders.size(), Eq(1U));
+
+    auto result = m_chunkReceiver.tryGetMany(chunkHeaders, 2U);
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL));
+    EXPECT_THAT(m_chunkReceiver.size(), Eq(1U));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks,
+                Eq(iox::MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY + 2U));
+}
+
 TEST_F(ChunkReceiver_test, releaseInvalidChunk)
 {
     ::testing::Test::RecordProperty("TEST_ID", "2a47fd0e-a217-4565-98af-05779c938340");
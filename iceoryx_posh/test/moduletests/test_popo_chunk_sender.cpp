@@ -28,6 +28,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_sender.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_sender_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/internal/popo/ports/base_port.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
@@ -394,6 +395,88 @@ TEST_F(ChunkSender_test, sendMultipleWithReceiver)
     }
 }
 
+TEST_F(ChunkSender_test, sendManyWithReceiverDeliversAllChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e859c19e-0edf-4f26-873e-f5a210e8267e");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{4U};
+    iox::popo::ChunkSender<ChunkSenderData_t>::ChunkHeaderBatch_t chunkHeaders;
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(
+            UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        auto sample = new ((*maybeChunkHeader)->userPayload()) DummySample();
+        sample->dummy = i;
+        chunkHeaders.emplace_back(*maybeChunkHeader);
+    }
+
+    EXPECT_THAT(m_chunkSender.sendMany(chunkHeaders), Eq(1U));
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto popRet = myQueue.tryPop();
+        ASSERT_TRUE(popRet.has_value());
+        EXPECT_THAT(static_cast<DummySample*>(popRet->getUserPayload())->dummy, Eq(i));
+        EXPECT_THAT(popRet->getChunkHeader()->sequenceNumber(), Eq(i));
+    }
+    EXPECT_TRUE(myQueue.empty());
+
+    // the last chunk of the batch is the previous chunk
+    auto maybeLastChunk = m_chunkSender.tryGetPreviousChunk();
+    ASSERT_TRUE(maybeLastChunk.has_value());
+    EXPECT_THAT(*maybeLastChunk, Eq(chunkHeaders.back()));
+}
+
+TEST_F(ChunkSender_test, sendManyNotifiesTheReceiverOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b00d33c2-0c33-427f-a7d1-42f25a79b90e");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+    iox::popo::ConditionVariableData conditionVariableData;
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    myQueue.setConditionVariable(conditionVariableData, 0U);
+
+    iox::popo::ChunkSender<ChunkSenderData_t>::ChunkHeaderBatch_t chunkHeaders;
+    for (uint64_t i = 0U; i < chunkHeaders.capacity(); ++i)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(
+            UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        chunkHeaders.emplace_back(*maybeChunkHeader);
+    }
+
+    m_chunkSender.sendMany(chunkHeaders);
+
+    uint64_t numberOfNotifications{0U};
+    while (conditionVariableData.m_semaphore->tryWait().value())
+    {
+        ++numberOfNotifications;
+    }
+    EXPECT_THAT(numberOfNotifications, Eq(1U));
+    EXPECT_THAT(myQueue.size(), Eq(chunkHeaders.size()));
+}
+
+TEST_F(ChunkSender_test, sendManyWithHistoryAddsAllChunksToTheHistory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "43206de1-ecf6-4778-8d0c-ea609b464e47");
+    constexpr uint64_t NUMBER_OF_CHUNKS{HISTORY_CAPACITY - 1U};
+    iox::popo::ChunkSender<ChunkSenderData_t>::ChunkHeaderBatch_t chunkHeaders;
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeChunkHeader = m_chunkSenderWithHistory.tryAllocate(
+            UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        chunkHeaders.emplace_back(*maybeChunkHeader);
+    }
+
+    EXPECT_THAT(m_chunkSenderWithHistory.sendMany(chunkHeaders), Eq(0U));
+
+    EXPECT_THAT(m_chunkSenderWithHistory.getHistorySize(), Eq(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(NUMBER_OF_CHUNKS));
+}
+
 TEST_F(ChunkSender_test, sendTillRunningOutOfChunks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "b951495a-e216-43ff-96a0-a530b7a6455b");
@@ -725,6 +808,35 @@ TEST_F(ChunkSender_test, Cleanup)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+TEST_F(ChunkSender_test, CleanupWithChunkCacheReturnsTheCachedChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "81aed008-6a84-4ca3-842a-78fbbd2cf80f");
+    constexpr bool USE_CHUNK_CACHE{true};
+    ChunkSenderData_t chunkSenderData{&m_memoryManager,
+                                      iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+                                      0U,
+                                      iox::mepoo::MemoryInfo(),
+                                      0U,
+                                      USE_CHUNK_CACHE};
+    iox::popo::ChunkSender<ChunkSenderData_t> sut{&chunkSenderData};
+
+    constexpr uint32_t NUMBER_OF_ALLOCATIONS{2U};
+    for (uint32_t i = 0U; i < NUMBER_OF_ALLOCATIONS; ++i)
+    {
+        auto maybeChunkHeader = sut.tryAllocate(
+            UniquePortId(), SMALL_CHUNK, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        EXPECT_FALSE(maybeChunkHeader.has_error());
+    }
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(iox::mepoo::ChunkCache::CAPACITY));
+    EXPECT_THAT(chunkSenderData.m_chunkCache.size(), Eq(iox::mepoo::ChunkCache::CAPACITY - NUMBER_OF_ALLOCATIONS));
+
+    sut.releaseAll();
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(chunkSenderData.m_chunkCache.size(), Eq(0U));
+}
+
 TEST_F(ChunkSender_test, asStringLiteralConvertsAllocationErrorValuesToStrings)
 {
     ::testing::Test::RecordProperty("TEST_ID", "fdb713e1-0e2c-411e-a3ee-02c216d510d0");
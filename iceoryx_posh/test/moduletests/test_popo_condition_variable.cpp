@@ -23,10 +23,16 @@
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "test.hpp"
 
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <poll.h>
+#endif
+
 #include <atomic>
 #include <memory>
 #include <thread>
 #include <type_traits>
+#include <vector>
 
 namespace
 {
@@ -58,6 +64,13 @@ class ConditionVariable_test : public Test
         m_watchdog.watchAndActOnFailure([&] { std::terminate(); });
     }
 
+    bool isNotificationActive(const uint64_t index) const
+    {
+        return (m_condVarData.m_activeNotifications[ConditionVariableData::notificationWordIndex(index)].load()
+                & ConditionVariableData::notificationBitMask(index))
+               != 0U;
+    }
+
     Watchdog m_watchdog{m_timeToWait};
 };
 
@@ -113,6 +126,48 @@ TEST_F(ConditionVariable_test, WaitResetsAllNotificationsInWait)
     EXPECT_TRUE(isThreadFinished.load());
 }
 
+TEST_F(ConditionVariable_test, RepeatedNotifyOfPendingNotificationPostsSemaphoreOnlyOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c3fb14e3-a210-4c1b-8ff3-f6c7b5e942cb");
+    m_signaler.notify();
+    m_signaler.notify();
+    m_signaler.notify();
+
+    uint64_t numberOfPosts{0U};
+    while (m_condVarData.m_semaphore->tryWait().value())
+    {
+        ++numberOfPosts;
+    }
+    EXPECT_THAT(numberOfPosts, Eq(1U));
+}
+
+TEST_F(ConditionVariable_test, NotifyOfPendingNotificationPostsSemaphoreWhenListenerIsSleeping)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2e66f765-9f5e-40aa-94f8-58b8b983459e");
+    m_signaler.notify();
+    m_condVarData.m_isListenerSleeping.store(true);
+    m_signaler.notify();
+
+    uint64_t numberOfPosts{0U};
+    while (m_condVarData.m_semaphore->tryWait().value())
+    {
+        ++numberOfPosts;
+    }
+    EXPECT_THAT(numberOfPosts, Eq(2U));
+}
+
+TEST_F(ConditionVariable_test, WaitCollectsNotificationWhichWasCoalescedWhileListenerWasAwake)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "10aa3859-aa30-4925-aded-7829f4cd1e2d");
+    m_notifiers[3U].notify();
+    m_notifiers[3U].notify();
+
+    auto notifications = m_waiter.wait();
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_THAT(notifications[0U], Eq(3U));
+    EXPECT_FALSE(m_condVarData.m_isListenerSleeping.load());
+}
+
 TEST_F(ConditionVariable_test, WaitAndNotifyResultsInImmediateTriggerMultiThreaded)
 {
     ::testing::Test::RecordProperty("TEST_ID", "39b40c73-3dcc-4af6-9682-b62816c69854");
@@ -131,13 +186,92 @@ TEST_F(ConditionVariable_test, WaitAndNotifyResultsInImmediateTriggerMultiThread
     waiter.join();
 }
 
+TEST_F(ConditionVariable_test, WaitAndNotifyWorkAfterTheWaitersWereReset)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e7a0c5d2-3f94-4b18-8c6e-5d21b9f04a73");
+    m_condVarData.resetWaiters();
+
+    std::thread waiter([&] {
+        auto notifications = m_waiter.wait();
+        ASSERT_THAT(notifications.size(), Eq(1U));
+        EXPECT_THAT(notifications[0U], Eq(0U));
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    m_signaler.notify();
+    waiter.join();
+}
+
+TEST_F(ConditionVariable_test, SpinBudgetIsZeroByDefault)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0f4b3778-cf85-4687-8d88-cc248a314180");
+    EXPECT_THAT(m_waiter.getSpinBudget(), Eq(iox::units::Duration::zero()));
+}
+
+TEST_F(ConditionVariable_test, SetSpinBudgetIsReturnedByGetSpinBudget)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2008544a-ba83-4447-b7c8-92627bd88624");
+    m_waiter.setSpinBudget(50_us);
+    EXPECT_THAT(m_waiter.getSpinBudget(), Eq(50_us));
+
+    m_waiter.setSpinBudget(iox::units::Duration::max());
+    EXPECT_THAT(m_waiter.getSpinBudget(), Eq(iox::units::Duration::max()));
+}
+
+TEST_F(ConditionVariable_test, WaitInPurePollingModeReturnsNotificationFromOtherThread)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b3e6ec55-11a3-4865-b89b-43338afef238");
+    m_waiter.setSpinBudget(iox::units::Duration::max());
+    NotificationVector_t activeNotifications;
+    Barrier isThreadStarted(1U);
+    std::thread waiter([&] {
+        isThreadStarted.notify();
+        activeNotifications = m_waiter.wait();
+    });
+    isThreadStarted.wait();
+
+    m_notifiers[7U].notify();
+    waiter.join();
+
+    ASSERT_THAT(activeNotifications.size(), Eq(1U));
+    EXPECT_THAT(activeNotifications[0U], Eq(7U));
+}
+
+TEST_F(ConditionVariable_test, DestroyWakesUpWaitInPurePollingMode)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "384cc292-36a4-4beb-9425-324c69c2cca4");
+    ConditionListener sut(m_condVarData);
+    sut.setSpinBudget(iox::units::Duration::max());
+
+    std::thread waiter([&] {
+        auto activeNotifications = sut.wait();
+        EXPECT_THAT(activeNotifications.size(), Eq(0U));
+    });
+
+    sut.destroy();
+    waiter.join();
+}
+
+TIMING_TEST_F(ConditionVariable_test, TimedWaitInPurePollingModeReturnsAfterTimeout, Repeat(5), [&] {
+    ::testing::Test::RecordProperty("TEST_ID", "fecd9574-6e12-4181-ab54-ec59a30abfeb");
+    m_waiter.setSpinBudget(iox::units::Duration::max());
+
+    auto start = std::chrono::steady_clock::now();
+    auto activeNotifications = m_waiter.timedWait(m_timingTestTime);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    TIMING_TEST_EXPECT_TRUE(activeNotifications.empty());
+    TIMING_TEST_EXPECT_TRUE(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count()
+                            >= static_cast<int64_t>(m_timingTestTime.toMilliseconds()));
+})
+
 TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstruction)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4e5f6dbc-84cc-468a-9d64-f5ed88012ebc");
     ConditionVariableData sut;
     for (auto& notification : sut.m_activeNotifications)
     {
-        EXPECT_THAT(notification, Eq(false));
+        EXPECT_THAT(notification.load(), Eq(0U));
     }
 }
 
@@ -152,7 +286,7 @@ TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstructionWithRunt
     ::testing::Test::RecordProperty("TEST_ID", "4825e152-08e3-414e-a34f-d93d048f84b8");
     for (auto& notification : m_condVarData.m_activeNotifications)
     {
-        EXPECT_THAT(notification, Eq(false));
+        EXPECT_THAT(notification.load(), Eq(0U));
     }
 }
 
@@ -166,11 +300,11 @@ TEST_F(ConditionVariable_test, NotifyActivatesCorrectIndex)
     {
         if (i == EVENT_INDEX)
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i], Eq(true));
+            EXPECT_THAT(isNotificationActive(i), Eq(true));
         }
         else
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i], Eq(false));
+            EXPECT_THAT(isNotificationActive(i), Eq(false));
         }
     }
 }
@@ -215,6 +349,32 @@ TEST_F(ConditionVariable_test, TimedWaitReturnsMultipleNotifiedIndices)
     EXPECT_THAT(indices[1U], Eq(15U));
 }
 
+TEST_F(ConditionVariable_test, TimedWaitReturnsNotifiedIndicesAtWordBoundariesSorted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "49843b0a-81eb-4088-8b6f-1487e81e2fce");
+    ConditionListener sut(m_condVarData);
+    const std::vector<uint64_t> notifiedIndices{iox::MAX_NUMBER_OF_NOTIFIERS - 1U,
+                                                ConditionVariableData::NOTIFICATION_WORD_SIZE,
+                                                ConditionVariableData::NOTIFICATION_WORD_SIZE - 1U,
+                                                0U};
+    for (const auto index : notifiedIndices)
+    {
+        ConditionNotifier(m_condVarData, index).notify();
+    }
+
+    auto indices = sut.timedWait(iox::units::Duration::fromMilliseconds(100));
+
+    ASSERT_THAT(indices.size(), Eq(notifiedIndices.size()));
+    EXPECT_THAT(indices[0U], Eq(0U));
+    EXPECT_THAT(indices[1U], Eq(ConditionVariableData::NOTIFICATION_WORD_SIZE - 1U));
+    EXPECT_THAT(indices[2U], Eq(ConditionVariableData::NOTIFICATION_WORD_SIZE));
+    EXPECT_THAT(indices[3U], Eq(iox::MAX_NUMBER_OF_NOTIFIERS - 1U));
+    for (const auto index : notifiedIndices)
+    {
+        EXPECT_FALSE(isNotificationActive(index));
+    }
+}
+
 TEST_F(ConditionVariable_test, TimedWaitReturnsAllNotifiedIndices)
 {
     ::testing::Test::RecordProperty("TEST_ID", "38ee654b-228a-4462-9614-2901cb5272aa");
@@ -422,7 +582,7 @@ TIMING_TEST_F(ConditionVariable_test, SecondWaitBlocksUntilNewNotification, Repe
         EXPECT_THAT(activeNotifications[0], Eq(FIRST_EVENT_INDEX));
         for (const auto& notification : m_condVarData.m_activeNotifications)
         {
-            EXPECT_THAT(notification, Eq(false));
+            EXPECT_THAT(notification.load(), Eq(0U));
         }
     });
 
@@ -494,4 +654,135 @@ TEST_F(ConditionVariable_test, TimedWaitReturnsSortedListWhenTriggeredInReverseO
         *this, [this] { return m_waiter.timedWait(iox::units::Duration::fromSeconds(1)); });
 }
 
+#if !defined(_WIN32)
+bool isReadable(const int32_t fileDescriptor)
+{
+    pollfd pollFd{fileDescriptor, POLLIN, 0};
+    return poll(&pollFd, 1U, 0) == 1 && (pollFd.revents & POLLIN) != 0;
+}
+
+TEST_F(ConditionVariable_test, FileDescriptorIsValidAndNotReadableWithoutNotification)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "82727adc-3db8-411a-bc72-9702cf1b2600");
+    auto fileDescriptor = m_waiter.getFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+    EXPECT_THAT(fileDescriptor.value(), Ge(0));
+    EXPECT_FALSE(isReadable(fileDescriptor.value()));
+}
+
+TEST_F(ConditionVariable_test, FileDescriptorIsTheSameForEveryCall)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0824cbbe-881d-46d8-a97a-48763b6c228e");
+    auto fileDescriptor = m_waiter.getFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+    auto secondFileDescriptor = m_waiter.getFileDescriptor();
+    ASSERT_FALSE(secondFileDescriptor.has_error());
+    EXPECT_THAT(secondFileDescriptor.value(), Eq(fileDescriptor.value()));
+}
+
+TEST_F(ConditionVariable_test, FileDescriptorIsReadableAfterNotify)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3406d8a2-5d89-4984-8b84-efd380873375");
+    auto fileDescriptor = m_waiter.getFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+
+    m_notifiers[3U].notify();
+
+    EXPECT_TRUE(isReadable(fileDescriptor.value()));
+}
+
+TEST_F(ConditionVariable_test, FileDescriptorIsReadableWhenNotifiedBeforeItWasAcquired)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "41490709-d38b-4f4a-93f5-2a1221c1ed15");
+    m_notifiers[3U].notify();
+
+    auto fileDescriptor = m_waiter.getFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+
+    EXPECT_TRUE(isReadable(fileDescriptor.value()));
+}
+
+TEST_F(ConditionVariable_test, FileDescriptorIsNotReadableAfterNotificationsWereCollected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2efe17e7-76f0-4495-9be5-d44e3d1ba351");
+    auto fileDescriptor = m_waiter.getFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+
+    m_notifiers[3U].notify();
+    m_notifiers[3U].notify();
+    m_notifiers[7U].notify();
+    auto notifications = m_waiter.timedWait(iox::units::Duration::zero());
+
+    ASSERT_THAT(notifications.size(), Eq(2U));
+    EXPECT_FALSE(isReadable(fileDescriptor.value()));
+}
+
+TEST_F(ConditionVariable_test, FileDescriptorIsReadableAgainAfterNotifyFollowingCollection)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "00ec4727-6eba-4f01-bc97-6a2f757ec534");
+    auto fileDescriptor = m_waiter.getFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+
+    m_notifiers[3U].notify();
+    m_waiter.timedWait(iox::units::Duration::zero());
+    m_notifiers[3U].notify();
+
+    EXPECT_TRUE(isReadable(fileDescriptor.value()));
+}
+
+TEST_F(ConditionVariable_test, SignalFileDescriptorMakesItReadableWithoutNotification)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "75b77b99-3de8-44b1-bff7-f10e966b59ae");
+    auto fileDescriptor = m_waiter.getFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+
+    m_waiter.signalFileDescriptor();
+
+    EXPECT_TRUE(isReadable(fileDescriptor.value()));
+}
+
+TEST_F(ConditionVariable_test, FileDescriptorBecomesReadableWhenNotifiedFromOtherThread)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8f527402-8d00-4fd6-b736-912eddcd3275");
+    auto fileDescriptor = m_waiter.getFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+
+    std::thread notifier([&] { m_notifiers[5U].notify(); });
+
+    pollfd pollFd{fileDescriptor.value(), POLLIN, 0};
+    EXPECT_THAT(poll(&pollFd, 1U, -1), Eq(1));
+    notifier.join();
+
+    auto notifications = m_waiter.timedWait(iox::units::Duration::zero());
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_THAT(notifications[0U], Eq(5U));
+}
+
+TEST_F(ConditionVariable_test, FileDescriptorIsNonBlocking)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4d0b7e29-81c3-4f5a-a6d2-c93e15f08b74");
+    auto fileDescriptor = m_waiter.getFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+
+    const int flags = fcntl(fileDescriptor.value(), F_GETFL, 0);
+
+    ASSERT_THAT(flags, Ne(-1));
+    EXPECT_THAT(flags & O_NONBLOCK, Ne(0));
+}
+
+TEST_F(ConditionVariable_test, OwnNotificationSenderMakesFileDescriptorReadable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a86f3c05-2e17-4b9d-8d41-6b0f5e7c23a9");
+    auto fileDescriptor = m_waiter.getFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+
+    {
+        NotificationSender sender;
+        sender.signal(m_condVarData.m_notificationSocketId.load());
+    }
+
+    EXPECT_TRUE(isReadable(fileDescriptor.value()));
+}
+#endif
+
 } // namespace
@@ -0,0 +1,134 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/delivery_thread_pool.hpp"
+#include "test.hpp"
+
+#include <atomic>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::units::duration_literals;
+
+class DeliveryThreadPool_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        m_watchdog.watchAndActOnFailure([] { std::terminate(); });
+    }
+
+    void TearDown() override
+    {
+    }
+
+    static constexpr uint64_t NUMBER_OF_TASKS{100U};
+    std::atomic<uint64_t> m_executions[NUMBER_OF_TASKS];
+
+    void resetExecutions()
+    {
+        for (auto& execution : m_executions)
+        {
+            execution.store(0U);
+        }
+    }
+
+    void expectEveryTaskWasExecutedOnce()
+    {
+        for (auto& execution : m_executions)
+        {
+            EXPECT_THAT(execution.load(), Eq(1U));
+        }
+    }
+
+    Watchdog m_watchdog{10_s};
+};
+constexpr uint64_t DeliveryThreadPool_test::NUMBER_OF_TASKS;
+
+TEST_F(DeliveryThreadPool_test, NumberOfThreadsIsLimitedToMaximum)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9a886f39-70f2-43d8-9005-1fa490c1a71c");
+    DeliveryThreadPool sut(iox::MAX_NUMBER_OF_DELIVERY_THREADS + 1U);
+
+    EXPECT_THAT(sut.numberOfThreads(), Eq(iox::MAX_NUMBER_OF_DELIVERY_THREADS));
+}
+
+TEST_F(DeliveryThreadPool_test, RunWithoutThreadsExecutesEveryTaskOnceInTheCallingThread)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "19cb65aa-81fe-4fe6-9b4b-c36c03bb8232");
+    DeliveryThreadPool sut(0U);
+    resetExecutions();
+
+    const auto callingThread = std::this_thread::get_id();
+    std::atomic_bool wasExecutedInOtherThread{false};
+    sut.run(NUMBER_OF_TASKS, [&](const uint64_t index) {
+        m_executions[index].fetch_add(1U);
+        if (std::this_thread::get_id() != callingThread)
+        {
+            wasExecutedInOtherThread.store(true);
+        }
+    });
+
+    expectEveryTaskWasExecutedOnce();
+    EXPECT_FALSE(wasExecutedInOtherThread.load());
+}
+
+TEST_F(DeliveryThreadPool_test, RepeatedRunsWithThreadsExecuteEveryTaskOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7e76ae42-e713-414e-b8ad-9935a0d9c328");
+    DeliveryThreadPool sut(iox::MAX_NUMBER_OF_DELIVERY_THREADS);
+
+    constexpr uint64_t NUMBER_OF_RUNS{1000U};
+    for (uint64_t run = 0U; run < NUMBER_OF_RUNS; ++run)
+    {
+        resetExecutions();
+        sut.run(NUMBER_OF_TASKS, [&](const uint64_t index) { m_executions[index].fetch_add(1U); });
+        expectEveryTaskWasExecutedOnce();
+    }
+}
+
+TEST_F(DeliveryThreadPool_test, ConcurrentRunsExecuteTheirTasksOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "eb1ff2bf-5190-4b9a-9383-7e34b4d8b41b");
+    DeliveryThreadPool sut(iox::MAX_NUMBER_OF_DELIVERY_THREADS);
+    resetExecutions();
+
+    constexpr uint64_t NUMBER_OF_RUNS{1000U};
+    std::atomic<uint64_t> otherExecutions{0U};
+    std::thread otherThread([&] {
+        for (uint64_t run = 0U; run < NUMBER_OF_RUNS; ++run)
+        {
+            sut.run(NUMBER_OF_TASKS, [&](const uint64_t) { otherExecutions.fetch_add(1U); });
+        }
+    });
+
+    for (uint64_t run = 0U; run < NUMBER_OF_RUNS; ++run)
+    {
+        sut.run(NUMBER_OF_TASKS, [&](const uint64_t index) { m_executions[index].fetch_add(1U); });
+    }
+    otherThread.join();
+
+    for (auto& execution : m_executions)
+    {
+        EXPECT_THAT(execution.load(), Eq(NUMBER_OF_RUNS));
+    }
+    EXPECT_THAT(otherExecutions.load(), Eq(NUMBER_OF_RUNS * NUMBER_OF_TASKS));
+}
+} // namespace
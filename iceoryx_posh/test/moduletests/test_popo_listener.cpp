@@ -19,6 +19,7 @@
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_hoofs/internal/concurrent/smart_lock.hpp"
 #include "iceoryx_hoofs/posix_wrapper/unnamed_semaphore.hpp"
+#include "iceoryx_hoofs/testing/mocks/error_handler_mock.hpp"
 #include "iceoryx_hoofs/testing/timing_test.hpp"
 #include "iceoryx_hoofs/testing/watch_dog.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
@@ -134,8 +135,8 @@ class SimpleEventClass
 class TestListener : public Listener
 {
   public:
-    TestListener(ConditionVariableData& data) noexcept
-        : Listener(data)
+    TestListener(ConditionVariableData& data, const ListenerOptions& options = ListenerOptions()) noexcept
+        : Listener(data, options)
     {
     }
 };
@@ -156,7 +157,10 @@ iox::concurrent::smart_lock<std::vector<EventAndSutPair_t>> g_toBeAttached;
 iox::concurrent::smart_lock<std::vector<EventAndSutPair_t>> g_toBeDetached;
 std::array<TriggerSourceAndCount, iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER> g_triggerCallbackArg;
 uint64_t g_triggerCallbackRuntimeInMs = 0U;
+std::atomic<uint64_t> g_concurrentCallbackExecutions{0U};
+std::atomic<uint64_t> g_maxConcurrentCallbackExecutions{0U};
 iox::cxx::optional<iox::posix::UnnamedSemaphore> g_callbackBlocker;
+std::atomic<uint64_t> g_callbacksWhichWaitForEachOther{0U};
 
 class Listener_test : public Test
 {
@@ -174,6 +178,20 @@ class Listener_test : public Test
         std::this_thread::sleep_for(std::chrono::milliseconds(g_triggerCallbackRuntimeInMs));
     }
 
+    static void concurrencyTrackingCallback(SimpleEventClass* const event) noexcept
+    {
+        const uint64_t concurrentExecutions = ++g_concurrentCallbackExecutions;
+        uint64_t maxConcurrentExecutions = g_maxConcurrentCallbackExecutions.load();
+        while (concurrentExecutions > maxConcurrentExecutions
+               && !g_maxConcurrentCallbackExecutions.compare_exchange_weak(maxConcurrentExecutions,
+                                                                           concurrentExecutions))
+        {
+        }
+
+        triggerCallback<0U>(event);
+        --g_concurrentCallbackExecutions;
+    }
+
     static void triggerCallbackWithUserType(SimpleEventClass* const event, uint64_t* userType) noexcept
     {
         g_triggerCallbackArg[0].m_source = event;
@@ -200,6 +218,24 @@ class Listener_test : public Test
         }
     }
 
+    static void detachOtherEventsWhenAllCallbacksAreRunningCallback(SimpleEventClass* const event) noexcept
+    {
+        auto toBeDetached = g_toBeDetached.getCopy();
+        ++g_callbacksWhichWaitForEachOther;
+        while (g_callbacksWhichWaitForEachOther < toBeDetached.size())
+        {
+            std::this_thread::yield();
+        }
+
+        for (auto& e : toBeDetached)
+        {
+            if (e.object != event)
+            {
+                e.sut->detachEvent(*e.object, SimpleEvent::StoepselBachelorParty);
+            }
+        }
+    }
+
     static void notifyAndThenDetachStoepselCallback(SimpleEventClass* const) noexcept
     {
         for (auto& e : g_toBeDetached.getCopy())
@@ -221,6 +257,9 @@ class Listener_test : public Test
         m_sut.emplace(m_condVarData);
         g_invalidateTriggerId = 0U;
         g_triggerCallbackRuntimeInMs = 0U;
+        g_concurrentCallbackExecutions = 0U;
+        g_maxConcurrentCallbackExecutions = 0U;
+        g_callbacksWhichWaitForEachOther = 0U;
         g_toBeAttached->clear();
         g_toBeDetached->clear();
     };
@@ -333,6 +372,15 @@ TEST_F(Listener_test, IsEmptyWhenConstructed)
     EXPECT_THAT(m_sut->size(), Eq(0U));
 }
 
+TEST_F(Listener_test, SetSpinBudgetIsReturnedByGetSpinBudget)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3ec6f49e-8945-4e6b-b78d-03dade8e0949");
+    EXPECT_THAT(m_sut->getSpinBudget(), Eq(iox::units::Duration::zero()));
+
+    m_sut->setSpinBudget(iox::units::Duration::max());
+    EXPECT_THAT(m_sut->getSpinBudget(), Eq(iox::units::Duration::max()));
+}
+
 TEST_F(Listener_test, AttachingWithoutEnumIfEnoughSpaceAvailableWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "42f0fdf5-9218-4f50-927a-8bcad4e7065f");
@@ -1234,6 +1282,184 @@ TIMING_TEST_F(Listener_test, AttachingInCallbackWorks, Repeat(5), [&] {
     TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_source == &events[1U]);
     TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count == 1U);
 })
+//////////////////////////////////
+// BEGIN worker threads
+//////////////////////////////////
+TEST_F(Listener_test, HasNoWorkerThreadsByDefault)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3bf99746-df58-4e30-822b-a21b37cbeed3");
+    EXPECT_THAT(m_sut->numberOfWorkerThreads(), Eq(0U));
+}
+
+TEST_F(Listener_test, HasNumberOfWorkerThreadsFromOptions)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "33f42fb8-d9f7-4be0-9729-006ce1f48ea9");
+    ListenerOptions options;
+    options.numberOfWorkerThreads = 3U;
+    m_sut.emplace(m_condVarData, options);
+
+    EXPECT_THAT(m_sut->numberOfWorkerThreads(), Eq(3U));
+}
+
+TEST_F(Listener_test, NumberOfWorkerThreadsIsLimitedToMaximum)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "62eae919-8739-4634-a8e6-239444f5c99b");
+    iox::cxx::optional<iox::PoshError> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&](const iox::PoshError error, const iox::ErrorLevel errorLevel) {
+            detectedError.emplace(error);
+            EXPECT_THAT(errorLevel, Eq(iox::ErrorLevel::MODERATE));
+        });
+
+    ListenerOptions options;
+    options.numberOfWorkerThreads = iox::MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER + 1U;
+    m_sut.emplace(m_condVarData, options);
+
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_THAT(detectedError.value(), Eq(iox::PoshError::POPO__LISTENER_TOO_MANY_WORKER_THREADS));
+    EXPECT_THAT(m_sut->numberOfWorkerThreads(), Eq(iox::MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER));
+}
+
+TEST_F(Listener_test, BlockingCallbackDoesNotDelayOtherEventsWithWorkerThreads)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9dab2de5-9108-453c-aa9e-9ca9abf429d1");
+    ListenerOptions options;
+    options.numberOfWorkerThreads = 2U;
+    m_sut.emplace(m_condVarData, options);
+    activateTriggerCallbackBlocker();
+
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(m_simpleEvents[0U],
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(triggerCallback<0U>))
+                     .has_error());
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(m_simpleEvents[1U],
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(triggerCallback<1U>))
+                     .has_error());
+
+    m_simpleEvents[0U].triggerStoepsel();
+    while (g_triggerCallbackArg[0U].m_count == 0U)
+    {
+        std::this_thread::yield();
+    }
+
+    // the callback of the first event is blocked, the one of the second event must run anyway
+    m_simpleEvents[1U].triggerStoepsel();
+    while (g_triggerCallbackArg[1U].m_count == 0U)
+    {
+        std::this_thread::yield();
+    }
+
+    EXPECT_THAT(g_triggerCallbackArg[0U].m_source, Eq(&m_simpleEvents[0U]));
+    EXPECT_THAT(g_triggerCallbackArg[1U].m_source, Eq(&m_simpleEvents[1U]));
+
+    unblockTriggerCallback(2U);
+    m_sut.reset();
+}
+
+TEST_F(Listener_test, CallbackIsNotExecutedConcurrentlyWithItselfAndRepeatedForNotificationsDuringExecution)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bf660918-49c1-4521-8e40-72618298204a");
+    ListenerOptions options;
+    options.numberOfWorkerThreads = 4U;
+    m_sut.emplace(m_condVarData, options);
+    activateTriggerCallbackBlocker();
+
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(m_simpleEvents[0U],
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(concurrencyTrackingCallback))
+                     .has_error());
+
+    m_simpleEvents[0U].triggerStoepsel();
+    while (g_triggerCallbackArg[0U].m_count == 0U)
+    {
+        std::this_thread::yield();
+    }
+
+    m_simpleEvents[0U].triggerStoepsel();
+    m_simpleEvents[0U].triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS / 2U));
+    EXPECT_THAT(g_triggerCallbackArg[0U].m_count, Eq(1U));
+
+    unblockTriggerCallback(1U);
+    while (g_triggerCallbackArg[0U].m_count < 2U)
+    {
+        std::this_thread::yield();
+    }
+    unblockTriggerCallback(1U);
+    m_sut.reset();
+
+    EXPECT_THAT(g_triggerCallbackArg[0U].m_count, Eq(2U));
+    EXPECT_THAT(g_maxConcurrentCallbackExecutions, Eq(1U));
+}
+
+TEST_F(Listener_test, AllEventsAreExecutedWithWorkerThreads)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "17980b41-eb22-4e30-83ae-1cece3902bbb");
+    ListenerOptions options;
+    options.numberOfWorkerThreads = 4U;
+    m_sut.emplace(m_condVarData, options);
+
+    constexpr uint64_t NUMBER_OF_EVENTS{16U};
+    for (uint64_t i = 0U; i < NUMBER_OF_EVENTS; ++i)
+    {
+        ASSERT_FALSE(m_sut
+                         ->attachEvent(m_simpleEvents[i],
+                                       SimpleEvent::StoepselBachelorParty,
+                                       createNotificationCallback(triggerCallback<0U>))
+                         .has_error());
+    }
+
+    for (uint64_t i = 0U; i < NUMBER_OF_EVENTS; ++i)
+    {
+        m_simpleEvents[i].triggerStoepsel();
+    }
+
+    while (g_triggerCallbackArg[0U].m_count < NUMBER_OF_EVENTS)
+    {
+        std::this_thread::yield();
+    }
+    m_sut.reset();
+
+    EXPECT_THAT(g_triggerCallbackArg[0U].m_count, Eq(NUMBER_OF_EVENTS));
+}
+
+TEST_F(Listener_test, CallbacksWhichDetachEachOtherInParallelDoNotDeadlockWithWorkerThreads)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5a0e3f47-8d2b-4c1e-9f6a-b7d3c2e41a58");
+    ListenerOptions options;
+    options.numberOfWorkerThreads = 2U;
+    m_sut.emplace(m_condVarData, options);
+
+    g_toBeDetached->push_back({&m_simpleEvents[0U], &*m_sut});
+    g_toBeDetached->push_back({&m_simpleEvents[1U], &*m_sut});
+    for (uint64_t i = 0U; i < 2U; ++i)
+    {
+        ASSERT_FALSE(m_sut
+                         ->attachEvent(m_simpleEvents[i],
+                                       SimpleEvent::StoepselBachelorParty,
+                                       createNotificationCallback(detachOtherEventsWhenAllCallbacksAreRunningCallback))
+                         .has_error());
+    }
+
+    // both callbacks run at the same time and detach the event of the other one
+    m_simpleEvents[0U].triggerStoepsel();
+    m_simpleEvents[1U].triggerStoepsel();
+
+    iox::cxx::DeadlineTimer timeout(iox::units::Duration::fromMilliseconds(CALLBACK_WAIT_IN_MS * 10U));
+    while (m_sut->size() != 0U && !timeout.hasExpired())
+    {
+        std::this_thread::yield();
+    }
+
+    EXPECT_THAT(m_sut->size(), Eq(0U));
+    EXPECT_THAT(g_callbacksWhichWaitForEachOther.load(), Eq(2U));
+    m_sut.reset();
+}
+
 //////////////////////////////////
 // END
 //////////////////////////////////
@@ -263,6 +263,30 @@ TEST_F(PublisherTest, LoanedSamplesContainPointerToChunkHeader)
     // ===== Cleanup ===== //
 }
 
+TEST_F(PublisherTest, PublishBatchSendsUnderlyingMemoryChunksInOnePassOnPublisherPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a16dce5d-0ea6-4707-a14a-182437d8b60f");
+    ChunkMock<DummyData> secondChunkMock;
+    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(DummyData), _, _, _))
+        .WillOnce(Return(ByMove(iox::cxx::success<iox::mepoo::ChunkHeader*>(chunkMock.chunkHeader()))))
+        .WillOnce(Return(ByMove(iox::cxx::success<iox::mepoo::ChunkHeader*>(secondChunkMock.chunkHeader()))));
+    EXPECT_CALL(portMock, sendChunks(_)).WillOnce(Invoke([&](const MockPublisherPortUser::ChunkHeaderBatch_t& headers) {
+        ASSERT_THAT(headers.size(), Eq(2U));
+        EXPECT_THAT(headers[0], Eq(chunkMock.chunkHeader()));
+        EXPECT_THAT(headers[1], Eq(secondChunkMock.chunkHeader()));
+    }));
+    EXPECT_CALL(portMock, sendChunk(_)).Times(0);
+    EXPECT_CALL(portMock, releaseChunk(_)).Times(0);
+    // ===== Test ===== //
+    TestPublisher::SampleBatch_t samples;
+    sut.loan().and_then([&](auto& sample) { samples.emplace_back(std::move(sample)); });
+    sut.loan().and_then([&](auto& sample) { samples.emplace_back(std::move(sample)); });
+    ASSERT_THAT(samples.size(), Eq(2U));
+    sut.publishBatch(std::move(samples));
+    // ===== Verify ===== //
+    // ===== Cleanup ===== //
+}
+
 TEST_F(PublisherTest, PublishingSendsUnderlyingMemoryChunkOnPublisherPort)
 {
     ::testing::Test::RecordProperty("TEST_ID", "743183e2-76cb-4d51-9643-a962d933fdac");
@@ -21,6 +21,8 @@
 
 #include "test.hpp"
 
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -162,6 +164,51 @@ TEST_F(SubscriberTest, TakeReturnsAllocatedMemoryChunksWrappedInSample)
     // ===== Cleanup ===== //
 }
 
+TEST_F(SubscriberTest, TakeManyHandsAllTakenChunksWrappedInSamplesToTheCallback)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "64339c64-d782-4b80-ad3d-f880cb285150");
+    // ===== Setup ===== //
+    constexpr uint64_t MAX_COUNT{5U};
+    ChunkMock<DummyData> secondChunkMock;
+    EXPECT_CALL(sut, takeChunks(_, MAX_COUNT))
+        .Times(1)
+        .WillOnce(Invoke([&](TestSubscriber::PortType::ChunkHeaderBatch_t& chunkHeaders, const uint64_t) {
+            chunkHeaders.emplace_back(chunkMock.chunkHeader());
+            chunkHeaders.emplace_back(secondChunkMock.chunkHeader());
+            return iox::cxx::expected<iox::popo::ChunkReceiveResult>(iox::cxx::success<>());
+        }));
+    EXPECT_CALL(sut.port(), releaseChunk).Times(2);
+    // ===== Test ===== //
+    std::vector<const void*> userPayloads;
+    auto result = sut.takeMany(
+        MAX_COUNT, [&](iox::popo::Sample<const DummyData>&& sample) { userPayloads.push_back(sample.get()); });
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value(), Eq(2U));
+    ASSERT_THAT(userPayloads.size(), Eq(2U));
+    EXPECT_EQ(userPayloads[0], chunkMock.chunkHeader()->userPayload());
+    EXPECT_EQ(userPayloads[1], secondChunkMock.chunkHeader()->userPayload());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(SubscriberTest, TakeManyForwardsErrorsFromBaseSubscriber)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cab14133-361c-4dff-9c13-ac2064fa355b");
+    // ===== Setup ===== //
+    EXPECT_CALL(sut, takeChunks)
+        .Times(1)
+        .WillOnce(Return(ByMove(iox::cxx::error<iox::popo::ChunkReceiveResult>(
+            iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE))));
+    // ===== Test ===== //
+    bool callbackCalled{false};
+    auto result = sut.takeMany(1U, [&](iox::popo::Sample<const DummyData>&&) { callbackCalled = true; });
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(result.get_error(), iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+    EXPECT_FALSE(callbackCalled);
+    // ===== Cleanup ===== //
+}
+
 TEST_F(SubscriberTest, ReceivedSamplesAreAutomaticallyDeletedWhenOutOfScope)
 {
     ::testing::Test::RecordProperty("TEST_ID", "f32c401d-0620-4a4b-800f-eda94a493efd");
@@ -34,6 +34,9 @@ TEST(SubscriberOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.subscribeOnCreate = false;
     testOptions.queueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PRODUCER;
     testOptions.requiresPublisherHistorySupport = true;
+    testOptions.latestSampleOnly = true;
+    testOptions.decimation = 5U;
+    testOptions.maxSampleRate = 100U;
 
     iox::popo::SubscriberOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -53,6 +56,15 @@ TEST(SubscriberOptions_test, SerializationRoundTripIsSuccessful)
             EXPECT_THAT(roundTripOptions.queueFullPolicy, Eq(testOptions.queueFullPolicy));
             EXPECT_THAT(roundTripOptions.requiresPublisherHistorySupport,
                         Eq(testOptions.requiresPublisherHistorySupport));
+
+            EXPECT_THAT(roundTripOptions.latestSampleOnly, Ne(defaultOptions.latestSampleOnly));
+            EXPECT_THAT(roundTripOptions.latestSampleOnly, Eq(testOptions.latestSampleOnly));
+
+            EXPECT_THAT(roundTripOptions.decimation, Ne(defaultOptions.decimation));
+            EXPECT_THAT(roundTripOptions.decimation, Eq(testOptions.decimation));
+
+            EXPECT_THAT(roundTripOptions.maxSampleRate, Ne(defaultOptions.maxSampleRate));
+            EXPECT_THAT(roundTripOptions.maxSampleRate, Eq(testOptions.maxSampleRate));
         })
         .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of SubscriberOptions failed!"; });
 }
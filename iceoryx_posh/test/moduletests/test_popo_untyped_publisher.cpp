@@ -138,6 +138,26 @@ TEST_F(UntypedPublisherTest, PublishesUserPayloadViaUnderlyingPort)
     // ===== Cleanup ===== //
 }
 
+TEST_F(UntypedPublisherTest, PublishBatchSendsUserPayloadsInOnePassViaUnderlyingPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a6cf802b-3edb-40bd-a887-1b701af69042");
+    // ===== Setup ===== //
+    ChunkMock<uint64_t> secondChunkMock;
+    EXPECT_CALL(portMock, sendChunks(_)).WillOnce(Invoke([&](const MockPublisherPortUser::ChunkHeaderBatch_t& headers) {
+        ASSERT_THAT(headers.size(), Eq(2U));
+        EXPECT_THAT(headers[0], Eq(chunkMock.chunkHeader()));
+        EXPECT_THAT(headers[1], Eq(secondChunkMock.chunkHeader()));
+    }));
+    EXPECT_CALL(portMock, sendChunk).Times(0);
+    TestUntypedPublisher::UserPayloadBatch_t userPayloads;
+    userPayloads.emplace_back(chunkMock.chunkHeader()->userPayload());
+    userPayloads.emplace_back(secondChunkMock.chunkHeader()->userPayload());
+    // ===== Test ===== //
+    sut.publishBatch(userPayloads);
+    // ===== Verify ===== //
+    // ===== Cleanup ===== //
+}
+
 // test whether the BasePublisher methods are called
 
 TEST_F(UntypedPublisherTest, OfferDoesOfferServiceOnUnderlyingPort)
@@ -21,6 +21,8 @@
 
 #include "test.hpp"
 
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -160,6 +162,31 @@ TEST_F(UntypedSubscriberTest, TakeReturnsAllocatedMemoryChunk)
     sut.release(maybeChunk.value());
 }
 
+TEST_F(UntypedSubscriberTest, TakeManyHandsAllTakenUserPayloadsToTheCallback)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1ccd0550-f988-43aa-a3e2-ca92c8d61a92");
+    // ===== Setup ===== //
+    constexpr uint64_t MAX_COUNT{5U};
+    ChunkMock<DummyData> secondChunkMock;
+    EXPECT_CALL(sut, takeChunks(_, MAX_COUNT))
+        .Times(1)
+        .WillOnce(Invoke([&](TestUntypedSubscriber::PortType::ChunkHeaderBatch_t& chunkHeaders, const uint64_t) {
+            chunkHeaders.emplace_back(chunkMock.chunkHeader());
+            chunkHeaders.emplace_back(secondChunkMock.chunkHeader());
+            return iox::cxx::expected<iox::popo::ChunkReceiveResult>(iox::cxx::success<>());
+        }));
+    // ===== Test ===== //
+    std::vector<const void*> userPayloads;
+    auto result = sut.takeMany(MAX_COUNT, [&](const void* userPayload) { userPayloads.push_back(userPayload); });
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value(), Eq(2U));
+    ASSERT_THAT(userPayloads.size(), Eq(2U));
+    EXPECT_EQ(userPayloads[0], chunkMock.chunkHeader()->userPayload());
+    EXPECT_EQ(userPayloads[1], secondChunkMock.chunkHeader()->userPayload());
+    // ===== Cleanup ===== //
+}
+
 TEST_F(UntypedSubscriberTest, ReleasesQueuedDataViaBaseSubscriber)
 {
     ::testing::Test::RecordProperty("TEST_ID", "66c0fb02-aa6d-48dd-8439-754e05cd29af");
@@ -123,6 +123,40 @@ TEST_F(UsedChunkList_test, AddChunksUntilOverflowIsHandledGracefully)
     EXPECT_FALSE(sut.insert(getChunkFromMemoryManager()));
 }
 
+TEST_F(UsedChunkList_test, BatchOfChunksCanBeAddedUpToCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "45b9c9fa-121d-4b81-ab47-9625430eeb67");
+    iox::cxx::vector<SharedChunk, USED_CHUNK_LIST_CAPACITY + 2U> chunks;
+    createMultipleChunks(USED_CHUNK_LIST_CAPACITY + 2U, [&chunks](SharedChunk&& chunk) { chunks.emplace_back(chunk); });
+
+    EXPECT_THAT(sut.insert(chunks), Eq(USED_CHUNK_LIST_CAPACITY));
+    EXPECT_THAT(sut.freeSpace(), Eq(0U));
+
+    // only the chunks at the front of the batch were stored
+    SharedChunk removedChunk;
+    EXPECT_TRUE(sut.remove(chunks.front().getChunkHeader(), removedChunk));
+    EXPECT_FALSE(sut.remove(chunks.back().getChunkHeader(), removedChunk));
+    EXPECT_THAT(sut.freeSpace(), Eq(1U));
+}
+
+TEST_F(UsedChunkList_test, FreeSpaceIsUpdatedOnInsertRemoveAndCleanup)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cf874c68-67d8-49ed-8a05-d6558e3cc97f");
+    EXPECT_THAT(sut.freeSpace(), Eq(USED_CHUNK_LIST_CAPACITY));
+
+    auto chunk = getChunkFromMemoryManager();
+    sut.insert(chunk);
+    sut.insert(getChunkFromMemoryManager());
+    EXPECT_THAT(sut.freeSpace(), Eq(USED_CHUNK_LIST_CAPACITY - 2U));
+
+    SharedChunk removedChunk;
+    sut.remove(chunk.getChunkHeader(), removedChunk);
+    EXPECT_THAT(sut.freeSpace(), Eq(USED_CHUNK_LIST_CAPACITY - 1U));
+
+    sut.cleanup();
+    EXPECT_THAT(sut.freeSpace(), Eq(USED_CHUNK_LIST_CAPACITY));
+}
+
 TEST_F(UsedChunkList_test, OneChunkCanBeRemoved)
 {
     ::testing::Test::RecordProperty("TEST_ID", "50ffb5df-59ef-4dd4-a2a6-c7ad342c24ae");
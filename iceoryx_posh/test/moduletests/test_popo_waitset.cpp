@@ -25,6 +25,10 @@
 #include "iceoryx_posh/popo/wait_set.hpp"
 #include "test.hpp"
 
+#if !defined(_WIN32)
+#include <poll.h>
+#endif
+
 #include <chrono>
 #include <memory>
 #include <thread>
@@ -945,6 +949,88 @@ TEST_F(WaitSet_test, TimedWaitReturnsNothingWhenNothingTriggered)
     ASSERT_THAT(triggerVector.size(), Eq(0U));
 }
 
+TEST_F(WaitSet_test, SetSpinBudgetIsReturnedByGetSpinBudget)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "74f893b0-b011-4c96-b2db-8e13cea14053");
+    EXPECT_THAT(m_sut->getSpinBudget(), Eq(iox::units::Duration::zero()));
+
+    m_sut->setSpinBudget(20_us);
+    EXPECT_THAT(m_sut->getSpinBudget(), Eq(20_us));
+}
+
+TEST_F(WaitSet_test, WaitInPurePollingModeReturnsTriggerFromOtherThread)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4b54235d-c752-4538-b379-ba1324d99c39");
+    m_sut->setSpinBudget(iox::units::Duration::max());
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0], 5U).has_error());
+
+    std::atomic_bool doStartWaiting{false};
+    std::thread t([&] {
+        doStartWaiting.store(true);
+        auto triggerVector = m_sut->wait();
+        ASSERT_THAT(triggerVector.size(), Eq(1U));
+        EXPECT_THAT(triggerVector[0U]->getNotificationId(), Eq(5U));
+    });
+
+    while (!doStartWaiting.load())
+        ;
+
+    m_simpleEvents[0].trigger();
+    t.join();
+}
+
+TEST_F(WaitSet_test, TimedWaitInPurePollingModeReturnsNothingWhenNothingTriggered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3194a1d6-3b95-4587-b748-f814ae14b8b7");
+    m_sut->setSpinBudget(iox::units::Duration::max());
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0], 5U).has_error());
+
+    auto triggerVector = m_sut->timedWait(10_ms);
+    ASSERT_THAT(triggerVector.size(), Eq(0U));
+}
+
+#if !defined(_WIN32)
+bool isReadable(const int32_t fileDescriptor)
+{
+    pollfd pollFd{fileDescriptor, POLLIN, 0};
+    return poll(&pollFd, 1U, 0) == 1 && (pollFd.revents & POLLIN) != 0;
+}
+
+TEST_F(WaitSet_test, FileDescriptorIsReadableWhenEventIsTriggeredAndNotAfterTimedWait)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d45dfa15-d4df-47eb-b969-9ee959205bb4");
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0], 5U).has_error());
+    auto fileDescriptor = m_sut->getFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+    EXPECT_FALSE(isReadable(fileDescriptor.value()));
+
+    m_simpleEvents[0].trigger();
+    ASSERT_TRUE(isReadable(fileDescriptor.value()));
+
+    auto triggerVector = m_sut->timedWait(iox::units::Duration::zero());
+    ASSERT_THAT(triggerVector.size(), Eq(1U));
+    EXPECT_THAT(triggerVector[0U]->getNotificationId(), Eq(5U));
+    EXPECT_FALSE(isReadable(fileDescriptor.value()));
+}
+
+TEST_F(WaitSet_test, FileDescriptorStaysReadableAsLongAsStateIsSatisfied)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "183cead3-c71c-42ba-8079-cf556c5fc176");
+    m_simpleEvents[0].m_autoResetTrigger = false;
+    ASSERT_FALSE(m_sut->attachState(m_simpleEvents[0], 5U).has_error());
+    auto fileDescriptor = m_sut->getFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+
+    m_simpleEvents[0].trigger();
+    EXPECT_THAT(m_sut->timedWait(iox::units::Duration::zero()).size(), Eq(1U));
+    EXPECT_TRUE(isReadable(fileDescriptor.value()));
+
+    m_simpleEvents[0].resetTrigger();
+    EXPECT_THAT(m_sut->timedWait(iox::units::Duration::zero()).size(), Eq(0U));
+    EXPECT_FALSE(isReadable(fileDescriptor.value()));
+}
+#endif
+
 void WaitReturnsTheOneTriggeredCondition(WaitSet_test* test,
                                          const std::function<WaitSet<>::NotificationInfoVector()>& waitCall)
 {
@@ -392,6 +392,7 @@ TEST_F(PoshRuntime_test, GetMiddlewarePublisherWithForbiddenServiceDescriptionsF
 
     // Added by ProcessManager
     internalServices.push_back(iox::roudi::IntrospectionMempoolService);
+    internalServices.push_back(iox::roudi::IntrospectionMemPoolAllocationSizeService);
     internalServices.push_back(iox::roudi::IntrospectionProcessService);
 
     for (auto& service : internalServices)
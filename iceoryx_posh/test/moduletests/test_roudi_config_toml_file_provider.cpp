@@ -55,6 +55,117 @@ TEST_F(RoudiConfigTomlFileProvider_test, ParseDefaultConfigIsSuccessful)
     EXPECT_FALSE(result.has_error());
 }
 
+TEST_F(RoudiConfigTomlFileProvider_test, ParseMemPoolFallbackPolicyOfEverySegment)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5ac825d2-9f2d-416b-89dc-20b13a7dc491");
+    m_cmdLineArgs.configFilePath.append(iox::cxx::TruncateToCapacity, "roudi_config_mempool_fallback.toml");
+
+    iox::config::TomlRouDiConfigFileProvider sut(m_cmdLineArgs);
+
+    auto result = sut.parse();
+
+    ASSERT_FALSE(result.has_error());
+    const auto& segments = result.value().m_sharedMemorySegments;
+    ASSERT_THAT(segments.size(), Eq(3U));
+    EXPECT_THAT(segments[0].m_mempoolConfig.m_fallbackPolicy, Eq(iox::mepoo::MemPoolFallbackPolicy::STRICT));
+    EXPECT_THAT(segments[1].m_mempoolConfig.m_fallbackPolicy, Eq(iox::mepoo::MemPoolFallbackPolicy::NEXT_LARGER));
+    EXPECT_THAT(segments[2].m_mempoolConfig.m_fallbackPolicy, Eq(iox::mepoo::MemPoolFallbackPolicy::ANY_LARGER));
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParseHugePagesOfEverySegment)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9b2bfac7-7e99-4834-8228-6d16fe1dc408");
+    m_cmdLineArgs.configFilePath.append(iox::cxx::TruncateToCapacity, "roudi_config_huge_pages.toml");
+
+    iox::config::TomlRouDiConfigFileProvider sut(m_cmdLineArgs);
+
+    auto result = sut.parse();
+
+    ASSERT_FALSE(result.has_error());
+    const auto& segments = result.value().m_sharedMemorySegments;
+    ASSERT_THAT(segments.size(), Eq(3U));
+    EXPECT_THAT(segments[0].m_mempoolConfig.m_hugePageSize, Eq(0U));
+    EXPECT_THAT(segments[1].m_mempoolConfig.m_hugePageSize, Eq(iox::mepoo::MePooConfig::HUGE_PAGE_SIZE_2M));
+    EXPECT_THAT(segments[1].m_mempoolConfig.m_hugePageMount.c_str(),
+                StrEq(iox::mepoo::MePooConfig::DEFAULT_HUGE_PAGE_MOUNT));
+    EXPECT_THAT(segments[2].m_mempoolConfig.m_hugePageSize, Eq(iox::mepoo::MePooConfig::HUGE_PAGE_SIZE_1G));
+    EXPECT_THAT(segments[2].m_mempoolConfig.m_hugePageMount.c_str(), StrEq("/mnt/huge-1G"));
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParseNumaPolicyOfEverySegment)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "72d0eaf8-087f-4355-892e-609ab870856e");
+    m_cmdLineArgs.configFilePath.append(iox::cxx::TruncateToCapacity, "roudi_config_numa.toml");
+
+    iox::config::TomlRouDiConfigFileProvider sut(m_cmdLineArgs);
+
+    auto result = sut.parse();
+
+    ASSERT_FALSE(result.has_error());
+    const auto& segments = result.value().m_sharedMemorySegments;
+    ASSERT_THAT(segments.size(), Eq(4U));
+    EXPECT_THAT(segments[0].m_mempoolConfig.m_numaPolicy.mode, Eq(iox::posix::NumaPolicy::Mode::DEFAULT));
+    EXPECT_THAT(segments[0].m_mempoolConfig.m_numaPolicy.nodeMask, Eq(0U));
+    EXPECT_THAT(segments[1].m_mempoolConfig.m_numaPolicy.mode, Eq(iox::posix::NumaPolicy::Mode::BIND));
+    EXPECT_THAT(segments[1].m_mempoolConfig.m_numaPolicy.nodeMask, Eq(0b1U));
+    EXPECT_THAT(segments[2].m_mempoolConfig.m_numaPolicy.mode, Eq(iox::posix::NumaPolicy::Mode::PREFERRED));
+    EXPECT_THAT(segments[2].m_mempoolConfig.m_numaPolicy.nodeMask, Eq(0b10U));
+    EXPECT_THAT(segments[3].m_mempoolConfig.m_numaPolicy.mode, Eq(iox::posix::NumaPolicy::Mode::INTERLEAVE));
+    EXPECT_THAT(segments[3].m_mempoolConfig.m_numaPolicy.nodeMask, Eq(0b1101U));
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParsePrefaultStrategyOfEverySegment)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7d0b6fa0-f4be-4751-98a6-e3aee1058e52");
+    m_cmdLineArgs.configFilePath.append(iox::cxx::TruncateToCapacity, "roudi_config_prefault.toml");
+
+    iox::config::TomlRouDiConfigFileProvider sut(m_cmdLineArgs);
+
+    auto result = sut.parse();
+
+    ASSERT_FALSE(result.has_error());
+    const auto& segments = result.value().m_sharedMemorySegments;
+    ASSERT_THAT(segments.size(), Eq(5U));
+    EXPECT_THAT(segments[0].m_mempoolConfig.m_prefaultStrategy, Eq(iox::posix::PrefaultStrategy::ZERO));
+    EXPECT_THAT(segments[1].m_mempoolConfig.m_prefaultStrategy, Eq(iox::posix::PrefaultStrategy::ZERO));
+    EXPECT_THAT(segments[2].m_mempoolConfig.m_prefaultStrategy, Eq(iox::posix::PrefaultStrategy::PARALLEL_ZERO));
+    EXPECT_THAT(segments[3].m_mempoolConfig.m_prefaultStrategy, Eq(iox::posix::PrefaultStrategy::POPULATE));
+    EXPECT_THAT(segments[4].m_mempoolConfig.m_prefaultStrategy, Eq(iox::posix::PrefaultStrategy::LAZY));
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParseLockInMemoryOfEverySegment)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5e8c3b1a-2f47-4d69-b0a3-9c71e6d48f25");
+    m_cmdLineArgs.configFilePath.append(iox::cxx::TruncateToCapacity, "roudi_config_lock_in_memory.toml");
+
+    iox::config::TomlRouDiConfigFileProvider sut(m_cmdLineArgs);
+
+    auto result = sut.parse();
+
+    ASSERT_FALSE(result.has_error());
+    const auto& segments = result.value().m_sharedMemorySegments;
+    ASSERT_THAT(segments.size(), Eq(3U));
+    EXPECT_FALSE(segments[0].m_mempoolConfig.m_lockInMemory);
+    EXPECT_FALSE(segments[1].m_mempoolConfig.m_lockInMemory);
+    EXPECT_TRUE(segments[2].m_mempoolConfig.m_lockInMemory);
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParseExtensionChunksOfEverySegment)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3c8f0e2b-6d14-4a7f-9b52-e1d6a0c7f493");
+    m_cmdLineArgs.configFilePath.append(iox::cxx::TruncateToCapacity, "roudi_config_extension_chunks.toml");
+
+    iox::config::TomlRouDiConfigFileProvider sut(m_cmdLineArgs);
+
+    auto result = sut.parse();
+
+    ASSERT_FALSE(result.has_error());
+    const auto& segments = result.value().m_sharedMemorySegments;
+    ASSERT_THAT(segments.size(), Eq(2U));
+    EXPECT_THAT(segments[0].m_mempoolConfig.m_maxNumberOfExtensionChunks, Eq(0U));
+    EXPECT_THAT(segments[1].m_mempoolConfig.m_maxNumberOfExtensionChunks, Eq(5000U));
+}
+
 INSTANTIATE_TEST_SUITE_P(
     ParseAllMalformedInputConfigFiles,
     RoudiConfigTomlFileProvider_test,
@@ -74,6 +185,22 @@ INSTANTIATE_TEST_SUITE_P(
                                  "roudi_config_error_mempool_without_chunk_size.toml"},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_COUNT,
                                  "roudi_config_error_mempool_without_chunk_count.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_MEMPOOL_FALLBACK_POLICY,
+                                 "roudi_config_error_invalid_mempool_fallback.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_HUGE_PAGE_SIZE,
+                                 "roudi_config_error_invalid_huge_page_size.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_HUGE_PAGE_MOUNT,
+                                 "roudi_config_error_invalid_huge_page_mount.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_NUMA_POLICY,
+                                 "roudi_config_error_invalid_numa_policy.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_NUMA_NODES,
+                                 "roudi_config_error_invalid_numa_nodes.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_PREFAULT_STRATEGY,
+                                 "roudi_config_error_invalid_prefault_strategy.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_LOCK_IN_MEMORY,
+                                 "roudi_config_error_invalid_lock_in_memory.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_EXTENSION_CHUNKS,
+                                 "roudi_config_error_invalid_extension_chunks.toml"},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::EXCEPTION_IN_PARSER,
                                  "toml_parser_exception.toml"}));
 
@@ -98,6 +98,10 @@ class MemPoolIntrospectionAccess
     {
         return this->m_publisherPort;
     }
+    MockPublisherPortUserAccess& getAllocationSizePublisherPort()
+    {
+        return this->m_allocationSizePublisherPort.value();
+    }
 
     using iox::roudi::MemPoolIntrospection<MePooMemoryManager_MOCK, SegmentManagerMock, MockPublisherPortUserAccess>::
         send;
@@ -186,6 +190,7 @@ class MemPoolIntrospection_test : public Test
     MePooMemoryManager_MOCK m_rouDiInternalMemoryManager_mock;
     SegmentManagerMock m_segmentManager_mock;
     MockPublisherPortUserAccess m_publisherPortImpl_mock;
+    MockPublisherPortUserAccess m_allocationSizePublisherPortImpl_mock;
 };
 
 TEST_F(MemPoolIntrospection_test, CTOR)
@@ -218,6 +223,26 @@ TEST_F(MemPoolIntrospection_test, send_noSubscribers)
 }
 
 /// @todo iox-#518 Test with multiple segments and also test the mempool info from RouDiInternalMemoryManager
+TEST_F(MemPoolIntrospection_test, RegisteredAllocationSizePublisherPortIsOfferedAndSendsNothingWithoutSubscribers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0efcc075-ad71-4f92-ad1c-3a2658652814");
+    {
+        EXPECT_CALL(callChecker(), offer()).Times(2);
+
+        MemPoolIntrospectionAccess introspectionAccess(
+            m_rouDiInternalMemoryManager_mock, m_segmentManager_mock, std::move(m_publisherPortImpl_mock));
+        introspectionAccess.registerAllocationSizePublisherPort(std::move(m_allocationSizePublisherPortImpl_mock));
+
+        EXPECT_CALL(introspectionAccess.getPublisherPort(), tryAllocateChunk(_, _, _, _)).Times(0);
+        EXPECT_CALL(introspectionAccess.getAllocationSizePublisherPort(), tryAllocateChunk(_, _, _, _)).Times(0);
+
+        introspectionAccess.send();
+
+        EXPECT_CALL(introspectionAccess.getPublisherPort(), stopOffer()).Times(1);
+        EXPECT_CALL(introspectionAccess.getAllocationSizePublisherPort(), stopOffer()).Times(1);
+    }
+}
+
 TEST_F(MemPoolIntrospection_test, Send_withSubscribers)
 {
     ::testing::Test::RecordProperty("TEST_ID", "52c48ddb-e7b6-450d-b262-1e24401ac878");
@@ -231,7 +256,7 @@ TEST_F(MemPoolIntrospection_test, Send_withSubscribers)
         m_rouDiInternalMemoryManager_mock, m_segmentManager_mock, std::move(m_publisherPortImpl_mock));
 
     MemPoolInfoContainer memPoolInfoContainer;
-    MemPoolInfo memPoolInfo{0, 0, 0, 0};
+    MemPoolInfo memPoolInfo{0, 0, 0, 0, 0};
     initMemPoolInfoContainer(memPoolInfoContainer);
 
     EXPECT_CALL(m_segmentManager_mock.m_segmentContainer.front().getMemoryManager(), getMemPoolInfo(_))
@@ -258,7 +283,7 @@ TIMING_TEST_F(MemPoolIntrospection_test, thread, Repeat(5), [&] {
         m_rouDiInternalMemoryManager_mock, m_segmentManager_mock, std::move(m_publisherPortImpl_mock));
 
     MemPoolInfoContainer memPoolInfoContainer;
-    MemPoolInfo memPoolInfo(0, 0, 0, 0);
+    MemPoolInfo memPoolInfo(0, 0, 0, 0, 0);
     initMemPoolInfoContainer(memPoolInfoContainer);
 
     EXPECT_CALL(m_rouDiInternalMemoryManager_mock, getMemPoolInfo(_)).WillRepeatedly(Invoke([&](uint32_t index) {
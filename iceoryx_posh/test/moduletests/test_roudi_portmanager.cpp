@@ -1000,4 +1000,51 @@ TEST_F(PortManager_test, PortsDestroyInProcess2ChangeStatesOfPortsInProcess1)
     }
 }
 
+TEST_F(PortManager_test, DestroyedSubscriberIsKeptUntilThePublisherWhichDiedWhileSendingIsCleanedUp)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "57441058-2f0f-4c39-a74f-73ccdb3eb03b");
+    const iox::RuntimeName_t publisherRuntimeName{"guiseppe"};
+    const iox::RuntimeName_t subscriberRuntimeName{"schlomo"};
+
+    auto publisherData = m_portManager
+                             ->acquirePublisherPortData({"1", "1", "1"},
+                                                        createTestPubOptions(),
+                                                        publisherRuntimeName,
+                                                        m_payloadDataSegmentMemoryManager,
+                                                        PortConfigInfo())
+                             .value();
+    auto subscriberData = m_portManager
+                              ->acquireSubscriberPortData(
+                                  {"1", "1", "1"}, createTestSubOptions(), subscriberRuntimeName, PortConfigInfo())
+                              .value();
+    m_portManager->doDiscovery();
+
+    PublisherPortUser publisher(publisherData);
+    ASSERT_TRUE(publisher.hasSubscribers());
+
+    auto portPool = m_roudiMemoryManager->portPool().value();
+    auto isSubscriberPortInPool = [&] {
+        auto subscriberPorts = portPool->getSubscriberPortDataList();
+        return std::find(subscriberPorts.begin(), subscriberPorts.end(), subscriberData) != subscriberPorts.end();
+    };
+
+    // the publishing application dies while it is registered as reader of the queue snapshot
+    auto& chunkSenderData = publisherData->m_chunkSenderData;
+    auto& activeSnapshot = chunkSenderData.m_queueSnapshots[chunkSenderData.m_queueSnapshotVersion.load() % 2U];
+    activeSnapshot.m_readerCount.fetch_add(1U);
+
+    // the removal of the queue gives up on the publisher, RouDi keeps running but must not free the queue
+    m_portManager->deletePortsOfProcess(subscriberRuntimeName);
+    EXPECT_FALSE(publisher.hasSubscribers());
+    EXPECT_TRUE(isSubscriberPortInPool());
+
+    m_portManager->doDiscovery();
+    EXPECT_TRUE(isSubscriberPortInPool());
+
+    // the monitoring detected the dead publisher
+    m_portManager->deletePortsOfProcess(publisherRuntimeName);
+    m_portManager->doDiscovery();
+    EXPECT_FALSE(isSubscriberPortInPool());
+}
+
 } // namespace iox_test_roudi_portmanager
@@ -0,0 +1,117 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/delivery_thread_pool.hpp"
+#include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using ChunkQueueData_t = iox::popo::PublisherPortData::ChunkQueueData_t;
+using ChunkDistributorData_t = iox::popo::PublisherPortData::ChunkDistributorData_t;
+using ChunkDistributor_t = iox::popo::ChunkDistributor<ChunkDistributorData_t>;
+using ChunkQueuePopper_t = iox::popo::ChunkQueuePopper<ChunkQueueData_t>;
+
+constexpr uint64_t NUMBER_OF_SENDS{10000U};
+constexpr uint32_t USER_PAYLOAD_SIZE{64U};
+constexpr uint32_t NUMBER_OF_CHUNKS{16U};
+constexpr uint64_t MEMORY_SIZE{1U << 20U};
+
+std::unique_ptr<uint8_t[]> memory{new uint8_t[MEMORY_SIZE]};
+iox::posix::Allocator allocator{memory.get(), MEMORY_SIZE};
+iox::mepoo::MemPool mempool{
+    sizeof(iox::mepoo::ChunkHeader) + USER_PAYLOAD_SIZE, NUMBER_OF_CHUNKS, allocator, allocator};
+iox::mepoo::MemPool chunkMgmtPool{128U, NUMBER_OF_CHUNKS, allocator, allocator};
+
+iox::mepoo::SharedChunk allocateChunk()
+{
+    auto chunkSettings =
+        iox::mepoo::ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value();
+    auto chunkHeader = new (mempool.getChunk()) iox::mepoo::ChunkHeader(mempool.getChunkSize(), chunkSettings);
+    auto chunkMgmt = new (chunkMgmtPool.getChunk()) iox::mepoo::ChunkManagement{chunkHeader, &mempool, &chunkMgmtPool};
+    return iox::mepoo::SharedChunk(chunkMgmt);
+}
+
+/// @brief every subscriber has its own condition variable like a subscriber which is attached to a WaitSet or Listener
+/// and collects the notification after every send, therefore every delivery also notifies
+std::chrono::nanoseconds measureSendLatency(const uint64_t numberOfSubscribers,
+                                            const uint64_t parallelDeliveryThreshold)
+{
+    ChunkDistributorData_t distributorData{
+        iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, 0U, parallelDeliveryThreshold};
+    ChunkDistributor_t distributor(&distributorData);
+
+    std::vector<std::unique_ptr<ChunkQueueData_t>> queues;
+    std::vector<std::unique_ptr<iox::popo::ConditionVariableData>> conditionVariables;
+    for (uint64_t i = 0U; i < numberOfSubscribers; ++i)
+    {
+        queues.emplace_back(new ChunkQueueData_t(iox::popo::QueueFullPolicy::DISCARD_OLDEST_DATA,
+                                                 iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer));
+        conditionVariables.emplace_back(new iox::popo::ConditionVariableData("benchmark"));
+        ChunkQueuePopper_t(queues.back().get()).setConditionVariable(*conditionVariables.back(), 0U);
+        if (distributor.tryAddQueue(queues.back().get()).has_error())
+        {
+            std::cerr << "unable to add queue " << i << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+    }
+
+    std::chrono::nanoseconds sendDuration{0};
+    for (uint64_t i = 0U; i < NUMBER_OF_SENDS; ++i)
+    {
+        auto chunk = allocateChunk();
+        auto start = std::chrono::steady_clock::now();
+        distributor.deliverToAllStoredQueues(chunk);
+        sendDuration += std::chrono::steady_clock::now() - start;
+
+        for (uint64_t j = 0U; j < numberOfSubscribers; ++j)
+        {
+            ChunkQueuePopper_t(queues[j].get()).tryPop();
+            iox::popo::ConditionListener(*conditionVariables[j]).timedWait(iox::units::Duration::zero());
+        }
+    }
+
+    IOX_DISCARD_RESULT(distributor.removeAllQueues());
+    return sendDuration / NUMBER_OF_SENDS;
+}
+
+int main()
+{
+    std::cout << "delivery threads: " << iox::popo::DeliveryThreadPool::instance().numberOfThreads() << std::endl;
+    std::cout << "average send latency of " << NUMBER_OF_SENDS << " sends" << std::endl;
+    std::cout << std::setw(12) << "subscribers" << std::setw(16) << "serial [ns]" << std::setw(16) << "parallel [ns]"
+              << std::endl;
+
+    for (uint64_t numberOfSubscribers = 1U; numberOfSubscribers <= iox::MAX_SUBSCRIBERS_PER_PUBLISHER;
+         numberOfSubscribers *= 2U)
+    {
+        auto serial = measureSendLatency(numberOfSubscribers, 0U);
+        auto parallel = measureSendLatency(numberOfSubscribers, 1U);
+        std::cout << std::setw(12) << numberOfSubscribers << std::setw(16) << serial.count() << std::setw(16)
+                  << parallel.count() << std::endl;
+    }
+}
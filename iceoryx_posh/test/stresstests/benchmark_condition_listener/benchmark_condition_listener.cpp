@@ -0,0 +1,78 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+iox::popo::ConditionVariableData condVarData{"benchmark"};
+iox::popo::ConditionListener listener{condVarData};
+uint64_t numberOfCollectedNotifications{0U};
+
+/// @brief notifies NumberOfNotifications indices which are spread over the whole range of notifiers and collects
+/// them with a single wait
+template <uint64_t NumberOfNotifications>
+void notifyAndCollect()
+{
+    constexpr uint64_t STRIDE{iox::MAX_NUMBER_OF_NOTIFIERS / NumberOfNotifications};
+    for (uint64_t i = 0U; i < NumberOfNotifications; ++i)
+    {
+        iox::popo::ConditionNotifier(condVarData, i * STRIDE).notify();
+    }
+    numberOfCollectedNotifications += listener.wait().size();
+}
+
+template <uint64_t NumberOfNotifications>
+void performBenchmark(const iox::units::Duration& duration)
+{
+    std::atomic_bool keepRunning{true};
+    uint64_t numberOfCalls{0U};
+    std::thread t([&] {
+        while (keepRunning)
+        {
+            notifyAndCollect<NumberOfNotifications>();
+            ++numberOfCalls;
+        }
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(duration.toMilliseconds()));
+    keepRunning = false;
+    t.join();
+
+    std::cout << "[ " << duration << " ] " << std::setw(15) << numberOfCalls << " : notify " << std::setw(3)
+              << NumberOfNotifications << " of " << iox::MAX_NUMBER_OF_NOTIFIERS << " notifiers and collect them"
+              << std::endl;
+}
+
+int main()
+{
+    using namespace iox::units::duration_literals;
+    auto timeout = 1_s;
+
+    performBenchmark<1U>(timeout);
+    performBenchmark<4U>(timeout);
+    performBenchmark<64U>(timeout);
+    performBenchmark<256U>(timeout);
+
+    std::cout << "collected notifications: " << numberOfCollectedNotifications << std::endl;
+}
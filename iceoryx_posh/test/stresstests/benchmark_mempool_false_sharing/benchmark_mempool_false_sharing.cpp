@@ -0,0 +1,113 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+constexpr uint64_t MAX_NUMBER_OF_THREADS{8U};
+constexpr uint64_t NUMBER_OF_ALLOCATIONS{1000000U};
+constexpr uint32_t CHUNK_SIZE{128U};
+constexpr uint32_t NUMBER_OF_CHUNKS{64U};
+constexpr uint64_t MEMORY_SIZE{1U << 20U};
+/// @brief the distance of the separately allocated mempools, large enough to not even share a page
+constexpr uint64_t SEPARATION{4096U};
+
+using MemPoolVector_t = iox::cxx::vector<iox::mepoo::MemPool, MAX_NUMBER_OF_THREADS>;
+
+/// @brief every thread allocates and frees chunks of its own mempool, the only thing the threads might share is a
+/// cache line of neighbouring mempools
+double measureAllocationsPerSecond(const std::vector<iox::mepoo::MemPool*>& memPools)
+{
+    std::atomic_bool start{false};
+    std::vector<std::thread> threads;
+    for (auto memPool : memPools)
+    {
+        threads.emplace_back([&start, memPool] {
+            while (!start.load())
+            {
+                std::this_thread::yield();
+            }
+            for (uint64_t i = 0U; i < NUMBER_OF_ALLOCATIONS; ++i)
+            {
+                memPool->freeChunk(memPool->getChunk());
+            }
+        });
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    start.store(true);
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    std::chrono::duration<double> duration = std::chrono::steady_clock::now() - begin;
+
+    return static_cast<double>(NUMBER_OF_ALLOCATIONS * memPools.size()) / duration.count();
+}
+
+int main()
+{
+    std::unique_ptr<uint8_t[]> memory{new uint8_t[MEMORY_SIZE]};
+    iox::posix::Allocator allocator{memory.get(), MEMORY_SIZE};
+
+    // the mempools are neighbours like in the MemoryManager
+    MemPoolVector_t adjacentMemPools;
+    // every mempool is placed far away from the others
+    std::unique_ptr<uint8_t[]> separatedMemory{new uint8_t[MAX_NUMBER_OF_THREADS * SEPARATION]};
+    std::vector<iox::mepoo::MemPool*> separatedMemPools;
+    for (uint64_t i = 0U; i < MAX_NUMBER_OF_THREADS; ++i)
+    {
+        adjacentMemPools.emplace_back(CHUNK_SIZE, NUMBER_OF_CHUNKS, allocator, allocator);
+        separatedMemPools.emplace_back(new (separatedMemory.get() + i * SEPARATION)
+                                           iox::mepoo::MemPool(CHUNK_SIZE, NUMBER_OF_CHUNKS, allocator, allocator));
+    }
+
+    std::cout << "sizeof(MemPool): " << sizeof(iox::mepoo::MemPool) << std::endl;
+    std::cout << "allocations per second, every thread uses its own mempool" << std::endl;
+    std::cout << std::setw(8) << "threads" << std::setw(16) << "adjacent" << std::setw(16) << "separated" << std::endl;
+
+    const uint64_t maxNumberOfThreads =
+        std::min(MAX_NUMBER_OF_THREADS, std::max<uint64_t>(std::thread::hardware_concurrency(), 2U));
+    for (uint64_t numberOfThreads = 1U; numberOfThreads <= maxNumberOfThreads; ++numberOfThreads)
+    {
+        std::vector<iox::mepoo::MemPool*> adjacent;
+        for (uint64_t i = 0U; i < numberOfThreads; ++i)
+        {
+            adjacent.emplace_back(&adjacentMemPools[i]);
+        }
+        std::vector<iox::mepoo::MemPool*> separated(separatedMemPools.begin(),
+                                                    separatedMemPools.begin() + static_cast<int64_t>(numberOfThreads));
+
+        std::cout << std::setw(8) << numberOfThreads << std::setw(16) << std::fixed << std::setprecision(0)
+                  << measureAllocationsPerSecond(adjacent) << std::setw(16) << measureAllocationsPerSecond(separated)
+                  << std::endl;
+    }
+
+    for (auto memPool : separatedMemPools)
+    {
+        memPool->~MemPool();
+    }
+}
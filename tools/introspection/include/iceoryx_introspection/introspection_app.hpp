@@ -130,7 +130,10 @@ class IntrospectionApp
     void printProcessIntrospectionData(const ProcessIntrospectionFieldTopic* processIntrospectionField);
 
     /// @brief prints table showing current mempool usage
-    void printMemPoolInfo(const MemPoolIntrospectionInfo& introspectionInfo);
+    /// @param[in] introspectionInfo the mempools of one shared memory segment
+    /// @param[in] allocationSizeHistograms the allocation sizes of these mempools, empty when they are not received yet
+    void printMemPoolInfo(const MemPoolIntrospectionInfo& introspectionInfo,
+                          const AllocationSizeHistogramContainer& allocationSizeHistograms);
 
     /// @brief Waits till port is subscribed
     template <typename Subscriber>
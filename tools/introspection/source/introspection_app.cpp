@@ -256,7 +256,8 @@ void IntrospectionApp::printProcessIntrospectionData(const ProcessIntrospectionF
     wprintw(pad, "\n");
 }
 
-void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspectionInfo)
+void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspectionInfo,
+                                        const AllocationSizeHistogramContainer& allocationSizeHistograms)
 {
     wprintw(pad, "Segment ID: %d\n", introspectionInfo.m_id);
 
@@ -274,14 +275,22 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
     constexpr int32_t minFreechunksWidth{9};
     constexpr int32_t chunkSizeWidth{11};
     constexpr int32_t chunkPayloadSizeWidth{13};
+    constexpr int32_t fallbacksWidth{10};
+    constexpr int32_t failedWidth{8};
+    constexpr int32_t maxUsageWidth{10};
 
     wprintw(pad, "%*s |", memPoolWidth, "MemPool");
     wprintw(pad, "%*s |", usedchunksWidth, "Chunks In Use");
     wprintw(pad, "%*s |", numchunksWidth, "Total");
     wprintw(pad, "%*s |", minFreechunksWidth, "Min Free");
     wprintw(pad, "%*s |", chunkSizeWidth, "Chunk Size");
-    wprintw(pad, "%*s\n", chunkPayloadSizeWidth, "Chunk Payload Size");
-    wprintw(pad, "--------------------------------------------------------------------------------\n");
+    wprintw(pad, "%*s |", chunkPayloadSizeWidth, "Chunk Payload Size");
+    wprintw(pad, "%*s |", fallbacksWidth, "Fallbacks");
+    wprintw(pad, "%*s |", failedWidth, "Failed");
+    wprintw(pad, "%*s\n", maxUsageWidth, "Max Usage");
+    wprintw(pad,
+            "--------------------------------------------------------------------------------------------"
+            "----------------------\n");
 
     for (size_t i = 0u; i < introspectionInfo.m_mempoolInfo.size(); ++i)
     {
@@ -293,7 +302,20 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
             wprintw(pad, "%*d |", numchunksWidth, info.m_numChunks);
             wprintw(pad, "%*d |", minFreechunksWidth, info.m_minFreeChunks);
             wprintw(pad, "%*d |", chunkSizeWidth, info.m_chunkSize);
-            wprintw(pad, "%*d\n", chunkPayloadSizeWidth, info.m_chunkPayloadSize);
+            wprintw(pad, "%*d |", chunkPayloadSizeWidth, info.m_chunkPayloadSize);
+            wprintw(pad, "%*llu |", fallbacksWidth, static_cast<unsigned long long>(info.m_numberOfFallbacks));
+            wprintw(pad, "%*llu |", failedWidth, static_cast<unsigned long long>(info.m_numberOfFailedAllocations));
+            if (i < allocationSizeHistograms.size() && allocationSizeHistograms[i].numberOfAllocations() > 0u)
+            {
+                wprintw(pad,
+                        "%*u%%\n",
+                        maxUsageWidth - 1,
+                        allocationSizeHistograms[i].maxAverageUsageInPercent(info.m_chunkSize));
+            }
+            else
+            {
+                wprintw(pad, "%*s\n", maxUsageWidth, "-");
+            }
         }
     }
     wprintw(pad, "\n");
@@ -616,15 +638,23 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
     // mempool
     iox::popo::Subscriber<MemPoolIntrospectionInfoContainer> memPoolSubscriber(IntrospectionMempoolService,
                                                                                subscriberOptions);
+    iox::popo::Subscriber<MemPoolAllocationSizeIntrospectionInfoContainer> memPoolAllocationSizeSubscriber(
+        IntrospectionMemPoolAllocationSizeService, subscriberOptions);
     if (introspectionSelection.mempool == true)
     {
         memPoolSubscriber.subscribe();
+        memPoolAllocationSizeSubscriber.subscribe();
 
         if (waitForSubscription(memPoolSubscriber) == false)
         {
             prettyPrint("Timeout while waiting for subscription for mempool introspection data!\n",
                         PrettyOptions::error);
         }
+        if (waitForSubscription(memPoolAllocationSizeSubscriber) == false)
+        {
+            prettyPrint("Timeout while waiting for subscription for mempool allocation size introspection data!\n",
+                        PrettyOptions::error);
+        }
     }
 
     // process
@@ -674,6 +704,7 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
     refreshTerminal();
 
     cxx::optional<popo::Sample<const MemPoolIntrospectionInfoContainer>> memPoolSample;
+    cxx::optional<popo::Sample<const MemPoolAllocationSizeIntrospectionInfoContainer>> memPoolAllocationSizeSample;
     cxx::optional<popo::Sample<const ProcessIntrospectionFieldTopic>> processSample;
     cxx::optional<popo::Sample<const PortIntrospectionFieldTopic>> portSample;
     cxx::optional<popo::Sample<const PortThroughputIntrospectionFieldTopic>> portThroughputSample;
@@ -696,12 +727,25 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
             prettyPrint("### MemPool Status ###\n\n", PrettyOptions::highlight);
 
             memPoolSubscriber.take().and_then([&](auto& sample) { memPoolSample = sample; });
+            memPoolAllocationSizeSubscriber.take().and_then(
+                [&](auto& sample) { memPoolAllocationSizeSample = sample; });
 
             if (memPoolSample)
             {
                 for (const auto& i : *(memPoolSample.value().get()))
                 {
-                    printMemPoolInfo(i);
+                    AllocationSizeHistogramContainer allocationSizeHistograms;
+                    if (memPoolAllocationSizeSample)
+                    {
+                        for (const auto& allocationSizes : *(memPoolAllocationSizeSample.value().get()))
+                        {
+                            if (allocationSizes.m_id == i.m_id)
+                            {
+                                allocationSizeHistograms = allocationSizes.m_allocationSizeHistograms;
+                            }
+                        }
+                    }
+                    printMemPoolInfo(i, allocationSizeHistograms);
                 }
             }
             else
@@ -0,0 +1,81 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_TOOLS_ICEORYX_MEMPOOL_TUNER_MEMPOOL_TUNER_HPP
+#define IOX_TOOLS_ICEORYX_MEMPOOL_TUNER_MEMPOOL_TUNER_HPP
+
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_posh/roudi/introspection_types.hpp"
+
+#include <cstdint>
+#include <map>
+
+namespace iox
+{
+namespace client
+{
+namespace mempool_tuner
+{
+/// @brief Derives the mempools of a segment from the mempool introspection of a representative run. The peak number
+/// of used chunks of a mempool, increased by its failed allocations and by the fallbacks which larger mempools served
+/// for it, is distributed over the buckets of its allocation size histogram; every bucket then demands chunks of the
+/// aligned upper bound of the bucket. The fallbacks are no longer counted as usage of the larger mempools. The demands
+/// of all mempools are grouped into at most MAX_NUMBER_OF_MEMPOOLS chunk sizes such that the chunk memory of the
+/// segment is minimal, the chunk count of every chunk size is finally increased by the headroom.
+class MemPoolTuner
+{
+  public:
+    /// @brief the number of chunks which are required for a chunk size, including the ChunkHeader
+    using Demand_t = std::map<uint32_t, uint64_t>;
+
+    /// @brief creates a MemPoolTuner
+    /// @param[in] headroomInPercent the additional chunks of every mempool relative to the peak demand
+    explicit MemPoolTuner(const uint32_t headroomInPercent) noexcept;
+
+    /// @brief derives the mempools of a segment
+    /// @param[in] memPoolInfo the mempool introspection of the segment
+    /// @param[in] allocationSizeHistograms the allocation size introspection of the segment, a mempool without a
+    /// histogram demands its peak usage with its own chunk size
+    /// @return the mempools with the minimal chunk memory which serve the demand with the headroom, the mempools of the
+    /// introspection when none of them was ever used
+    mepoo::MePooConfig tune(const roudi::MemPoolInfoContainer& memPoolInfo,
+                            const roudi::AllocationSizeHistogramContainer& allocationSizeHistograms =
+                                roudi::AllocationSizeHistogramContainer()) const noexcept;
+
+    /// @brief returns the chunk sizes and chunk counts which were required during the run
+    /// @param[in] memPoolInfo the mempool introspection of the segment
+    /// @param[in] allocationSizeHistograms the allocation size introspection of the segment, a mempool without a
+    /// histogram demands its peak usage with its own chunk size
+    /// @return the number of chunks which were used at the same time for every required chunk size
+    static Demand_t demand(const roudi::MemPoolInfoContainer& memPoolInfo,
+                           const roudi::AllocationSizeHistogramContainer& allocationSizeHistograms =
+                               roudi::AllocationSizeHistogramContainer()) noexcept;
+
+    /// @brief groups the demand into at most maxNumberOfMemPools chunk sizes with the minimal chunk memory
+    /// @param[in] demand the number of chunks for every required chunk size
+    /// @param[in] maxNumberOfMemPools the max number of chunk sizes
+    /// @return the number of chunks for every chosen chunk size; the chunks of a required chunk size are served by the
+    /// smallest chosen chunk size which is not smaller
+    static Demand_t group(const Demand_t& demand, const uint32_t maxNumberOfMemPools) noexcept;
+
+  private:
+    uint32_t m_headroomInPercent{0U};
+};
+
+} // namespace mempool_tuner
+} // namespace client
+} // namespace iox
+
+#endif // IOX_TOOLS_ICEORYX_MEMPOOL_TUNER_MEMPOOL_TUNER_HPP
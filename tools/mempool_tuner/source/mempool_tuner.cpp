@@ -0,0 +1,213 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_mempool_tuner/mempool_tuner.hpp"
+#include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/mepoo/allocation_size_histogram.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace iox
+{
+namespace client
+{
+namespace mempool_tuner
+{
+namespace
+{
+constexpr uint32_t CHUNK_HEADER_SIZE{static_cast<uint32_t>(sizeof(mepoo::ChunkHeader))};
+/// @brief the chunk-payload size must be at least the alignment of the chunks
+constexpr uint32_t MIN_CHUNK_SIZE{CHUNK_HEADER_SIZE + static_cast<uint32_t>(mepoo::MemPool::CHUNK_MEMORY_ALIGNMENT)};
+
+uint32_t alignedChunkSize(const uint32_t requiredChunkSize) noexcept
+{
+    return std::max(cxx::align(requiredChunkSize, static_cast<uint32_t>(mepoo::MemPool::CHUNK_MEMORY_ALIGNMENT)),
+                    MIN_CHUNK_SIZE);
+}
+} // namespace
+
+MemPoolTuner::MemPoolTuner(const uint32_t headroomInPercent) noexcept
+    : m_headroomInPercent(headroomInPercent)
+{
+}
+
+MemPoolTuner::Demand_t
+MemPoolTuner::demand(const roudi::MemPoolInfoContainer& memPoolInfo,
+                     const roudi::AllocationSizeHistogramContainer& allocationSizeHistograms) noexcept
+{
+    std::vector<uint64_t> peakNumberOfUsedChunksPerMemPool;
+    for (const auto& info : memPoolInfo)
+    {
+        peakNumberOfUsedChunksPerMemPool.push_back(
+            static_cast<uint64_t>(info.m_numChunks - std::min(info.m_minFreeChunks, info.m_numChunks)));
+    }
+
+    // every failed allocation could have been a chunk which was used in addition to the peak; a fallback is a chunk
+    // of a larger mempool which was requested from an exhausted one, it is therefore moved from the larger mempools,
+    // which are tried in the order of their chunk size, to the exhausted one
+    for (uint64_t index = 0U; index < memPoolInfo.size(); ++index)
+    {
+        uint64_t numberOfFallbacks = memPoolInfo[index].m_numberOfFallbacks;
+        peakNumberOfUsedChunksPerMemPool[index] += numberOfFallbacks + memPoolInfo[index].m_numberOfFailedAllocations;
+        for (uint64_t larger = index + 1U; larger < memPoolInfo.size() && numberOfFallbacks > 0U; ++larger)
+        {
+            const uint64_t numberOfServedFallbacks =
+                std::min(numberOfFallbacks, peakNumberOfUsedChunksPerMemPool[larger]);
+            peakNumberOfUsedChunksPerMemPool[larger] -= numberOfServedFallbacks;
+            numberOfFallbacks -= numberOfServedFallbacks;
+        }
+    }
+
+    Demand_t demand;
+    for (uint64_t index = 0U; index < memPoolInfo.size(); ++index)
+    {
+        const auto& info = memPoolInfo[index];
+        const uint64_t peakNumberOfUsedChunks = peakNumberOfUsedChunksPerMemPool[index];
+        if (peakNumberOfUsedChunks == 0U)
+        {
+            continue;
+        }
+
+        const uint64_t numberOfAllocations =
+            (index < allocationSizeHistograms.size()) ? allocationSizeHistograms[index].numberOfAllocations() : 0U;
+        if (numberOfAllocations == 0U)
+        {
+            // the chunks were only used as fallback for smaller mempools or the histogram is missing, the sizes are
+            // unknown
+            demand[alignedChunkSize(info.m_chunkSize)] += peakNumberOfUsedChunks;
+            continue;
+        }
+
+        // the peak is distributed like the allocations; rounding up ensures that every chunk size which was ever
+        // required gets at least one chunk
+        for (uint32_t bucket = 0U; bucket < mepoo::AllocationSizeHistogram::NUMBER_OF_BUCKETS; ++bucket)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) limited by NUMBER_OF_BUCKETS
+            const uint64_t count = allocationSizeHistograms[index].m_counts[bucket];
+            if (count == 0U)
+            {
+                continue;
+            }
+            const auto share = static_cast<uint64_t>(std::ceil(static_cast<long double>(peakNumberOfUsedChunks)
+                                                               * static_cast<long double>(count)
+                                                               / static_cast<long double>(numberOfAllocations)));
+            const uint32_t chunkSize =
+                alignedChunkSize(mepoo::AllocationSizeHistogram::upperBound(info.m_chunkSize, bucket));
+            demand[chunkSize] += share;
+        }
+    }
+    return demand;
+}
+
+MemPoolTuner::Demand_t MemPoolTuner::group(const Demand_t& demand, const uint32_t maxNumberOfMemPools) noexcept
+{
+    if (maxNumberOfMemPools == 0U)
+    {
+        return Demand_t();
+    }
+    if (demand.size() <= maxNumberOfMemPools)
+    {
+        return demand;
+    }
+
+    std::vector<uint32_t> chunkSizes;
+    // numberOfChunks[i] is the number of chunks which are required for the chunk sizes below chunkSizes[i]
+    std::vector<uint64_t> numberOfChunks{0U};
+    for (const auto& entry : demand)
+    {
+        chunkSizes.emplace_back(entry.first);
+        numberOfChunks.emplace_back(numberOfChunks.back() + entry.second);
+    }
+
+    // memory[k][j] is the minimal chunk memory when the smallest j chunk sizes are served by k mempools, the largest
+    // of them has the chunk size chunkSizes[j - 1]; firstChunkSize[k][j] is the first chunk size which is served by it
+    const uint64_t numberOfChunkSizes = chunkSizes.size();
+    constexpr uint64_t UNREACHABLE{std::numeric_limits<uint64_t>::max()};
+    std::vector<std::vector<uint64_t>> memory(maxNumberOfMemPools + 1U,
+                                              std::vector<uint64_t>(numberOfChunkSizes + 1U, UNREACHABLE));
+    std::vector<std::vector<uint64_t>> firstChunkSize(maxNumberOfMemPools + 1U,
+                                                      std::vector<uint64_t>(numberOfChunkSizes + 1U, 0U));
+    memory[0U][0U] = 0U;
+    for (uint64_t k = 1U; k <= maxNumberOfMemPools; ++k)
+    {
+        for (uint64_t j = k; j <= numberOfChunkSizes; ++j)
+        {
+            for (uint64_t i = k - 1U; i < j; ++i)
+            {
+                if (memory[k - 1U][i] == UNREACHABLE)
+                {
+                    continue;
+                }
+                const uint64_t chunkMemory =
+                    static_cast<uint64_t>(chunkSizes[j - 1U]) * (numberOfChunks[j] - numberOfChunks[i]);
+                const uint64_t candidate = memory[k - 1U][i] + chunkMemory;
+                if (candidate < memory[k][j])
+                {
+                    memory[k][j] = candidate;
+                    firstChunkSize[k][j] = i;
+                }
+            }
+        }
+    }
+
+    Demand_t grouped;
+    uint64_t j = numberOfChunkSizes;
+    for (uint64_t k = maxNumberOfMemPools; k > 0U && j > 0U; --k)
+    {
+        const uint64_t i = firstChunkSize[k][j];
+        grouped[chunkSizes[j - 1U]] = numberOfChunks[j] - numberOfChunks[i];
+        j = i;
+    }
+    return grouped;
+}
+
+mepoo::MePooConfig MemPoolTuner::tune(const roudi::MemPoolInfoContainer& memPoolInfo,
+                                      const roudi::AllocationSizeHistogramContainer& allocationSizeHistograms) const
+    noexcept
+{
+    mepoo::MePooConfig config;
+    const auto grouped = group(demand(memPoolInfo, allocationSizeHistograms), MAX_NUMBER_OF_MEMPOOLS);
+    if (grouped.empty())
+    {
+        for (const auto& info : memPoolInfo)
+        {
+            if (info.m_numChunks > 0U)
+            {
+                config.addMemPool({info.m_chunkPayloadSize, info.m_numChunks});
+            }
+        }
+        return config;
+    }
+
+    constexpr uint64_t PERCENT{100U};
+    for (const auto& entry : grouped)
+    {
+        const uint64_t numberOfChunks = (entry.second * (PERCENT + m_headroomInPercent) + PERCENT - 1U) / PERCENT;
+        config.addMemPool(
+            {entry.first - CHUNK_HEADER_SIZE,
+             static_cast<uint32_t>(std::min<uint64_t>(numberOfChunks, std::numeric_limits<uint32_t>::max()))});
+    }
+    return config;
+}
+
+} // namespace mempool_tuner
+} // namespace client
+} // namespace iox
@@ -0,0 +1,246 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_mempool_tuner/mempool_tuner.hpp"
+#include "iceoryx_platform/getopt.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/popo/subscriber.hpp"
+#include "iceoryx_posh/roudi/introspection_types.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_versions.hpp"
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+
+namespace
+{
+constexpr const char APP_NAME[] = "mempool_tuner";
+constexpr uint32_t DEFAULT_HEADROOM_IN_PERCENT{20U};
+constexpr uint64_t DEFAULT_TIMEOUT_IN_MS{5000U};
+constexpr std::chrono::milliseconds POLLING_INTERVAL{100};
+/// @brief the options of a segment which are not part of the mempool introspection and are therefore not written
+constexpr const char DROPPED_SEGMENT_OPTIONS[] = "mempool-fallback, huge-pages, huge-page-mount, numa-policy, "
+                                                 "numa-nodes, prefault, lock-in-memory, extension-chunks";
+
+struct Options
+{
+    uint32_t headroomInPercent{DEFAULT_HEADROOM_IN_PERCENT};
+    uint64_t timeoutInMs{DEFAULT_TIMEOUT_IN_MS};
+    std::string output;
+};
+
+void printHelp() noexcept
+{
+    std::cout << "Usage:\n"
+                 "  iox-mempool-tuner [OPTIONS]\n"
+                 "\nDerives a RouDi config with the smallest payload segments from the mempool introspection of a\n"
+                 "running RouDi. The introspection contains the peak usage and the allocation sizes since RouDi was\n"
+                 "started, therefore the tool should be run at the end of a representative run.\n"
+                 "\nOnly the writer and reader groups and the mempools of the segments are written. The other\n"
+                 "options of a segment are not part of the introspection and have to be copied from the original\n"
+                 "config: "
+              << DROPPED_SEGMENT_OPTIONS
+              << "\n"
+                 "\nOptions:\n"
+                 "  -h, --help                Display help and exit.\n"
+                 "  -v, --version             Display latest official iceoryx release version and exit.\n"
+                 "  -p, --headroom <percent>  Additional chunks relative to the peak usage [default: "
+              << DEFAULT_HEADROOM_IN_PERCENT
+              << "]\n"
+                 "  -o, --output <file>       Write the config to <file> instead of stdout.\n"
+                 "  -t, --timeout <ms>        Max time to wait for the mempool introspection [default: "
+              << DEFAULT_TIMEOUT_IN_MS << "]\n"
+              << std::endl;
+}
+
+Options parseCmdLineArguments(int argc, char** argv) noexcept
+{
+    constexpr option LONG_OPTIONS[] = {{"help", no_argument, nullptr, 'h'},
+                                       {"version", no_argument, nullptr, 'v'},
+                                       {"headroom", required_argument, nullptr, 'p'},
+                                       {"output", required_argument, nullptr, 'o'},
+                                       {"timeout", required_argument, nullptr, 't'},
+                                       {nullptr, 0, nullptr, 0}};
+    constexpr const char* SHORT_OPTIONS = "hvp:o:t:";
+
+    Options options;
+    int32_t opt{0};
+    int32_t index{0};
+    while ((opt = getopt_long(argc, argv, SHORT_OPTIONS, LONG_OPTIONS, &index)) != -1)
+    {
+        switch (opt)
+        {
+        case 'h':
+            printHelp();
+            exit(EXIT_SUCCESS);
+        case 'v':
+            std::cout << "Latest official iceoryx release version: " << ICEORYX_LATEST_RELEASE_VERSION << "\n"
+                      << std::endl;
+            exit(EXIT_SUCCESS);
+        case 'p':
+            if (!iox::cxx::convert::fromString(optarg, options.headroomInPercent))
+            {
+                std::cerr << "The headroom must be a percentage, e.g. '20'." << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            break;
+        case 'o':
+            options.output = optarg;
+            break;
+        case 't':
+            if (!iox::cxx::convert::fromString(optarg, options.timeoutInMs))
+            {
+                std::cerr << "The timeout must be given in milliseconds, e.g. '5000'." << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            break;
+        default:
+            std::cerr << "Run '" << argv[0] << " --help' for more information." << std::endl;
+            exit(EXIT_FAILURE);
+        }
+    }
+    return options;
+}
+
+void writeConfig(std::ostream& stream,
+                 const iox::roudi::MemPoolIntrospectionInfoContainer& introspection,
+                 const iox::roudi::MemPoolAllocationSizeIntrospectionInfoContainer* const allocationSizes,
+                 const Options& options) noexcept
+{
+    const iox::client::mempool_tuner::MemPoolTuner tuner{options.headroomInPercent};
+
+    stream << "# derived by iox-mempool-tuner with a headroom of " << options.headroomInPercent << "%\n";
+    stream << "# the segment options " << DROPPED_SEGMENT_OPTIONS << " are not derived,\n";
+    stream << "# copy them from the original config\n";
+    std::cerr << "The segment options " << DROPPED_SEGMENT_OPTIONS
+              << " are not part of the introspection and are not written, copy them from the original config."
+              << std::endl;
+    stream << "[general]\n";
+    stream << "version = 1\n";
+
+    for (const auto& segment : introspection)
+    {
+        // the first entry are the mempools of RouDi, they are not configurable
+        if (segment.m_id == 0U)
+        {
+            continue;
+        }
+
+        iox::mepoo::MePooConfig currentConfig;
+        for (const auto& info : segment.m_mempoolInfo)
+        {
+            if (info.m_numChunks > 0U)
+            {
+                currentConfig.addMemPool({info.m_chunkPayloadSize, info.m_numChunks});
+            }
+        }
+        iox::roudi::AllocationSizeHistogramContainer allocationSizeHistograms;
+        if (allocationSizes != nullptr)
+        {
+            for (const auto& entry : *allocationSizes)
+            {
+                if (entry.m_id == segment.m_id)
+                {
+                    allocationSizeHistograms = entry.m_allocationSizeHistograms;
+                }
+            }
+        }
+        const auto tunedConfig = tuner.tune(segment.m_mempoolInfo, allocationSizeHistograms);
+
+        std::cerr << "segment with writer group '" << segment.m_writerGroupName.c_str() << "' and reader group '"
+                  << segment.m_readerGroupName.c_str() << "': chunk memory "
+                  << iox::mepoo::MemoryManager::requiredChunkMemorySize(currentConfig) << " bytes, derived "
+                  << iox::mepoo::MemoryManager::requiredChunkMemorySize(tunedConfig) << " bytes" << std::endl;
+
+        stream << "\n[[segment]]\n";
+        stream << "writer = \"" << segment.m_writerGroupName.c_str() << "\"\n";
+        stream << "reader = \"" << segment.m_readerGroupName.c_str() << "\"\n";
+        for (const auto& entry : tunedConfig.m_mempoolConfig)
+        {
+            stream << "\n[[segment.mempool]]\n";
+            stream << "size = " << entry.m_size << "\n";
+            stream << "count = " << entry.m_chunkCount << "\n";
+        }
+    }
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const auto options = parseCmdLineArguments(argc, argv);
+
+    iox::runtime::PoshRuntime::initRuntime(APP_NAME);
+
+    iox::popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.queueCapacity = 1U;
+    subscriberOptions.historyRequest = 1U;
+    iox::popo::Subscriber<iox::roudi::MemPoolIntrospectionInfoContainer> subscriber(
+        iox::roudi::IntrospectionMempoolService, subscriberOptions);
+    iox::popo::Subscriber<iox::roudi::MemPoolAllocationSizeIntrospectionInfoContainer> allocationSizeSubscriber(
+        iox::roudi::IntrospectionMemPoolAllocationSizeService, subscriberOptions);
+
+    // the introspection contains the statistics since RouDi was started, therefore the latest sample is sufficient
+    iox::cxx::optional<iox::popo::Sample<const iox::roudi::MemPoolIntrospectionInfoContainer>> introspection;
+    iox::cxx::optional<iox::popo::Sample<const iox::roudi::MemPoolAllocationSizeIntrospectionInfoContainer>>
+        allocationSizes;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(options.timeoutInMs);
+    while ((!introspection.has_value() || !allocationSizes.has_value()) && std::chrono::steady_clock::now() < deadline)
+    {
+        if (!introspection.has_value())
+        {
+            subscriber.take().and_then([&](auto& sample) { introspection.emplace(std::move(sample)); });
+        }
+        if (!allocationSizes.has_value())
+        {
+            allocationSizeSubscriber.take().and_then([&](auto& sample) { allocationSizes.emplace(std::move(sample)); });
+        }
+        std::this_thread::sleep_for(POLLING_INTERVAL);
+    }
+    if (!introspection.has_value())
+    {
+        std::cerr << "No mempool introspection was received within " << options.timeoutInMs << " ms." << std::endl;
+        return EXIT_FAILURE;
+    }
+    const iox::roudi::MemPoolAllocationSizeIntrospectionInfoContainer* allocationSizesPtr{nullptr};
+    if (allocationSizes.has_value())
+    {
+        allocationSizesPtr = allocationSizes.value().get();
+    }
+    else
+    {
+        std::cerr << "No allocation size introspection was received within " << options.timeoutInMs
+                  << " ms, every mempool is derived with its own chunk size." << std::endl;
+    }
+
+    if (options.output.empty())
+    {
+        writeConfig(std::cout, *introspection.value(), allocationSizesPtr, options);
+        return EXIT_SUCCESS;
+    }
+
+    std::ofstream file(options.output);
+    if (!file)
+    {
+        std::cerr << "Unable to open '" << options.output << "' for writing." << std::endl;
+        return EXIT_FAILURE;
+    }
+    writeConfig(file, *introspection.value(), allocationSizesPtr, options);
+    return EXIT_SUCCESS;
+}
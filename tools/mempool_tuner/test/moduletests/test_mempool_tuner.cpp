@@ -0,0 +1,294 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_mempool_tuner/mempool_tuner.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/mepoo/allocation_size_histogram.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::client::mempool_tuner;
+using iox::mepoo::AllocationSizeHistogram;
+using iox::roudi::AllocationSizeHistogramContainer;
+using iox::roudi::MemPoolInfo;
+using iox::roudi::MemPoolInfoContainer;
+using Demand_t = MemPoolTuner::Demand_t;
+
+class MemPoolTuner_test : public Test
+{
+  public:
+    static MemPoolInfo createMemPoolInfo(const uint32_t chunkSize,
+                                         const uint32_t numberOfChunks,
+                                         const uint32_t minFreeChunks,
+                                         const uint64_t numberOfFailedAllocations = 0U)
+    {
+        MemPoolInfo info;
+        info.m_chunkSize = chunkSize;
+        info.m_chunkPayloadSize = chunkSize - CHUNK_HEADER_SIZE;
+        info.m_numChunks = numberOfChunks;
+        info.m_minFreeChunks = minFreeChunks;
+        info.m_numberOfFailedAllocations = numberOfFailedAllocations;
+        return info;
+    }
+
+    static uint32_t alignedUpperBound(const uint32_t chunkSize, const uint32_t bucket)
+    {
+        return iox::cxx::align(AllocationSizeHistogram::upperBound(chunkSize, bucket), CHUNK_ALIGNMENT);
+    }
+
+    static uint64_t numberOfChunks(const Demand_t& demand)
+    {
+        uint64_t sum{0U};
+        for (const auto& entry : demand)
+        {
+            sum += entry.second;
+        }
+        return sum;
+    }
+
+    /// @brief every required chunk size is served by the smallest chosen chunk size which is not smaller
+    static uint64_t chunkMemory(const Demand_t& demand, const Demand_t& grouped)
+    {
+        uint64_t memory{0U};
+        for (const auto& entry : demand)
+        {
+            const auto chosen = grouped.lower_bound(entry.first);
+            EXPECT_TRUE(chosen != grouped.end());
+            if (chosen != grouped.end())
+            {
+                memory += static_cast<uint64_t>(chosen->first) * entry.second;
+            }
+        }
+        return memory;
+    }
+
+    static constexpr uint32_t CHUNK_HEADER_SIZE{static_cast<uint32_t>(sizeof(iox::mepoo::ChunkHeader))};
+    static constexpr uint32_t CHUNK_ALIGNMENT{static_cast<uint32_t>(iox::mepoo::MemPool::CHUNK_MEMORY_ALIGNMENT)};
+    static constexpr uint32_t CHUNK_SIZE{1024U};
+};
+constexpr uint32_t MemPoolTuner_test::CHUNK_HEADER_SIZE;
+constexpr uint32_t MemPoolTuner_test::CHUNK_ALIGNMENT;
+constexpr uint32_t MemPoolTuner_test::CHUNK_SIZE;
+
+TEST_F(MemPoolTuner_test, MemPoolWithoutUsageHasNoDemand)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5e65a6b6-2a59-4de3-adae-842ca3a256b5");
+    MemPoolInfoContainer memPoolInfo;
+    memPoolInfo.emplace_back(createMemPoolInfo(CHUNK_SIZE, 10U, 10U));
+
+    EXPECT_TRUE(MemPoolTuner::demand(memPoolInfo).empty());
+}
+
+TEST_F(MemPoolTuner_test, SegmentWithoutUsageKeepsItsMemPools)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d77ea00a-9403-42f9-b9da-462454346372");
+    MemPoolInfoContainer memPoolInfo;
+    memPoolInfo.emplace_back(createMemPoolInfo(CHUNK_SIZE, 10U, 10U));
+    memPoolInfo.emplace_back(createMemPoolInfo(2U * CHUNK_SIZE, 0U, 0U));
+    memPoolInfo.emplace_back(createMemPoolInfo(4U * CHUNK_SIZE, 5U, 5U));
+
+    const auto config = MemPoolTuner(20U).tune(memPoolInfo);
+
+    ASSERT_THAT(config.m_mempoolConfig.size(), Eq(2U));
+    EXPECT_THAT(config.m_mempoolConfig[0U].m_size, Eq(CHUNK_SIZE - CHUNK_HEADER_SIZE));
+    EXPECT_THAT(config.m_mempoolConfig[0U].m_chunkCount, Eq(10U));
+    EXPECT_THAT(config.m_mempoolConfig[1U].m_size, Eq(4U * CHUNK_SIZE - CHUNK_HEADER_SIZE));
+    EXPECT_THAT(config.m_mempoolConfig[1U].m_chunkCount, Eq(5U));
+}
+
+TEST_F(MemPoolTuner_test, FailedAllocationsAreAddedToThePeakUsage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ab663e4a-7117-447d-8f11-111eed01dddb");
+    MemPoolInfoContainer memPoolInfo;
+    memPoolInfo.emplace_back(createMemPoolInfo(CHUNK_SIZE, 10U, 4U, 3U));
+    AllocationSizeHistogramContainer histograms(1U);
+    histograms.back().m_counts[0U] = 42U;
+
+    EXPECT_THAT(MemPoolTuner::demand(memPoolInfo, histograms), Eq(Demand_t{{CHUNK_SIZE, 6U + 3U}}));
+}
+
+TEST_F(MemPoolTuner_test, FailedAllocationsOfAnExhaustedMemPoolWithoutUsageAreDemanded)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0bfb3f05-2557-4180-a424-b880daf772a6");
+    MemPoolInfoContainer memPoolInfo;
+    memPoolInfo.emplace_back(createMemPoolInfo(CHUNK_SIZE, 0U, 0U, 7U));
+
+    EXPECT_THAT(MemPoolTuner::demand(memPoolInfo), Eq(Demand_t{{CHUNK_SIZE, 7U}}));
+}
+
+TEST_F(MemPoolTuner_test, FallbacksAreMovedFromTheLargerMemPoolsToTheExhaustedMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6b65b161-0807-4806-be6c-91007cf47729");
+    MemPoolInfoContainer memPoolInfo;
+    memPoolInfo.emplace_back(createMemPoolInfo(CHUNK_SIZE, 10U, 0U));
+    memPoolInfo.back().m_numberOfFallbacks = 7U;
+    memPoolInfo.emplace_back(createMemPoolInfo(2U * CHUNK_SIZE, 10U, 5U));
+    memPoolInfo.emplace_back(createMemPoolInfo(4U * CHUNK_SIZE, 10U, 6U));
+
+    // the second mempool served 5 fallbacks and the third one the remaining 2
+    EXPECT_THAT(MemPoolTuner::demand(memPoolInfo),
+                Eq(Demand_t{{CHUNK_SIZE, 10U + 7U}, {4U * CHUNK_SIZE, 4U - 2U}}));
+}
+
+TEST_F(MemPoolTuner_test, PeakUsageIsDistributedOverTheBucketsAndRoundedUp)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6e9c00f0-b1bb-4525-8d2b-469f0d379de0");
+    MemPoolInfoContainer memPoolInfo;
+    memPoolInfo.emplace_back(createMemPoolInfo(CHUNK_SIZE, 2U, 0U));
+    AllocationSizeHistogramContainer histograms(1U);
+    auto& counts = histograms.back().m_counts;
+    counts[0U] = 1U;
+    counts[1U] = 1U;
+    counts[AllocationSizeHistogram::BUCKETS_PER_OCTAVE] = 1U;
+
+    // a share of 2/3 chunks is rounded up to one chunk for every bucket
+    EXPECT_THAT(MemPoolTuner::demand(memPoolInfo, histograms),
+                Eq(Demand_t{{CHUNK_SIZE / 2U, 1U}, {alignedUpperBound(CHUNK_SIZE, 1U), 1U}, {CHUNK_SIZE, 1U}}));
+}
+
+TEST_F(MemPoolTuner_test, UpperBoundOfABucketIsAlignedToTheChunkAlignment)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "70e8a4ac-53b3-46de-bdd5-61f2e463fb61");
+    constexpr uint32_t BUCKET{1U};
+    const uint32_t upperBound = AllocationSizeHistogram::upperBound(CHUNK_SIZE, BUCKET);
+    ASSERT_THAT(upperBound % CHUNK_ALIGNMENT, Ne(0U));
+
+    MemPoolInfoContainer memPoolInfo;
+    memPoolInfo.emplace_back(createMemPoolInfo(CHUNK_SIZE, 1U, 0U));
+    AllocationSizeHistogramContainer histograms(1U);
+    histograms.back().m_counts[BUCKET] = 1U;
+
+    const auto demand = MemPoolTuner::demand(memPoolInfo, histograms);
+
+    ASSERT_THAT(demand.size(), Eq(1U));
+    const uint32_t chunkSize = demand.begin()->first;
+    EXPECT_THAT(chunkSize % CHUNK_ALIGNMENT, Eq(0U));
+    EXPECT_THAT(chunkSize, Gt(upperBound));
+    EXPECT_THAT(chunkSize, Lt(upperBound + CHUNK_ALIGNMENT));
+}
+
+TEST_F(MemPoolTuner_test, SmallestBucketDemandsAtLeastTheChunkHeaderAndTheAlignment)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "733a068c-37b8-4f9e-8e82-e953163d3c94");
+    constexpr uint32_t SMALL_CHUNK_SIZE{64U};
+    MemPoolInfoContainer memPoolInfo;
+    memPoolInfo.emplace_back(createMemPoolInfo(SMALL_CHUNK_SIZE, 1U, 0U));
+    AllocationSizeHistogramContainer histograms(1U);
+    histograms.back().m_counts[AllocationSizeHistogram::NUMBER_OF_BUCKETS - 1U] = 1U;
+
+    EXPECT_THAT(MemPoolTuner::demand(memPoolInfo, histograms),
+                Eq(Demand_t{{CHUNK_HEADER_SIZE + CHUNK_ALIGNMENT, 1U}}));
+}
+
+TEST_F(MemPoolTuner_test, GroupKeepsDemandWhichFitsIntoTheMemPools)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5c520f35-5ac9-4ef1-b939-1c75ba5ed88f");
+    const Demand_t demand{{128U, 3U}, {256U, 2U}, {1024U, 1U}};
+
+    EXPECT_THAT(MemPoolTuner::group(demand, 3U), Eq(demand));
+    EXPECT_TRUE(MemPoolTuner::group(demand, 0U).empty());
+}
+
+TEST_F(MemPoolTuner_test, GroupChoosesTheChunkSizesWithTheMinimalChunkMemory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fd334965-f06a-4e43-9b95-0f0738985731");
+    const Demand_t demand{{384U, 19U}, {448U, 12U}, {512U, 15U}, {576U, 9U}};
+
+    const auto grouped = MemPoolTuner::group(demand, 2U);
+
+    // merging step by step the chunk size with the least additional memory into the next larger one would end up
+    // with {384: 19, 576: 36} and 28032 bytes
+    EXPECT_THAT(grouped, Eq(Demand_t{{448U, 31U}, {576U, 24U}}));
+    EXPECT_THAT(chunkMemory(demand, grouped), Eq(27712U));
+}
+
+TEST_F(MemPoolTuner_test, GroupServesMoreChunkSizesThanMemPoolsWithoutLosingChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d60f161d-6bef-4e4a-a8fa-c95d7dfe26c2");
+    constexpr uint32_t NUMBER_OF_CHUNK_SIZES{iox::MAX_NUMBER_OF_MEMPOOLS + 8U};
+    Demand_t demand;
+    for (uint32_t i = 1U; i <= NUMBER_OF_CHUNK_SIZES; ++i)
+    {
+        demand[i * 64U] = i % 5U + 1U;
+    }
+
+    const auto grouped = MemPoolTuner::group(demand, iox::MAX_NUMBER_OF_MEMPOOLS);
+
+    EXPECT_THAT(grouped.size(), Eq(iox::MAX_NUMBER_OF_MEMPOOLS));
+    EXPECT_THAT(numberOfChunks(grouped), Eq(numberOfChunks(demand)));
+    ASSERT_FALSE(grouped.empty());
+    const uint32_t largestChunkSize = demand.rbegin()->first;
+    EXPECT_THAT(grouped.rbegin()->first, Eq(largestChunkSize));
+    EXPECT_THAT(chunkMemory(demand, grouped),
+                Lt(chunkMemory(demand, Demand_t{{largestChunkSize, numberOfChunks(demand)}})));
+}
+
+TEST_F(MemPoolTuner_test, TuneWithMoreChunkSizesThanMemPoolsUsesAllMemPools)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "46a031d5-78e8-4028-a481-24f6e5b1c954");
+    MemPoolInfoContainer memPoolInfo;
+    AllocationSizeHistogramContainer histograms;
+    for (const uint32_t chunkSize : {1024U, 1288U, 1608U})
+    {
+        memPoolInfo.emplace_back(createMemPoolInfo(chunkSize, 100U, 0U));
+        histograms.emplace_back();
+        for (auto& count : histograms.back().m_counts)
+        {
+            count = 1U;
+        }
+    }
+    const auto demand = MemPoolTuner::demand(memPoolInfo, histograms);
+    ASSERT_THAT(demand.size(), Gt(iox::MAX_NUMBER_OF_MEMPOOLS));
+
+    const auto config = MemPoolTuner(0U).tune(memPoolInfo, histograms);
+
+    ASSERT_THAT(config.m_mempoolConfig.size(), Eq(iox::MAX_NUMBER_OF_MEMPOOLS));
+    uint64_t sum{0U};
+    for (const auto& entry : config.m_mempoolConfig)
+    {
+        sum += entry.m_chunkCount;
+    }
+    EXPECT_THAT(sum, Eq(numberOfChunks(demand)));
+    EXPECT_THAT(config.m_mempoolConfig.back().m_size, Eq(1608U - CHUNK_HEADER_SIZE));
+}
+
+TEST_F(MemPoolTuner_test, HeadroomIsRoundedUpToWholeChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4df18666-f5a5-4e55-816f-cbb66bd2558a");
+    MemPoolInfoContainer memPoolInfo;
+    memPoolInfo.emplace_back(createMemPoolInfo(CHUNK_SIZE, 1U, 0U));
+    memPoolInfo.emplace_back(createMemPoolInfo(2U * CHUNK_SIZE, 10U, 0U));
+    memPoolInfo.emplace_back(createMemPoolInfo(4U * CHUNK_SIZE, 7U, 0U));
+
+    const auto config = MemPoolTuner(20U).tune(memPoolInfo);
+    ASSERT_THAT(config.m_mempoolConfig.size(), Eq(3U));
+    EXPECT_THAT(config.m_mempoolConfig[0U].m_size, Eq(CHUNK_SIZE - CHUNK_HEADER_SIZE));
+    EXPECT_THAT(config.m_mempoolConfig[0U].m_chunkCount, Eq(2U));
+    EXPECT_THAT(config.m_mempoolConfig[1U].m_chunkCount, Eq(12U));
+    EXPECT_THAT(config.m_mempoolConfig[2U].m_chunkCount, Eq(9U));
+
+    const auto configWithoutHeadroom = MemPoolTuner(0U).tune(memPoolInfo);
+    ASSERT_THAT(configWithoutHeadroom.m_mempoolConfig.size(), Eq(3U));
+    EXPECT_THAT(configWithoutHeadroom.m_mempoolConfig[2U].m_chunkCount, Eq(7U));
+}
+
+} // namespace